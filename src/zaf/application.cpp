@@ -43,7 +43,9 @@ void Application::Initialize(const InitializationOptions& parameters) {
 
     rx_runtime_ = std::make_unique<rx::internal::RxRuntime>();
 
-    resource_factory_.reset(new ResourceFactory(parameters.custom_uri_loader));
+    resource_factory_.reset(new ResourceFactory(
+        parameters.custom_uri_loader,
+        parameters.resource_cache_byte_budget));
 
     HRESULT result = OleInitialize(nullptr);
     ZAF_THROW_IF_COM_ERROR(result);
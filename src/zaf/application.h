@@ -49,6 +49,9 @@ public:
     HICON window_icon{};
     HICON window_small_icon{};
     std::shared_ptr<URILoader> custom_uri_loader;
+
+    //Max total size, in bytes, of contents cached by ResourceFactory. Zero disables the cache.
+    std::size_t resource_cache_byte_budget{ 16 * 1024 * 1024 };
 };
 
 /**
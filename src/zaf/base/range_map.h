@@ -6,6 +6,9 @@
 
 namespace zaf {
 
+template<typename T, typename Equal>
+class TreeRangeMap;
+
 template<typename T, typename Equal = std::equal_to<T>>
 class RangeMap {
 public:
@@ -28,8 +31,9 @@ public:
         }
 
     private:
-        //Allow RangeMap to modify the private members.
+        //Allow RangeMap and TreeRangeMap to modify the private members.
         friend RangeMap;
+        friend TreeRangeMap<T, Equal>;
 
         zaf::Range range_;
         T value_;
@@ -63,10 +67,105 @@ public:
     }
 
     void ReplaceSpan(const Range& span_range, std::size_t new_length) {
+        ReplaceSpanInItems(items_, span_range, new_length);
+    }
+    
+    void Clear() noexcept {
+        items_.clear();
+    }
+
+    iterator FindItemAtIndex(std::size_t index) noexcept {
+
+        auto iterator = std::lower_bound(
+            items_.begin(),
+            items_.end(),
+            index,
+            [](const Item& item, std::size_t index) {
+                return item.Range().EndIndex() <= index;
+            });
+
+        if (iterator != items_.end() && iterator->Range().Contains(index)) {
+            return iterator;
+        }
+
+        return items_.end();
+    }
+
+    const_iterator FindItemAtIndex(std::size_t index) const noexcept {
+        auto mutable_this = const_cast<RangeMap<T>*>(this);
+        return mutable_this->FindItemAtIndex(index);
+    }
+
+    iterator FindFirstItemIntersectsWithRange(const Range& range) noexcept {
+
+        auto iterator = std::lower_bound(
+            items_.begin(),
+            items_.end(),
+            range,
+            [](const Item& item, const Range& range) {
+                return item.Range().EndIndex() < range.index;
+            });
+
+        if (iterator != items_.end() && iterator->Range().Intersects(range)) {
+            return iterator;
+        }
+
+        return items_.end();
+    }
+
+    const_iterator FindFirstItemIntersectsWithRange(const Range& range) const noexcept {
+        auto mutable_this = const_cast<RangeMap<T>*>(this);
+        return mutable_this->FindFirstItemIntersectsWithRange(range);
+    }
+
+    bool IsEmpty() const noexcept {
+        return items_.empty();
+    }
+
+    std::size_t Count() const noexcept {
+        return items_.size();
+    }
+
+    iterator begin() noexcept {
+        return items_.begin();
+    }
+
+    iterator end() noexcept {
+        return items_.end();
+    }
+
+    const_iterator begin() const noexcept {
+        return items_.begin();
+    }
+
+    const_iterator end() const noexcept {
+        return items_.end();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return items_.cbegin();
+    }
+
+    const_iterator cend() const noexcept {
+        return items_.cend();
+    }
+
+private:
+    //Allow TreeRangeMap to share the algorithms that modify items.
+    friend TreeRangeMap<T, Equal>;
+
+    void ReplaceRange(const Range& replaced_range, T* const new_value) {
+        ReplaceRangeInItems(items_, replaced_range, new_value);
+    }
+
+    static void ReplaceSpanInItems(
+        ItemList& items,
+        const Range& span_range,
+        std::size_t new_length) {
 
         //Loop over all items to modify ranges.
-        auto iterator = items_.begin();
-        while (iterator != items_.end()) {
+        auto iterator = items.begin();
+        while (iterator != items.end()) {
 
             const auto current_range = iterator->Range();
 
@@ -90,7 +189,7 @@ public:
             //current range.
             if (span_range.Contains(current_range)) {
 
-                iterator = items_.erase(iterator);
+                iterator = items.erase(iterator);
                 continue;
             }
 
@@ -127,7 +226,7 @@ public:
                     };
 
                     ++iterator;
-                    iterator = items_.insert(iterator, std::move(tail_item));
+                    iterator = items.insert(iterator, std::move(tail_item));
                     ++iterator;
                 }
                 continue;
@@ -170,89 +269,14 @@ public:
             ++iterator;
         }
     }
-    
-    void Clear() noexcept {
-        items_.clear();
-    }
 
-    iterator FindItemAtIndex(std::size_t index) noexcept {
-
-        auto iterator = std::lower_bound(
-            items_.begin(),
-            items_.end(),
-            index,
-            [](const Item& item, std::size_t index) {
-                return item.Range().EndIndex() <= index;
-            });
-
-        if (iterator != items_.end() && iterator->Range().Contains(index)) {
-            return iterator;
-        }
-
-        return items_.end();
-    }
-
-    const_iterator FindItemAtIndex(std::size_t index) const noexcept {
-        auto mutable_this = const_cast<RangeMap<T>*>(this);
-        return mutable_this->FindItemAtIndex(index);
-    }
-
-    iterator FindFirstItemIntersectsWithRange(const Range& range) noexcept {
-
-        auto iterator = std::lower_bound(
-            items_.begin(),
-            items_.end(),
-            range,
-            [](const Item& item, const Range& range) {
-                return item.Range().EndIndex() < range.index;
-            });
-
-        if (iterator != items_.end() && iterator->Range().Intersects(range)) {
-            return iterator;
-        }
-
-        return items_.end();
-    }
-
-    const_iterator FindFirstItemIntersectsWithRange(const Range& range) const noexcept {
-        auto mutable_this = const_cast<RangeMap<T>*>(this);
-        return mutable_this->FindFirstItemIntersectsWithRange(range);
-    }
-
-    bool IsEmpty() const noexcept {
-        return items_.empty();
-    }
-
-    std::size_t Count() const noexcept {
-        return items_.size();
-    }
-
-    iterator begin() noexcept {
-        return items_.begin();
-    }
-
-    iterator end() noexcept {
-        return items_.end();
-    }
-
-    const_iterator begin() const noexcept {
-        return items_.begin();
-    }
-
-    const_iterator end() const noexcept {
-        return items_.end();
-    }
-
-    const_iterator cbegin() const noexcept {
-        return items_.cbegin();
-    }
-
-    const_iterator cend() const noexcept {
-        return items_.cend();
-    }
-
-private:
-    void ReplaceRange(const Range& replaced_range, T* const new_value) {
+    /*
+    Replaces the specified range in a sorted item list. It is shared by RangeMap and TreeRangeMap.
+    */
+    static void ReplaceRangeInItems(
+        ItemList& items,
+        Range replaced_range,
+        T* const new_value) {
 
         if (replaced_range.length == 0) {
             return;
@@ -261,8 +285,8 @@ private:
         bool has_merged_new_value{};
 
         //Loop over all items, to find insert position and modify existent ranges.
-        auto iterator = items_.begin();
-        while (iterator != items_.end()) {
+        auto iterator = items.begin();
+        while (iterator != items.end()) {
 
             const auto current_range = iterator->Range();
 
@@ -289,7 +313,7 @@ private:
             //The new range contains(or equals to) the current range, the current range should be
             //removed.
             if (replaced_range.Contains(current_range)) {
-                iterator = items_.erase(iterator);
+                iterator = items.erase(iterator);
                 continue;
             }
 
@@ -314,7 +338,7 @@ private:
                 };
 
                 ++iterator;
-                iterator = items_.insert(iterator, std::move(latter_item));
+                iterator = items.insert(iterator, std::move(latter_item));
                 break;
             }
 
@@ -346,51 +370,32 @@ private:
             if ((replaced_range.index < current_range.EndIndex()) &&
                 (replaced_range.EndIndex() >= current_range.EndIndex())) {
 
-                Range modified_range;
-                modified_range.index = current_range.index;
-
-                //If the values are equal, merge two ranges.
+                //If the values are equal, merge the current range into the new range, so that
+                //the following ranges can still be merged into it.
                 if (new_value && Equal{}(*new_value, iterator->Value())) {
-                    modified_range.length = replaced_range.EndIndex() - current_range.index;
-                }
-                //Otherwise narrow the current range.
-                else {
-                    modified_range.length = replaced_range.index - current_range.index;
+                    replaced_range = Range::FromIndexPair(
+                        current_range.index,
+                        replaced_range.EndIndex());
+                    iterator = items.erase(iterator);
+                    continue;
                 }
 
-                iterator->range_ = modified_range;
+                //Otherwise narrow the current range.
+                iterator->range_ = Range::FromIndexPair(current_range.index, replaced_range.index);
                 ++iterator;
                 continue;
             }
 
-            //The new range is right after the current range, modify the current range to contain
-            //the new range.
+            //The new range is right after the current range, merge the current range into the new
+            //range, so that the following ranges can still be merged into it.
             if (current_range.EndIndex() == replaced_range.index) {
                 if (new_value && Equal{}(*new_value, iterator->Value())) {
 
-                    iterator->range_.length += replaced_range.length;
-                    has_merged_new_value = true;
-
-                    //Merge other trailing continous ranges.
-                    auto remove_begin = iterator + 1;
-                    auto remove_end = remove_begin;
-                    while (remove_end != items_.end()) {
-
-                        if (remove_end->Range().index > iterator->Range().EndIndex() ||
-                            !Equal{}(remove_end->Value(), iterator->Value())) {
-                            break;
-                        }
-
-                        if (remove_end->Range().EndIndex() > iterator->Range().EndIndex()) {
-                            iterator->range_.length = 
-                                remove_end->Range().EndIndex() - iterator->Range().index;
-                        }
-
-                        ++remove_end;
-                    }
-                    items_.erase(remove_begin, remove_end);
-                    ++iterator;
-                    break;
+                    replaced_range = Range::FromIndexPair(
+                        current_range.index,
+                        replaced_range.EndIndex());
+                    iterator = items.erase(iterator);
+                    continue;
                 }
             }
 
@@ -399,7 +404,7 @@ private:
 
         //Insert the new item to the position found.
         if (new_value && !has_merged_new_value) {
-            items_.insert(iterator, Item{ replaced_range, std::move(*new_value) });
+            items.insert(iterator, Item{ replaced_range, std::move(*new_value) });
         }
     }
 
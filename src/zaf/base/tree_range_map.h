@@ -0,0 +1,598 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <zaf/base/range_map.h>
+
+namespace zaf {
+
+/**
+A map from ranges to values that has the same interface and behavior as `zaf::RangeMap<>`, but
+stores items in a balanced tree.
+
+@details
+    `zaf::RangeMap<>` stores items in a sorted vector, so modifying spans needs to shift the
+    indexes of all following items, which is O(n). This class stores items in a treap, and shifts
+    the indexes of following items lazily with an offset tag on subtree roots, so that inserting or
+    erasing spans, as well as looking up items, is O(log n) plus the number of items that intersect
+    with the modified range.
+
+    It is preferred when there may be a large number of items. For maps that usually have few
+    items, `zaf::RangeMap<>` has smaller overhead.
+
+    Iterators are bidirectional, and are invalidated after any modification to the map. Pending
+    offsets are pushed down to child nodes during lookup and iteration, so concurrent reading from
+    multiple threads is not safe even for const instances.
+*/
+template<typename T, typename Equal = std::equal_to<T>>
+class TreeRangeMap {
+private:
+    using Algorithm = RangeMap<T, Equal>;
+
+    class Node;
+
+    template<bool IsConst>
+    class IteratorBase {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename RangeMap<T, Equal>::Item;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+    public:
+        IteratorBase() noexcept = default;
+
+        //Allow converting from iterator to const_iterator.
+        template<bool OtherIsConst, typename = std::enable_if_t<IsConst || !OtherIsConst>>
+        IteratorBase(const IteratorBase<OtherIsConst>& other) noexcept :
+            node_(other.node_),
+            map_(other.map_) {
+
+        }
+
+        reference operator*() const noexcept {
+            return node_->item;
+        }
+
+        pointer operator->() const noexcept {
+            return &node_->item;
+        }
+
+        IteratorBase& operator++() noexcept {
+            node_ = TreeRangeMap::NextNode(node_);
+            return *this;
+        }
+
+        IteratorBase operator++(int) noexcept {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        IteratorBase& operator--() noexcept {
+            node_ = node_ ? TreeRangeMap::PreviousNode(node_) : map_->LastNode();
+            return *this;
+        }
+
+        IteratorBase operator--(int) noexcept {
+            auto result = *this;
+            --*this;
+            return result;
+        }
+
+        bool operator==(const IteratorBase& other) const noexcept {
+            return node_ == other.node_;
+        }
+
+        bool operator!=(const IteratorBase& other) const noexcept {
+            return node_ != other.node_;
+        }
+
+    private:
+        friend TreeRangeMap;
+
+        template<bool>
+        friend class IteratorBase;
+
+        IteratorBase(Node* node, const TreeRangeMap* map) noexcept : node_(node), map_(map) {
+
+        }
+
+        Node* node_{};
+        const TreeRangeMap* map_{};
+    };
+
+public:
+    using Item = typename RangeMap<T, Equal>::Item;
+    using ItemList = typename RangeMap<T, Equal>::ItemList;
+
+    using value_type = Item;
+    using iterator = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+
+public:
+    TreeRangeMap() = default;
+
+    TreeRangeMap(const TreeRangeMap& other) :
+        root_(CloneSubtree(other.root_, nullptr)),
+        count_(other.count_),
+        random_state_(other.random_state_) {
+
+    }
+
+    TreeRangeMap& operator=(const TreeRangeMap& other) {
+        if (this != &other) {
+            TreeRangeMap copy{ other };
+            Swap(copy);
+        }
+        return *this;
+    }
+
+    TreeRangeMap(TreeRangeMap&& other) noexcept {
+        Swap(other);
+    }
+
+    TreeRangeMap& operator=(TreeRangeMap&& other) noexcept {
+        if (this != &other) {
+            Clear();
+            Swap(other);
+        }
+        return *this;
+    }
+
+    ~TreeRangeMap() {
+        Clear();
+    }
+
+    void AddRange(const Range& added_range, T value) {
+        ReplaceRange(added_range, &value);
+    }
+
+    void RemoveRange(const Range& removed_range) {
+        ReplaceRange(removed_range, nullptr);
+    }
+
+    void InsertSpan(const Range& span_range) {
+        if (!span_range.IsEmpty()) {
+            ReplaceSpan(Range{ span_range.index, 0 }, span_range.length);
+        }
+    }
+
+    void EraseSpan(const Range& span_range) {
+        if (!span_range.IsEmpty()) {
+            ReplaceSpan(span_range, 0);
+        }
+    }
+
+    void ReplaceSpan(const Range& span_range, std::size_t new_length) {
+
+        //Split the tree into three parts: items before the span, items intersecting with the
+        //span, and items after the span.
+        Node* head{};
+        Node* rest{};
+        Split(root_, head, rest, [&span_range](const Item& item) {
+            return item.Range().EndIndex() <= span_range.index;
+        });
+
+        Node* middle{};
+        Node* tail{};
+        Split(rest, middle, tail, [&span_range](const Item& item) {
+            return item.Range().index < span_range.EndIndex();
+        });
+
+        //Items after the span are shifted lazily.
+        ApplyOffset(tail, new_length - span_range.length);
+
+        //Items intersecting with the span are modified in the same way as RangeMap.
+        Node* new_middle{};
+        try {
+            auto middle_items = ExtractItems(middle);
+            Algorithm::ReplaceSpanInItems(middle_items, span_range, new_length);
+            BuildSubtree(std::move(middle_items), new_middle);
+        }
+        catch (...) {
+            root_ = Merge(Merge(head, middle ? middle : new_middle), tail);
+            throw;
+        }
+
+        root_ = Merge(Merge(head, new_middle), tail);
+    }
+
+    void Clear() noexcept {
+        DeleteSubtree(root_);
+        root_ = nullptr;
+        count_ = 0;
+    }
+
+    iterator FindItemAtIndex(std::size_t index) noexcept {
+
+        auto node = LowerBound([index](const Item& item) {
+            return item.Range().EndIndex() <= index;
+        });
+
+        if (node && node->item.Range().Contains(index)) {
+            return iterator{ node, this };
+        }
+        return end();
+    }
+
+    const_iterator FindItemAtIndex(std::size_t index) const noexcept {
+        return const_cast<TreeRangeMap*>(this)->FindItemAtIndex(index);
+    }
+
+    iterator FindFirstItemIntersectsWithRange(const Range& range) noexcept {
+
+        auto node = LowerBound([&range](const Item& item) {
+            return item.Range().EndIndex() < range.index;
+        });
+
+        if (node && node->item.Range().Intersects(range)) {
+            return iterator{ node, this };
+        }
+        return end();
+    }
+
+    const_iterator FindFirstItemIntersectsWithRange(const Range& range) const noexcept {
+        return const_cast<TreeRangeMap*>(this)->FindFirstItemIntersectsWithRange(range);
+    }
+
+    bool IsEmpty() const noexcept {
+        return count_ == 0;
+    }
+
+    std::size_t Count() const noexcept {
+        return count_;
+    }
+
+    iterator begin() noexcept {
+        return iterator{ FirstNode(), this };
+    }
+
+    iterator end() noexcept {
+        return iterator{ nullptr, this };
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator{ FirstNode(), this };
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator{ nullptr, this };
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    class Node {
+    public:
+        Node(Item item, std::uint32_t priority) : item(std::move(item)), priority(priority) {
+
+        }
+
+        Item item;
+        std::uint32_t priority{};
+
+        //The offset that should be added to the indexes of all items in child subtrees. The
+        //offset has already been applied to the item of this node.
+        std::size_t pending_offset{};
+
+        Node* parent{};
+        Node* left{};
+        Node* right{};
+    };
+
+private:
+    void ReplaceRange(const Range& replaced_range, T* const new_value) {
+
+        if (replaced_range.length == 0) {
+            return;
+        }
+
+        //Split the tree into three parts: items before the range, items intersecting with or
+        //adjacent to the range, and items after the range. Items in the first and the last parts
+        //are not affected.
+        Node* head{};
+        Node* rest{};
+        Split(root_, head, rest, [&replaced_range](const Item& item) {
+            return item.Range().EndIndex() < replaced_range.index;
+        });
+
+        Node* middle{};
+        Node* tail{};
+        Split(rest, middle, tail, [&replaced_range](const Item& item) {
+            return item.Range().index <= replaced_range.EndIndex();
+        });
+
+        Node* new_middle{};
+        try {
+            auto middle_items = ExtractItems(middle);
+            Algorithm::ReplaceRangeInItems(middle_items, replaced_range, new_value);
+            BuildSubtree(std::move(middle_items), new_middle);
+        }
+        catch (...) {
+            //Keep the map valid, items in the middle part might be lost.
+            root_ = Merge(Merge(head, middle ? middle : new_middle), tail);
+            throw;
+        }
+
+        root_ = Merge(Merge(head, new_middle), tail);
+    }
+
+    template<typename P>
+    Node* LowerBound(P is_before) const noexcept {
+
+        Node* result{};
+        auto node = root_;
+        while (node) {
+            PushDown(node);
+            if (is_before(node->item)) {
+                node = node->right;
+            }
+            else {
+                result = node;
+                node = node->left;
+            }
+        }
+        return result;
+    }
+
+    Node* FirstNode() const noexcept {
+        return root_ ? LeftmostNode(root_) : nullptr;
+    }
+
+    Node* LastNode() const noexcept {
+        return root_ ? RightmostNode(root_) : nullptr;
+    }
+
+    static Node* LeftmostNode(Node* node) noexcept {
+        while (node->left) {
+            PushDown(node);
+            node = node->left;
+        }
+        return node;
+    }
+
+    static Node* RightmostNode(Node* node) noexcept {
+        while (node->right) {
+            PushDown(node);
+            node = node->right;
+        }
+        return node;
+    }
+
+    //Pending offsets of all ancestors of the node must have been pushed down.
+    static Node* NextNode(Node* node) noexcept {
+
+        if (node->right) {
+            PushDown(node);
+            return LeftmostNode(node->right);
+        }
+
+        while (node->parent && node->parent->right == node) {
+            node = node->parent;
+        }
+        return node->parent;
+    }
+
+    //Pending offsets of all ancestors of the node must have been pushed down.
+    static Node* PreviousNode(Node* node) noexcept {
+
+        if (node->left) {
+            PushDown(node);
+            return RightmostNode(node->left);
+        }
+
+        while (node->parent && node->parent->left == node) {
+            node = node->parent;
+        }
+        return node->parent;
+    }
+
+    static void ApplyOffset(Node* node, std::size_t offset) noexcept {
+        //The offset may be a wrapped negative value, which is intended.
+        if (node) {
+            node->item.range_.index += offset;
+            node->pending_offset += offset;
+        }
+    }
+
+    static void PushDown(Node* node) noexcept {
+        if (node->pending_offset != 0) {
+            ApplyOffset(node->left, node->pending_offset);
+            ApplyOffset(node->right, node->pending_offset);
+            node->pending_offset = 0;
+        }
+    }
+
+    /*
+    Splits a subtree into two subtrees, the left one contains the leading items that satisfy the
+    predicate, and the right one contains the remaining items.
+    */
+    template<typename P>
+    static void Split(Node* node, Node*& left, Node*& right, const P& goes_left) noexcept {
+        SplitRecursively(node, left, right, goes_left);
+        if (left) {
+            left->parent = nullptr;
+        }
+        if (right) {
+            right->parent = nullptr;
+        }
+    }
+
+    template<typename P>
+    static void SplitRecursively(
+        Node* node,
+        Node*& left,
+        Node*& right,
+        const P& goes_left) noexcept {
+
+        if (!node) {
+            left = nullptr;
+            right = nullptr;
+            return;
+        }
+
+        PushDown(node);
+
+        if (goes_left(node->item)) {
+            Node* right_of_left{};
+            SplitRecursively(node->right, right_of_left, right, goes_left);
+            SetRight(node, right_of_left);
+            left = node;
+        }
+        else {
+            Node* left_of_right{};
+            SplitRecursively(node->left, left, left_of_right, goes_left);
+            SetLeft(node, left_of_right);
+            right = node;
+        }
+    }
+
+    //All items in the left subtree must be before those in the right subtree.
+    static Node* Merge(Node* left, Node* right) noexcept {
+        auto result = MergeRecursively(left, right);
+        if (result) {
+            result->parent = nullptr;
+        }
+        return result;
+    }
+
+    static Node* MergeRecursively(Node* left, Node* right) noexcept {
+
+        if (!left) {
+            return right;
+        }
+
+        if (!right) {
+            return left;
+        }
+
+        if (left->priority > right->priority) {
+            PushDown(left);
+            SetRight(left, MergeRecursively(left->right, right));
+            return left;
+        }
+
+        PushDown(right);
+        SetLeft(right, MergeRecursively(left, right->left));
+        return right;
+    }
+
+    static void SetLeft(Node* node, Node* child) noexcept {
+        node->left = child;
+        if (child) {
+            child->parent = node;
+        }
+    }
+
+    static void SetRight(Node* node, Node* child) noexcept {
+        node->right = child;
+        if (child) {
+            child->parent = node;
+        }
+    }
+
+    /*
+    Moves items out of a subtree in order, and deletes the subtree. The subtree is set to null 
+    after extracting.
+    */
+    ItemList ExtractItems(Node*& node) {
+
+        ItemList items;
+        items.reserve(CountNodes(node));
+
+        ExtractItemsRecursively(node, items);
+        node = nullptr;
+        count_ -= items.size();
+        return items;
+    }
+
+    static void ExtractItemsRecursively(Node* node, ItemList& items) noexcept {
+
+        if (!node) {
+            return;
+        }
+
+        PushDown(node);
+        ExtractItemsRecursively(node->left, items);
+        items.push_back(std::move(node->item));
+        ExtractItemsRecursively(node->right, items);
+        delete node;
+    }
+
+    static std::size_t CountNodes(const Node* node) noexcept {
+        return node ? CountNodes(node->left) + CountNodes(node->right) + 1 : 0;
+    }
+
+    /*
+    Builds items into a subtree. The result contains the items that have been built, even if an 
+    exception is thrown.
+    */
+    void BuildSubtree(ItemList&& items, Node*& result) {
+        for (auto& each_item : items) {
+            auto new_node = new Node{ std::move(each_item), GeneratePriority() };
+            result = Merge(result, new_node);
+            ++count_;
+        }
+    }
+
+    static Node* CloneSubtree(const Node* node, Node* parent) {
+
+        if (!node) {
+            return nullptr;
+        }
+
+        auto result = new Node{ node->item, node->priority };
+        result->pending_offset = node->pending_offset;
+        result->parent = parent;
+
+        try {
+            result->left = CloneSubtree(node->left, result);
+            result->right = CloneSubtree(node->right, result);
+        }
+        catch (...) {
+            DeleteSubtree(result);
+            throw;
+        }
+        return result;
+    }
+
+    static void DeleteSubtree(Node* node) noexcept {
+        if (node) {
+            DeleteSubtree(node->left);
+            DeleteSubtree(node->right);
+            delete node;
+        }
+    }
+
+    std::uint32_t GeneratePriority() noexcept {
+        //xorshift32
+        random_state_ ^= random_state_ << 13;
+        random_state_ ^= random_state_ >> 17;
+        random_state_ ^= random_state_ << 5;
+        return random_state_;
+    }
+
+    void Swap(TreeRangeMap& other) noexcept {
+        std::swap(root_, other.root_);
+        std::swap(count_, other.count_);
+        std::swap(random_state_, other.random_state_);
+    }
+
+private:
+    Node* root_{};
+    std::size_t count_{};
+    std::uint32_t random_state_{ 2463534242 };
+};
+
+}
\ No newline at end of file
@@ -1,11 +1,13 @@
 #include <zaf/control/control.h>
 #include <algorithm>
+#include <utility>
 #include <zaf/application.h>
 #include <zaf/base/as.h>
 #include <zaf/base/auto_reset.h>
 #include <zaf/base/define.h>
 #include <zaf/base/error/precondition_error.h>
 #include <zaf/control/internal/cached_painting.h>
+#include <zaf/control/internal/child_spatial_index.h>
 #include <zaf/control/internal/control_facets/control_geometry_facet.h>
 #include <zaf/control/internal/control_updating.h>
 #include <zaf/control/internal/image_box/image_drawing.h>
@@ -391,6 +393,7 @@ std::shared_ptr<Control> Control::Parent() const {
 
 
 bool Control::IsMouseOver() const {
+    internal::StyleDependencyTracker::RecordRead(*this, internal::StyleInput::IsMouseOver);
     return is_mouse_over_;
 }
 
@@ -406,6 +409,7 @@ void Control::SetCanFocus(bool can_focused) {
 
 
 bool Control::IsFocused() const {
+    internal::StyleDependencyTracker::RecordRead(*this, internal::StyleInput::IsFocused);
     return is_focused_;
 }
 
@@ -486,8 +490,8 @@ void Control::EndUpdate() {
         RequestLayout();
     }
 
-    if (!update_state->need_repainted_rect.IsEmpty()) {
-        NeedRepaintRect(update_state->need_repainted_rect);
+    for (const auto& each_rect : update_state->need_repainted_region.Rects()) {
+        NeedRepaintRect(each_rect);
     }
 
     if (update_state->need_resize) {
@@ -497,7 +501,37 @@ void Control::EndUpdate() {
 
 
 void Control::NeedUpdateStyle() {
+    NeedUpdateStyle(internal::StyleInput::Unknown);
+}
+
+
+void Control::NeedUpdateStyle(internal::StyleInput changed_input) {
     need_update_style_ = true;
+    changed_style_inputs_ |= changed_input;
+}
+
+
+void Control::OnParentStyleInputsChanged(internal::StyleInput changed_inputs) {
+
+    if (changed_inputs == internal::StyleInput::None) {
+        return;
+    }
+
+    bool depends_on_changed_inputs =
+        (changed_inputs & (style_dependencies_ | internal::StyleInput::Unknown)) !=
+        internal::StyleInput::None;
+
+    if (need_update_style_ || depends_on_changed_inputs) {
+        NeedUpdateStyle(changed_inputs);
+        return;
+    }
+
+    //Children may read the changed inputs even if this control doesn't, so the inputs are kept
+    //to be passed to them.
+    if (changed_style_inputs_ == internal::StyleInput::None && is_visible_) {
+        ++internal::StyleDependencyTracker::Statistics().skipped_count;
+    }
+    changed_style_inputs_ |= changed_inputs;
 }
 
 
@@ -523,30 +557,38 @@ void Control::Repaint(Canvas& canvas, const zaf::Rect& dirty_rect) {
     //Make sure the control repaints only if it is visible.
     ZAF_EXPECT(IsVisible());
 
-    bool need_update_style = HandleUpdateStyle();
+    auto changed_style_inputs = HandleUpdateStyle();
 
     if (IsCachedPaintingEnabled()) {
         RepaintUsingCachedPainting(canvas, dirty_rect);
     }
     else {
-        RepaintControl(canvas, dirty_rect, false, need_update_style);
+        RepaintControl(canvas, dirty_rect, false, changed_style_inputs);
     }
 }
 
 
-bool Control::HandleUpdateStyle() {
+internal::StyleInput Control::HandleUpdateStyle() {
 
+    auto changed_style_inputs = std::exchange(changed_style_inputs_, internal::StyleInput::None);
     if (!need_update_style_) {
-        return false;
+        return changed_style_inputs;
     }
 
     need_update_style_ = false;
 
     auto auto_reset = MakeAutoReset(is_updating_style_, true);
 
+    //Record states of other controls read by the style, so that later changes of ancestors
+    //update the style only if it reads them.
+    internal::StyleDependencyTracker dependency_tracker{ *this };
+
     UpdateStyle();
     OnStyleUpdate(StyleUpdateInfo{ shared_from_this() });
-    return true;
+
+    style_dependencies_ = dependency_tracker.Dependencies();
+    ++internal::StyleDependencyTracker::Statistics().evaluated_count;
+    return changed_style_inputs;
 }
 
 
@@ -584,7 +626,7 @@ void Control::RepaintUsingCachedPainting(Canvas& canvas, const zaf::Rect& dirty_
                 cached_painting_canvas,
                 calculate_result.actual_dirty_rect, 
                 true, 
-                false);
+                internal::StyleInput::None);
         }
         cached_renderer_.EndDraw();
 
@@ -604,18 +646,21 @@ void Control::RepaintControl(
     Canvas& canvas, 
     const zaf::Rect& dirty_rect,
     bool need_clear,
-    bool update_style) {
+    internal::StyleInput changed_style_inputs) {
 
     if (need_clear) {
         canvas.Clear();
     }
     Paint(canvas, dirty_rect);
 
-    RepaintChildren(canvas, dirty_rect, update_style);
+    RepaintChildren(canvas, dirty_rect, changed_style_inputs);
 }
 
 
-void Control::RepaintChildren(Canvas& canvas, const zaf::Rect& dirty_rect, bool update_style) {
+void Control::RepaintChildren(
+    Canvas& canvas,
+    const zaf::Rect& dirty_rect,
+    internal::StyleInput changed_style_inputs) {
 
     //No need to repaint if there is no child.
     if (children_.empty()) {
@@ -628,36 +673,68 @@ void Control::RepaintChildren(Canvas& canvas, const zaf::Rect& dirty_rect, bool
         return;
     }
 
-    for (const auto& child : children_) {
+    if (!child_spatial_index_) {
 
-        //Don't paint the child if it is not visible.
-        if (!child->IsVisible()) {
-            continue;
+        for (const auto& child : children_) {
+
+            //Children should update their styles if they read the changed inputs. Invisible
+            //children keep the inputs until they become visible.
+            child->OnParentStyleInputsChanged(changed_style_inputs);
+
+            //Don't paint the child if it is not visible.
+            if (!child->IsVisible()) {
+                continue;
+            }
+
+            RepaintChild(canvas, *child, content_rect, dirty_rect);
         }
+        return;
+    }
 
-        //Children should update their styles if parent needs update as well.
-        if (update_style) {
-            child->NeedUpdateStyle();
+    if (changed_style_inputs != internal::StyleInput::None) {
+        for (const auto& child : children_) {
+            child->OnParentStyleInputsChanged(changed_style_inputs);
         }
+    }
 
-        zaf::Rect child_rect = child->Rect();
-        child_rect.position.AddOffset(content_rect.position);
+    //Only children that may intersect with the dirty rect are visited, in their original order.
+    auto dirty_rect_in_content = zaf::Rect::Intersect(dirty_rect, content_rect);
+    dirty_rect_in_content.position.SubtractOffset(content_rect.position);
 
-        //No need to paint the child if its rect not dirty.
-        zaf::Rect child_dirty_rect = zaf::Rect::Intersect(child_rect, dirty_rect);
-        if (child_dirty_rect.IsEmpty()) {
-            continue;
-        }
+    const auto& spatial_index = GetValidChildSpatialIndex();
+    for (auto index : spatial_index.FindChildrenInRect(dirty_rect_in_content)) {
 
-        child_dirty_rect.Intersect(content_rect);
-        if (child_dirty_rect.IsEmpty()) {
-            continue;
+        const auto& child = children_[index];
+        if (child->IsVisible()) {
+            RepaintChild(canvas, *child, content_rect, dirty_rect);
         }
+    }
+}
 
-        auto layer_guard = canvas.PushRegion(child_rect, child_dirty_rect);
-        child_dirty_rect.position.SubtractOffset(child_rect.position);
-        child->Repaint(canvas, child_dirty_rect);
+
+void Control::RepaintChild(
+    Canvas& canvas,
+    Control& child,
+    const zaf::Rect& content_rect,
+    const zaf::Rect& dirty_rect) {
+
+    zaf::Rect child_rect = child.Rect();
+    child_rect.position.AddOffset(content_rect.position);
+
+    //No need to paint the child if its rect not dirty.
+    zaf::Rect child_dirty_rect = zaf::Rect::Intersect(child_rect, dirty_rect);
+    if (child_dirty_rect.IsEmpty()) {
+        return;
+    }
+
+    child_dirty_rect.Intersect(content_rect);
+    if (child_dirty_rect.IsEmpty()) {
+        return;
     }
+
+    auto layer_guard = canvas.PushRegion(child_rect, child_dirty_rect);
+    child_dirty_rect.position.SubtractOffset(child_rect.position);
+    child.Repaint(canvas, child_dirty_rect);
 }
 
 
@@ -742,7 +819,7 @@ void Control::NeedRepaintRect(const zaf::Rect& rect) {
     }
 
     if (update_state_) {
-        update_state_->need_repainted_rect.Union(rect);
+        update_state_->need_repainted_region.Add(rect);
         return;
     }
 
@@ -805,6 +882,10 @@ void Control::OnChildRectChanged(
     const std::shared_ptr<Control>& child,
     const zaf::Rect& previous_rect) {
 
+    if (child_spatial_index_) {
+        child_spatial_index_->UpdateChild(*child);
+    }
+
     const zaf::Rect& new_rect = child->Rect();
 
     if (new_rect.HasIntersection(previous_rect)) {
@@ -1052,6 +1133,7 @@ void Control::AddChildAtIndex(const std::shared_ptr<Control>& child, std::size_t
     }
 
     children_.insert(std::next(children_.begin(), index), child);
+    InvalidateChildSpatialIndex();
     child->SetParent(shared_from_this());
 
     RequestLayout();
@@ -1126,6 +1208,7 @@ void Control::InnerRemoveChild(const std::shared_ptr<Control>& child, bool set_p
 
     auto removed_index = std::distance(children_.begin(), removed_iterator);
     children_.erase(removed_iterator);
+    InvalidateChildSpatialIndex();
 
     if (set_parent_to_null) {
         child->SetParent(nullptr);
@@ -1169,6 +1252,7 @@ void Control::RemoveAllChildren() {
     }
 
     children_.clear();
+    InvalidateChildSpatialIndex();
     NeedRepaint();
 }
 
@@ -1205,20 +1289,18 @@ std::shared_ptr<Control> Control::InnerFindChildAtPosition(
     content_rect.position.x = 0;
     content_rect.position.y = 0;
 
-    for (auto iterator = children_.rbegin(); iterator != children_.rend(); ++iterator) {
-
-        const auto& child = *iterator;
+    auto is_child_at_position = [&](const Control& child) {
 
-        if (!child->IsVisible()) {
-            continue;
+        if (!child.IsVisible()) {
+            return false;
         }
 
-        zaf::Rect child_rect = child->Rect();
+        zaf::Rect child_rect = child.Rect();
         child_rect.Intersect(content_rect);
+        return child_rect.Contains(position_in_content);
+    };
 
-        if (!child_rect.Contains(position_in_content)) {
-            continue;
-        }
+    auto find_in_child = [&](const std::shared_ptr<Control>& child) {
 
         if (!recursively) {
             return child;
@@ -1233,12 +1315,51 @@ std::shared_ptr<Control> Control::InnerFindChildAtPosition(
         }
 
         return child;
+    };
+
+    if (child_spatial_index_) {
+
+        //Candidates are in ascending order, the topmost child is the last one.
+        auto candidates = GetValidChildSpatialIndex().FindChildrenAtPosition(position_in_content);
+        for (auto iterator = candidates.rbegin(); iterator != candidates.rend(); ++iterator) {
+
+            const auto& child = children_[*iterator];
+            if (is_child_at_position(*child)) {
+                return find_in_child(child);
+            }
+        }
+        return nullptr;
+    }
+
+    for (auto iterator = children_.rbegin(); iterator != children_.rend(); ++iterator) {
+
+        const auto& child = *iterator;
+        if (is_child_at_position(*child)) {
+            return find_in_child(child);
+        }
     }
 
     return nullptr;
 }
 
 
+const internal::ChildSpatialIndex& Control::GetValidChildSpatialIndex() const {
+
+    if (!child_spatial_index_->IsValid()) {
+        child_spatial_index_->Rebuild(children_);
+    }
+    return *child_spatial_index_;
+}
+
+
+void Control::InvalidateChildSpatialIndex() noexcept {
+
+    if (child_spatial_index_) {
+        child_spatial_index_->Invalidate();
+    }
+}
+
+
 bool Control::IsParentOf(const Control& control) const {
     return control.Parent().get() == this;
 }
@@ -1303,6 +1424,7 @@ bool Control::IsVisibleInContext() const {
 
 
 bool Control::IsVisible() const {
+    internal::StyleDependencyTracker::RecordRead(*this, internal::StyleInput::IsVisible);
     return is_visible_;
 }
 
@@ -1313,7 +1435,11 @@ void Control::SetIsVisible(bool is_visible) {
         return;
     }
 
-    SetInteractiveProperty(is_visible, is_visible_, &Control::OnIsVisibleChanged);
+    SetInteractiveProperty(
+        is_visible,
+        is_visible_,
+        internal::StyleInput::IsVisible,
+        &Control::OnIsVisibleChanged);
 
     //Notify parent to re-layout.
     auto parent = Parent();
@@ -1351,6 +1477,7 @@ bool Control::IsEnabledInContext() const {
 
 
 bool Control::IsEnabled() const {
+    internal::StyleDependencyTracker::RecordRead(*this, internal::StyleInput::IsEnabled);
     return is_enabled_;
 }
 
@@ -1361,7 +1488,11 @@ void Control::SetIsEnabled(bool is_enabled) {
         return;
     }
 
-    SetInteractiveProperty(is_enabled, is_enabled_, &Control::OnIsEnabledChanged);
+    SetInteractiveProperty(
+        is_enabled,
+        is_enabled_,
+        internal::StyleInput::IsEnabled,
+        &Control::OnIsEnabledChanged);
 }
 
 
@@ -1378,6 +1509,7 @@ rx::Observable<IsEnabledChangedInfo> Control::IsEnabledChangedEvent() const {
 void Control::SetInteractiveProperty(
     bool new_value, 
     bool& property_value, 
+    internal::StyleInput style_input,
     void(Control::*notification)()) {
 
     if (property_value == new_value) {
@@ -1401,7 +1533,7 @@ void Control::SetInteractiveProperty(
     }
 
     property_value = new_value;
-    NeedUpdateStyle();
+    NeedUpdateStyle(style_input);
     NeedRepaint();
 
     if (notification != nullptr) {
@@ -1427,6 +1559,7 @@ bool Control::IsSelectedInContext() const {
 
 
 bool Control::IsSelected() const {
+    internal::StyleDependencyTracker::RecordRead(*this, internal::StyleInput::IsSelected);
     return is_selected_;
 }
 
@@ -1438,7 +1571,7 @@ void Control::SetIsSelected(bool is_selected) {
     }
 
     is_selected_ = is_selected;
-    NeedUpdateStyle();
+    NeedUpdateStyle(internal::StyleInput::IsSelected);
     NeedRepaint();
 
     OnIsSelectedChanged();
@@ -1457,7 +1590,7 @@ rx::Observable<IsSelectedChangedInfo> Control::IsSelectedChangedEvent() const {
 
 void Control::SetIsMouseOverByWindow(bool is_mouse_over) {
     is_mouse_over_ = is_mouse_over;
-    NeedUpdateStyle();
+    NeedUpdateStyle(internal::StyleInput::IsMouseOver);
     NeedRepaint();
 }
 
@@ -1527,7 +1660,7 @@ void Control::SetIsFocusedByWindow(bool is_focused) {
 
     is_focused_ = is_focused;
 
-    NeedUpdateStyle();
+    NeedUpdateStyle(internal::StyleInput::IsFocused);
     NeedRepaint();
 }
 
@@ -1578,6 +1711,27 @@ void Control::SetIsCachedPaintingEnabled(bool value) {
 }
 
 
+bool Control::IsSpatialIndexEnabled() const noexcept {
+    return !!child_spatial_index_;
+}
+
+
+void Control::SetIsSpatialIndexEnabled(bool value) {
+
+    if (IsSpatialIndexEnabled() == value) {
+        return;
+    }
+
+    if (value) {
+        //The index is built lazily on first use.
+        child_spatial_index_ = std::make_unique<internal::ChildSpatialIndex>();
+    }
+    else {
+        child_spatial_index_.reset();
+    }
+}
+
+
 void Control::ReleaseCachedPaintingRenderer() {
     cached_renderer_ = {};
     valid_cached_renderer_rect_ = {};
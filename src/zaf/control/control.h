@@ -29,6 +29,7 @@
 #include <zaf/control/image_picker.h>
 #include <zaf/control/layout/layouter.h>
 #include <zaf/control/control_update_guard.h>
+#include <zaf/control/internal/style_dependency_tracker.h>
 #include <zaf/control/style/color_picker.h>
 #include <zaf/graphic/d2d/bitmap_renderer.h>
 #include <zaf/graphic/color.h>
@@ -40,6 +41,7 @@
 #include <zaf/rx/disposable_host.h>
 
 namespace zaf::internal {
+class ChildSpatialIndex;
 class ControlEventInvokerBinder;
 class ControlGeometryFacet;
 class ControlUpdateLock;
@@ -852,6 +854,19 @@ public:
 
     void SetIsCachedPaintingEnabled(bool value);
 
+    /**
+    Indicates whether children are indexed by their rects.
+
+    @details
+        The spatial index speeds up finding children at a position and choosing children to
+        repaint, which is beneficial for controls having a large number of children, such as grids
+        of tiles. It is disabled by default, as it costs extra memory and has to be rebuilt once
+        children are added or removed.
+    */
+    bool IsSpatialIndexEnabled() const noexcept;
+
+    void SetIsSpatialIndexEnabled(bool value);
+
     bool CanDoubleClick() const;
     void SetCanDoubleClick(bool can_double_click);
 
@@ -910,6 +925,12 @@ public:
      */
     virtual bool AcceptKeyMessage(const KeyMessage& message);
 
+    /**
+     Requires the control to update its style before next painting.
+
+     As the change that causes the update is unknown, all descendants update their styles as well
+     once they are painted.
+     */
     void NeedUpdateStyle();
 
     /**
@@ -1240,14 +1261,22 @@ private:
         The rect that needs to be repainted, in the control's coordinate space.
     */
     void Repaint(Canvas& canvas, const zaf::Rect& dirty_rect);
-    bool HandleUpdateStyle();
+    internal::StyleInput HandleUpdateStyle();
     void RepaintUsingCachedPainting(Canvas& canvas, const zaf::Rect& dirty_rect);
     void RepaintControl(
         Canvas& canvas,
         const zaf::Rect& dirty_rect,
         bool need_clear,
-        bool update_style);
-    void RepaintChildren(Canvas& canvas, const zaf::Rect& dirty_rect, bool update_style);
+        internal::StyleInput changed_style_inputs);
+    void RepaintChildren(
+        Canvas& canvas,
+        const zaf::Rect& dirty_rect,
+        internal::StyleInput changed_style_inputs);
+    void RepaintChild(
+        Canvas& canvas,
+        Control& child,
+        const zaf::Rect& content_rect,
+        const zaf::Rect& dirty_rect);
     void RecalculateCachedPaintingRect(const zaf::Rect& repaint_rect);
     void ReleaseCachedPaintingRenderer();
     void DrawBackgroundImage(Canvas& canvas, const zaf::Rect& background_rect) const;
@@ -1264,9 +1293,24 @@ private:
         const Point& position, 
         bool recursively) const;
 
+    const internal::ChildSpatialIndex& GetValidChildSpatialIndex() const;
+    void InvalidateChildSpatialIndex() noexcept;
+
     void RequestLayout(const zaf::Size& previous_size);
 
-    void SetInteractiveProperty(bool new_value, bool& property_value, void(Control::*notification)());
+    void SetInteractiveProperty(
+        bool new_value,
+        bool& property_value,
+        internal::StyleInput style_input,
+        void(Control::*notification)());
+
+    void NeedUpdateStyle(internal::StyleInput changed_input);
+
+    /**
+     Called when style inputs of the parent have changed. The style is updated only if it reads
+     the changed inputs, otherwise the inputs are just passed to children.
+     */
+    void OnParentStyleInputsChanged(internal::StyleInput changed_inputs);
 
     bool HandleDoubleClickOnMouseDown(const Point& position);
 
@@ -1282,12 +1326,22 @@ private:
     std::weak_ptr<Control> parent_;
     std::vector<std::shared_ptr<Control>> children_;
 
+    //Not null if the spatial index is enabled.
+    std::unique_ptr<internal::ChildSpatialIndex> child_spatial_index_;
+
     std::weak_ptr<internal::ControlUpdateLock> update_lock_;
     std::unique_ptr<internal::ControlUpdateState> update_state_;
 
     bool need_update_style_{};
     bool is_updating_style_{};
 
+    //Inputs that have changed since the last style update, which are passed to children.
+    internal::StyleInput changed_style_inputs_{ internal::StyleInput::None };
+
+    //Inputs of other controls that were read during the last style update. All inputs are
+    //assumed before the first style update.
+    internal::StyleInput style_dependencies_{ internal::StyleInput::All };
+
     bool is_cached_painting_enabled_{};
     d2d::BitmapRenderer cached_renderer_;
     zaf::Rect valid_cached_renderer_rect_;
@@ -0,0 +1,235 @@
+#include <zaf/control/internal/child_spatial_index.h>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <zaf/control/control.h>
+
+namespace zaf::internal {
+namespace {
+
+//A child which spans more cells than this count is treated as a large child.
+constexpr std::size_t MaxCellCountPerChild = 64;
+
+//Limits cell coordinates so that they fit in 32-bit integers.
+constexpr float MaxCellCoordinate = 1e9f;
+
+}
+
+void ChildSpatialIndex::Invalidate() noexcept {
+    is_valid_ = false;
+}
+
+
+void ChildSpatialIndex::Rebuild(const std::vector<std::shared_ptr<Control>>& children) {
+
+    child_indexes_.clear();
+    child_rects_.clear();
+    cells_.clear();
+    large_children_.clear();
+
+    child_indexes_.reserve(children.size());
+    child_rects_.reserve(children.size());
+
+    //Use twice the average child extent as the cell size, so that most children span no more
+    //than four cells.
+    float total_extent{};
+    std::size_t sized_child_count{};
+
+    for (std::size_t index = 0; index < children.size(); ++index) {
+
+        const auto& child = children[index];
+        child_indexes_[child.get()] = index;
+
+        const auto& rect = child->Rect();
+        child_rects_.push_back(rect);
+
+        auto extent = (std::max)(rect.size.width, rect.size.height);
+        if (extent > 0 && std::isfinite(extent)) {
+            total_extent += extent;
+            ++sized_child_count;
+        }
+    }
+
+    cell_size_ = 1;
+    if (sized_child_count > 0) {
+        cell_size_ = (std::max)(total_extent / sized_child_count * 2, 1.f);
+    }
+
+    for (std::size_t index = 0; index < child_rects_.size(); ++index) {
+        AddChildToCells(index, child_rects_[index]);
+    }
+
+    is_valid_ = true;
+}
+
+
+void ChildSpatialIndex::UpdateChild(const Control& child) {
+
+    if (!is_valid_) {
+        return;
+    }
+
+    auto iterator = child_indexes_.find(&child);
+    if (iterator == child_indexes_.end()) {
+        return;
+    }
+
+    auto index = iterator->second;
+    const auto& new_rect = child.Rect();
+
+    auto& rect = child_rects_[index];
+    if (rect == new_rect) {
+        return;
+    }
+
+    RemoveChildFromCells(index, rect);
+    rect = new_rect;
+    AddChildToCells(index, rect);
+}
+
+
+std::vector<std::size_t> ChildSpatialIndex::FindChildrenInRect(const zaf::Rect& rect) const {
+
+    std::vector<std::size_t> result;
+
+    auto range = GetCellRange(rect);
+
+    //If the rect covers more cells than those having children, visiting cells one by one is slower
+    //than returning all children.
+    if (!range || range->CellCount() > cells_.size()) {
+        result.resize(child_rects_.size());
+        std::iota(result.begin(), result.end(), std::size_t{});
+        return result;
+    }
+
+    CollectChildrenInCells(*range, result);
+    return result;
+}
+
+
+std::vector<std::size_t> ChildSpatialIndex::FindChildrenAtPosition(const Point& position) const {
+
+    std::vector<std::size_t> result;
+
+    auto range = GetCellRange(zaf::Rect{ position, zaf::Size{} });
+    if (range) {
+        CollectChildrenInCells(*range, result);
+    }
+    else {
+        result.resize(child_rects_.size());
+        std::iota(result.begin(), result.end(), std::size_t{});
+    }
+    return result;
+}
+
+
+std::uint64_t ChildSpatialIndex::MakeCellKey(std::int32_t column, std::int32_t row) noexcept {
+    return
+        (static_cast<std::uint64_t>(static_cast<std::uint32_t>(column)) << 32) |
+        static_cast<std::uint32_t>(row);
+}
+
+
+std::optional<ChildSpatialIndex::CellRange> ChildSpatialIndex::GetCellRange(
+    const zaf::Rect& rect) const noexcept {
+
+    float left = rect.position.x;
+    float top = rect.position.y;
+    float right = rect.position.x + rect.size.width;
+    float bottom = rect.position.y + rect.size.height;
+
+    if (!std::isfinite(left) ||
+        !std::isfinite(top) ||
+        !std::isfinite(right) ||
+        !std::isfinite(bottom)) {
+        return std::nullopt;
+    }
+
+    auto to_cell = [this](float value) {
+        auto cell = std::floor(value / cell_size_);
+        return static_cast<std::int32_t>(
+            std::clamp(cell, -MaxCellCoordinate, MaxCellCoordinate));
+    };
+
+    //The right and bottom edges are included, as an extra cell doesn't break the correctness but
+    //a missing one does.
+    CellRange result;
+    result.left = to_cell((std::min)(left, right));
+    result.top = to_cell((std::min)(top, bottom));
+    result.right = to_cell((std::max)(left, right));
+    result.bottom = to_cell((std::max)(top, bottom));
+    return result;
+}
+
+
+void ChildSpatialIndex::AddChildToCells(std::size_t index, const zaf::Rect& rect) {
+
+    auto range = GetCellRange(rect);
+    if (!range || range->CellCount() > MaxCellCountPerChild) {
+        large_children_.push_back(index);
+        return;
+    }
+
+    for (auto row = range->top; row <= range->bottom; ++row) {
+        for (auto column = range->left; column <= range->right; ++column) {
+            cells_[MakeCellKey(column, row)].push_back(index);
+        }
+    }
+}
+
+
+void ChildSpatialIndex::RemoveChildFromCells(std::size_t index, const zaf::Rect& rect) {
+
+    auto remove_index = [index](std::vector<std::size_t>& indexes) {
+        auto iterator = std::find(indexes.begin(), indexes.end(), index);
+        if (iterator != indexes.end()) {
+            *iterator = indexes.back();
+            indexes.pop_back();
+        }
+    };
+
+    auto range = GetCellRange(rect);
+    if (!range || range->CellCount() > MaxCellCountPerChild) {
+        remove_index(large_children_);
+        return;
+    }
+
+    for (auto row = range->top; row <= range->bottom; ++row) {
+        for (auto column = range->left; column <= range->right; ++column) {
+
+            auto iterator = cells_.find(MakeCellKey(column, row));
+            if (iterator == cells_.end()) {
+                continue;
+            }
+
+            remove_index(iterator->second);
+            if (iterator->second.empty()) {
+                cells_.erase(iterator);
+            }
+        }
+    }
+}
+
+
+void ChildSpatialIndex::CollectChildrenInCells(
+    const CellRange& range,
+    std::vector<std::size_t>& result) const {
+
+    for (auto row = range.top; row <= range.bottom; ++row) {
+        for (auto column = range.left; column <= range.right; ++column) {
+
+            auto iterator = cells_.find(MakeCellKey(column, row));
+            if (iterator != cells_.end()) {
+                result.insert(result.end(), iterator->second.begin(), iterator->second.end());
+            }
+        }
+    }
+
+    result.insert(result.end(), large_children_.begin(), large_children_.end());
+
+    //A child spanning several cells is collected more than once.
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <zaf/base/non_copyable.h>
+#include <zaf/graphic/rect.h>
+
+namespace zaf {
+class Control;
+}
+
+namespace zaf::internal {
+
+/**
+A uniform grid of rects of children of a control, which is used to find children at a position or
+in a rect without visiting all children.
+
+@details
+    Children are identified by their indexes in the child list of the control. The index has to be
+    rebuilt once children are added or removed, while a change of a child's rect can be applied
+    incrementally.
+
+    Results of finding are candidates whose rects may intersect with the specified area, callers
+    still need to test them exactly.
+*/
+class ChildSpatialIndex : NonCopyableNonMovable {
+public:
+    bool IsValid() const noexcept {
+        return is_valid_;
+    }
+
+    void Invalidate() noexcept;
+
+    void Rebuild(const std::vector<std::shared_ptr<Control>>& children);
+
+    /**
+    Applies the new rect of the specified child. It takes no effect if the index is invalid.
+    */
+    void UpdateChild(const Control& child);
+
+    /**
+    Finds indexes of children which may intersect with the specified rect, in ascending order.
+    */
+    std::vector<std::size_t> FindChildrenInRect(const zaf::Rect& rect) const;
+
+    /**
+    Finds indexes of children which may contain the specified position, in ascending order.
+    */
+    std::vector<std::size_t> FindChildrenAtPosition(const Point& position) const;
+
+private:
+    //Inclusive bounds of cells.
+    class CellRange {
+    public:
+        std::int32_t left{};
+        std::int32_t top{};
+        std::int32_t right{};
+        std::int32_t bottom{};
+
+        std::uint64_t CellCount() const noexcept {
+            return
+                static_cast<std::uint64_t>(right - left + 1) *
+                static_cast<std::uint64_t>(bottom - top + 1);
+        }
+    };
+
+private:
+    static std::uint64_t MakeCellKey(std::int32_t column, std::int32_t row) noexcept;
+
+    std::optional<CellRange> GetCellRange(const zaf::Rect& rect) const noexcept;
+    void AddChildToCells(std::size_t index, const zaf::Rect& rect);
+    void RemoveChildFromCells(std::size_t index, const zaf::Rect& rect);
+    void CollectChildrenInCells(const CellRange& range, std::vector<std::size_t>& result) const;
+
+private:
+    bool is_valid_{};
+    float cell_size_{ 1 };
+
+    std::unordered_map<const Control*, std::size_t> child_indexes_;
+    std::vector<zaf::Rect> child_rects_;
+    std::unordered_map<std::uint64_t, std::vector<std::size_t>> cells_;
+
+    //Children that span too many cells, or whose rects are not finite. They are candidates of
+    //all findings.
+    std::vector<std::size_t> large_children_;
+};
+
+}
\ No newline at end of file
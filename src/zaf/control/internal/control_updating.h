@@ -1,6 +1,7 @@
 #pragma once
 
 #include <zaf/control/control.h>
+#include <zaf/internal/graphic/dirty_region.h>
 
 namespace zaf::internal {
 
@@ -19,7 +20,7 @@ private:
 
 class ControlUpdateState {
 public:
-    Rect need_repainted_rect;
+    DirtyRegion need_repainted_region;
     bool need_relayout{};
     bool need_resize{};
 };
@@ -1,13 +1,13 @@
 #pragma once
 
 #include <zaf/base/none.h>
-#include <zaf/base/range_map.h>
+#include <zaf/base/tree_range_map.h>
 
 namespace zaf::internal {
 
 class RangeSet {
 private:
-    using UnderlyingStore = RangeMap<None>;
+    using UnderlyingStore = TreeRangeMap<None>;
 
 public:
     using value_type = Range;
@@ -0,0 +1,27 @@
+#include <zaf/control/internal/style_dependency_tracker.h>
+
+namespace zaf::internal {
+
+thread_local StyleDependencyTracker* StyleDependencyTracker::current_tracker_{};
+
+
+StyleUpdateStatistics& StyleDependencyTracker::Statistics() noexcept {
+    thread_local StyleUpdateStatistics statistics;
+    return statistics;
+}
+
+
+StyleDependencyTracker::StyleDependencyTracker(const Control& control) noexcept :
+    control_(&control),
+    previous_tracker_(current_tracker_) {
+
+    //Trackers may be nested if a style update causes another control to update its style.
+    current_tracker_ = this;
+}
+
+
+StyleDependencyTracker::~StyleDependencyTracker() {
+    current_tracker_ = previous_tracker_;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <zaf/base/flags_enum.h>
+#include <zaf/base/non_copyable.h>
+
+namespace zaf {
+class Control;
+}
+
+namespace zaf::internal {
+
+//Interaction states that styles of controls may read. A change of them on a control is passed to
+//its descendants, which update their styles only if they read the changed states.
+enum class StyleInput : std::uint32_t {
+    None = 0,
+    IsVisible = 1 << 0,
+    IsEnabled = 1 << 1,
+    IsSelected = 1 << 2,
+    IsMouseOver = 1 << 3,
+    IsFocused = 1 << 4,
+    //Changes that are not tracked, such as an explicit call to Control::NeedUpdateStyle(). All
+    //descendants update their styles for such changes.
+    Unknown = 1 << 5,
+    All = ~None,
+};
+
+ZAF_ENABLE_FLAGS_ENUM(StyleInput);
+
+
+class StyleUpdateStatistics {
+public:
+    //Count of style updates that have been performed.
+    std::size_t evaluated_count{};
+
+    //Count of style updates of descendants that have been skipped, as they don't read the changed
+    //inputs of ancestors.
+    std::size_t skipped_count{};
+};
+
+
+/**
+Records states of other controls that are read while a control is updating its style.
+
+@details
+    A tracker is active on the current thread during its lifetime. Getters of interaction states
+    report reads to the active tracker via RecordRead(). Reads of the tracked control's own states
+    are ignored, as changes of them update the control's style directly.
+*/
+class StyleDependencyTracker : NonCopyableNonMovable {
+public:
+    static void RecordRead(const Control& control, StyleInput input) noexcept {
+        if (current_tracker_ && current_tracker_->control_ != &control) {
+            current_tracker_->dependencies_ |= input;
+        }
+    }
+
+    static StyleUpdateStatistics& Statistics() noexcept;
+
+public:
+    explicit StyleDependencyTracker(const Control& control) noexcept;
+    ~StyleDependencyTracker();
+
+    StyleInput Dependencies() const noexcept {
+        return dependencies_;
+    }
+
+private:
+    static thread_local StyleDependencyTracker* current_tracker_;
+
+private:
+    const Control* control_{};
+    StyleInput dependencies_{ StyleInput::None };
+    StyleDependencyTracker* previous_tracker_{};
+};
+
+}
\ No newline at end of file
@@ -18,6 +18,26 @@ std::wstring_view GetLineBreakString(textual::LineBreak line_break) noexcept {
     }
 }
 
+//Searches in chunks of the text, so that the contiguous text is not built on each search after
+//the text is modified.
+std::size_t FindFirstOfInStyledText(
+    const StyledText& styled_text,
+    std::wstring_view sub_string,
+    std::size_t start_index) {
+
+    auto chunk_index = start_index;
+    for (auto each_chunk : styled_text.TextChunks({ start_index, std::wstring::npos })) {
+
+        auto index = each_chunk.find_first_of(sub_string);
+        if (index != std::wstring_view::npos) {
+            return chunk_index + index;
+        }
+        chunk_index += each_chunk.length();
+    }
+    return std::wstring::npos;
+}
+
+
 class TextShim {
 public:
     explicit TextShim(std::wstring& text) : text_(text) {
@@ -36,10 +56,6 @@ public:
         return text_.find_first_of(sub_string, start_index);
     }
 
-    std::wstring_view SubString(std::size_t start_index, std::size_t length) const {
-        return { text_.data() + start_index, length };
-    }
-
     void Erase(std::size_t start_index) {
         text_.erase(start_index);
     }
@@ -107,22 +123,6 @@ public:
         text_);
     }
 
-    std::wstring_view SubString(std::size_t start_index, std::size_t length) const {
-
-        return std::visit([start_index, length](const auto& text) {
-
-            using TextType = std::decay_t<decltype(text)>;
-            if constexpr (std::is_same_v<TextType, std::wstring_view>) {
-                return text.substr(start_index, length);
-            }
-
-            if constexpr (std::is_same_v<TextType, std::wstring>) {
-                return std::wstring_view{ text.data() + start_index, length };
-            }
-        },
-        text_);
-    }
-
     void Erase(std::size_t start_index) {
         
         std::visit([start_index](auto& text) {
@@ -178,16 +178,12 @@ public:
         return styled_text_.Length();
     }
 
-    wchar_t At(std::size_t index) const noexcept {
-        return styled_text_.Text()[index];
+    wchar_t At(std::size_t index) const {
+        return styled_text_.GetCharAtIndex(index);
     }
 
     std::size_t FindFirstOf(std::wstring_view sub_string, std::size_t start_index) const {
-        return styled_text_.Text().find_first_of(sub_string, start_index);
-    }
-
-    std::wstring_view SubString(std::size_t start_index, std::size_t length) const {
-        return { styled_text_.Text().data() + start_index, length };
+        return FindFirstOfInStyledText(styled_text_, sub_string, start_index);
     }
 
     void Erase(std::size_t start_index) {
@@ -227,18 +223,18 @@ public:
         styled_text_);
     }
 
-    wchar_t At(std::size_t index) const noexcept {
+    wchar_t At(std::size_t index) const {
         
         return std::visit([index](const auto& text) {
 
             using StyledTextType = std::decay_t<decltype(text)>;
             if constexpr (std::is_same_v<StyledTextType,
                 std::reference_wrapper<const StyledText>>) {
-                return text.get().Text()[index];
+                return text.get().GetCharAtIndex(index);
             }
 
             if constexpr (std::is_same_v<StyledTextType, StyledText>) {
-                return text.Text()[index];
+                return text.GetCharAtIndex(index);
             }
         },
         styled_text_);
@@ -251,28 +247,11 @@ public:
             using StyledTextType = std::decay_t<decltype(text)>;
             if constexpr (std::is_same_v<StyledTextType,
                           std::reference_wrapper<const StyledText>>) {
-                return text.get().Text().find_first_of(sub_string, start_index);
-            }
-
-            if constexpr (std::is_same_v<StyledTextType, StyledText>) {
-                return text.Text().find_first_of(sub_string, start_index);
-            }
-        },
-        styled_text_);
-    }
-
-    std::wstring_view SubString(std::size_t start_index, std::size_t length) const {
-        
-        return std::visit([start_index, length](const auto& text) {
-
-            using StyledTextType = std::decay_t<decltype(text)>;
-            if constexpr (std::is_same_v<StyledTextType,
-                          std::reference_wrapper<const StyledText>>) {
-                return std::wstring_view{ text.get().Text().data() + start_index, length };
+                return FindFirstOfInStyledText(text.get(), sub_string, start_index);
             }
 
             if constexpr (std::is_same_v<StyledTextType, StyledText>) {
-                return std::wstring_view{ text.Text().data() + start_index, length };
+                return FindFirstOfInStyledText(text, sub_string, start_index);
             }
         },
         styled_text_);
@@ -369,15 +348,20 @@ private:
                 break;
             }
 
-            std::size_t line_break_length{};
-            if (text.At(line_break_index) == L'\r' && text.At(line_break_index + 1) == L'\n') {
-                line_break_length = 2;
+            LineBreak old_line_break{};
+            if (text.At(line_break_index) == L'\n') {
+                old_line_break = LineBreak::LF;
+            }
+            else if (line_break_index + 1 < text.Length() &&
+                     text.At(line_break_index + 1) == L'\n') {
+                old_line_break = LineBreak::CRLF;
             }
             else {
-                line_break_length = 1;
+                old_line_break = LineBreak::CR;
             }
 
-            auto old_line_break_string = text.SubString(line_break_index, line_break_length);
+            auto old_line_break_string = GetLineBreakString(old_line_break);
+            auto line_break_length = old_line_break_string.length();
             if (old_line_break_string != new_line_break_string) {
 
                 text.Replace(line_break_index, line_break_length, new_line_break_string);
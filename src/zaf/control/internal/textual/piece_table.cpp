@@ -0,0 +1,381 @@
+#include <zaf/control/internal/textual/piece_table.h>
+#include <algorithm>
+#include <zaf/base/error/precondition_error.h>
+
+namespace zaf::internal {
+namespace {
+
+//Capacity of each append buffer. Text longer than half of it has a buffer of its own.
+constexpr std::size_t AppendBufferCapacity = 4096;
+
+}
+
+class PieceTable::Node {
+public:
+    std::shared_ptr<const std::wstring> buffer;
+    std::size_t offset{};
+    std::size_t length{};
+    std::uint32_t priority{};
+
+    //The length of all pieces in the subtree.
+    std::size_t total_length{};
+
+    NodePtr left;
+    NodePtr right;
+};
+
+
+PieceTable::PieceTable() noexcept = default;
+
+
+PieceTable::PieceTable(std::wstring text) {
+
+    if (text.empty()) {
+        return;
+    }
+
+    string_ = std::make_shared<const std::wstring>(std::move(text));
+    root_ = CreateNode(string_, 0, string_->length(), GenerateRandom(), nullptr, nullptr);
+}
+
+
+PieceTable::~PieceTable() = default;
+
+
+PieceTable::PieceTable(const PieceTable& other) noexcept :
+    root_(other.root_),
+    string_(other.string_),
+    random_state_(other.random_state_) {
+
+}
+
+
+PieceTable& PieceTable::operator=(const PieceTable& other) noexcept {
+
+    if (this != &other) {
+        root_ = other.root_;
+        string_ = other.string_;
+        append_buffer_.reset();
+        random_state_ = other.random_state_;
+    }
+    return *this;
+}
+
+
+PieceTable::PieceTable(PieceTable&& other) noexcept = default;
+
+PieceTable& PieceTable::operator=(PieceTable&& other) noexcept = default;
+
+
+std::size_t PieceTable::Length() const noexcept {
+    return LengthOf(root_);
+}
+
+
+wchar_t PieceTable::At(std::size_t index) const {
+
+    ZAF_EXPECT(index < Length());
+
+    if (string_) {
+        return (*string_)[index];
+    }
+
+    const auto& piece = FindPiece(root_, index);
+    return (*piece.buffer)[piece.offset + index];
+}
+
+
+const std::wstring& PieceTable::String() const {
+
+    if (string_) {
+        return *string_;
+    }
+
+    if (!root_) {
+        static const std::wstring empty_string;
+        return empty_string;
+    }
+
+    string_ = std::make_shared<const std::wstring>(SubString(0, Length()));
+    return *string_;
+}
+
+
+std::wstring PieceTable::SubString(std::size_t index, std::size_t length) const {
+
+    auto end_index = ReviseEndIndex(index, length);
+
+    std::wstring result;
+    result.reserve(end_index - index);
+    for (auto each_chunk : ChunkRange{ *this, index, end_index }) {
+        result.append(each_chunk);
+    }
+    return result;
+}
+
+
+PieceTable::ChunkRange PieceTable::Chunks(std::size_t index, std::size_t length) const {
+    return ChunkRange{ *this, index, ReviseEndIndex(index, length) };
+}
+
+
+std::wstring_view PieceTable::GetChunkAtIndex(std::size_t index, std::size_t end_index) const {
+
+    if (index >= end_index) {
+        return {};
+    }
+
+    if (string_) {
+        return std::wstring_view{ *string_ }.substr(index, end_index - index);
+    }
+
+    auto index_in_piece = index;
+    const auto& piece = FindPiece(root_, index_in_piece);
+    auto chunk_length = (std::min)(piece.length - index_in_piece, end_index - index);
+    return std::wstring_view{ *piece.buffer }.substr(piece.offset + index_in_piece, chunk_length);
+}
+
+
+PieceTable PieceTable::Slice(std::size_t index, std::size_t length) const {
+
+    auto end_index = ReviseEndIndex(index, length);
+
+    if (index == 0 && end_index == Length()) {
+        return *this;
+    }
+
+    auto [head, rest] = Split(root_, index);
+    auto [middle, tail] = Split(rest, end_index - index);
+
+    PieceTable result;
+    result.root_ = std::move(middle);
+    return result;
+}
+
+
+void PieceTable::Replace(std::size_t index, std::size_t length, std::wstring_view text) {
+
+    auto end_index = ReviseEndIndex(index, length);
+
+    auto [head, rest] = Split(root_, index);
+    auto [replaced, tail] = Split(rest, end_index - index);
+
+    auto new_head = text.empty() ? head : AppendToBuffer(head, text);
+    root_ = Merge(new_head, tail);
+    string_.reset();
+}
+
+
+void PieceTable::Replace(std::size_t index, std::size_t length, const PieceTable& text) {
+
+    auto end_index = ReviseEndIndex(index, length);
+
+    //Hold the pieces of text, in case that text is this table.
+    auto inserted = text.root_;
+
+    auto [head, rest] = Split(root_, index);
+    auto [replaced, tail] = Split(rest, end_index - index);
+    root_ = Merge(Merge(head, inserted), tail);
+    string_.reset();
+}
+
+
+std::size_t PieceTable::ReviseEndIndex(std::size_t index, std::size_t length) const {
+
+    auto total_length = Length();
+    ZAF_EXPECT(index <= total_length);
+    return index + (std::min)(length, total_length - index);
+}
+
+
+PieceTable::NodePtr PieceTable::AppendToBuffer(const NodePtr& head, std::wstring_view text) {
+
+    if (text.length() > AppendBufferCapacity / 2) {
+        auto buffer = std::make_shared<const std::wstring>(text);
+        return Merge(
+            head,
+            CreateNode(std::move(buffer), 0, text.length(), GenerateRandom(), nullptr, nullptr));
+    }
+
+    if (!append_buffer_ ||
+        append_buffer_->capacity() - append_buffer_->length() < text.length()) {
+
+        append_buffer_ = std::make_shared<std::wstring>();
+        append_buffer_->reserve(AppendBufferCapacity);
+    }
+
+    auto offset = append_buffer_->length();
+    append_buffer_->append(text);
+
+    //Extend the last piece if it is followed by the text in the buffer, which is the usual case of
+    //typing, so that the number of pieces doesn't grow.
+    if (head) {
+        const auto& last_piece = LastPiece(*head);
+        if (last_piece.buffer == append_buffer_ &&
+            last_piece.offset + last_piece.length == offset) {
+            return ExtendLastPiece(*head, text.length());
+        }
+    }
+
+    return Merge(
+        head,
+        CreateNode(append_buffer_, offset, text.length(), GenerateRandom(), nullptr, nullptr));
+}
+
+
+std::size_t PieceTable::LengthOf(const NodePtr& node) noexcept {
+    return node ? node->total_length : 0;
+}
+
+
+PieceTable::NodePtr PieceTable::CreateNode(
+    std::shared_ptr<const std::wstring> buffer,
+    std::size_t offset,
+    std::size_t length,
+    std::uint32_t priority,
+    NodePtr left,
+    NodePtr right) {
+
+    auto node = std::make_shared<Node>();
+    node->buffer = std::move(buffer);
+    node->offset = offset;
+    node->length = length;
+    node->priority = priority;
+    node->total_length = LengthOf(left) + length + LengthOf(right);
+    node->left = std::move(left);
+    node->right = std::move(right);
+    return node;
+}
+
+
+PieceTable::NodePtr PieceTable::CopyNode(const Node& node, NodePtr left, NodePtr right) {
+    return CreateNode(
+        node.buffer,
+        node.offset,
+        node.length,
+        node.priority,
+        std::move(left),
+        std::move(right));
+}
+
+
+std::pair<PieceTable::NodePtr, PieceTable::NodePtr> PieceTable::Split(
+    const NodePtr& node,
+    std::size_t count) {
+
+    //Nodes are shared, so they are copied along the path instead of being modified.
+    if (count == 0) {
+        return { nullptr, node };
+    }
+
+    if (count >= LengthOf(node)) {
+        return { node, nullptr };
+    }
+
+    auto left_length = LengthOf(node->left);
+    if (count <= left_length) {
+        auto [left, right] = Split(node->left, count);
+        return { std::move(left), CopyNode(*node, std::move(right), node->right) };
+    }
+
+    if (count < left_length + node->length) {
+
+        //Split the piece into two, the latter one takes the right subtree.
+        auto former_length = count - left_length;
+        auto former = CreateNode(
+            node->buffer,
+            node->offset,
+            former_length,
+            node->priority,
+            node->left,
+            nullptr);
+
+        auto latter = CreateNode(
+            node->buffer,
+            node->offset + former_length,
+            node->length - former_length,
+            node->priority,
+            nullptr,
+            node->right);
+
+        return { std::move(former), std::move(latter) };
+    }
+
+    auto [left, right] = Split(node->right, count - left_length - node->length);
+    return { CopyNode(*node, node->left, std::move(left)), std::move(right) };
+}
+
+
+PieceTable::NodePtr PieceTable::Merge(const NodePtr& node1, const NodePtr& node2) {
+
+    if (!node1) {
+        return node2;
+    }
+
+    if (!node2) {
+        return node1;
+    }
+
+    if (node1->priority >= node2->priority) {
+        return CopyNode(*node1, node1->left, Merge(node1->right, node2));
+    }
+    return CopyNode(*node2, Merge(node1, node2->left), node2->right);
+}
+
+
+const PieceTable::Node& PieceTable::FindPiece(const NodePtr& root, std::size_t& index) noexcept {
+
+    auto node = root.get();
+    while (true) {
+
+        auto left_length = LengthOf(node->left);
+        if (index < left_length) {
+            node = node->left.get();
+        }
+        else if (index < left_length + node->length) {
+            index -= left_length;
+            return *node;
+        }
+        else {
+            index -= left_length + node->length;
+            node = node->right.get();
+        }
+    }
+}
+
+
+const PieceTable::Node& PieceTable::LastPiece(const Node& root) noexcept {
+
+    auto node = &root;
+    while (node->right) {
+        node = node->right.get();
+    }
+    return *node;
+}
+
+
+PieceTable::NodePtr PieceTable::ExtendLastPiece(const Node& node, std::size_t length) {
+
+    if (node.right) {
+        return CopyNode(node, node.left, ExtendLastPiece(*node.right, length));
+    }
+
+    return CreateNode(
+        node.buffer,
+        node.offset,
+        node.length + length,
+        node.priority,
+        node.left,
+        nullptr);
+}
+
+
+std::uint32_t PieceTable::GenerateRandom() noexcept {
+    //xorshift32
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    return random_state_;
+}
+
+}
\ No newline at end of file
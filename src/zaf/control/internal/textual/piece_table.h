@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace zaf::internal {
+
+/*
+Stores a text as a sequence of pieces, each of which refers to a part of an immutable buffer.
+Pieces are kept in a persistent balanced tree with subtree lengths, so replacing text is O(log n)
+and never moves existing characters. Copying a table is O(1) and slicing a table is O(log n), as
+the results share pieces with the source.
+
+The contiguous string is built on demand, and it is cached until the table is modified. Building
+the string doesn't change the pieces. Use Chunks() or SubString() to access a part of the text
+without building the whole string.
+*/
+class PieceTable {
+public:
+    /*
+    Iterates over the text in a range chunk by chunk, without building the contiguous string.
+    */
+    class ChunkIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::wstring_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::wstring_view*;
+        using reference = const std::wstring_view&;
+
+    public:
+        ChunkIterator(const PieceTable& table, std::size_t index, std::size_t end_index) :
+            table_(&table),
+            index_(index),
+            end_index_(end_index) {
+
+            LoadChunk();
+        }
+
+        const std::wstring_view& operator*() const noexcept {
+            return chunk_;
+        }
+
+        const std::wstring_view* operator->() const noexcept {
+            return &chunk_;
+        }
+
+        ChunkIterator& operator++() {
+            index_ += chunk_.length();
+            LoadChunk();
+            return *this;
+        }
+
+        ChunkIterator operator++(int) {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        bool operator==(const ChunkIterator& other) const noexcept {
+            return table_ == other.table_ && index_ == other.index_;
+        }
+
+    private:
+        void LoadChunk() {
+            chunk_ = table_->GetChunkAtIndex(index_, end_index_);
+        }
+
+    private:
+        const PieceTable* table_{};
+        std::size_t index_{};
+        std::size_t end_index_{};
+        std::wstring_view chunk_;
+    };
+
+    class ChunkRange {
+    public:
+        ChunkRange(const PieceTable& table, std::size_t index, std::size_t end_index) :
+            table_(table),
+            index_(index),
+            end_index_(end_index) {
+
+        }
+
+        ChunkIterator begin() const {
+            return ChunkIterator{ table_, index_, end_index_ };
+        }
+
+        ChunkIterator end() const {
+            return ChunkIterator{ table_, end_index_, end_index_ };
+        }
+
+    private:
+        const PieceTable& table_;
+        std::size_t index_{};
+        std::size_t end_index_{};
+    };
+
+public:
+    PieceTable() noexcept;
+    explicit PieceTable(std::wstring text);
+    ~PieceTable();
+
+    //Copying shares pieces and the cached string with the source.
+    PieceTable(const PieceTable& other) noexcept;
+    PieceTable& operator=(const PieceTable& other) noexcept;
+
+    PieceTable(PieceTable&& other) noexcept;
+    PieceTable& operator=(PieceTable&& other) noexcept;
+
+    std::size_t Length() const noexcept;
+
+    wchar_t At(std::size_t index) const;
+
+    //Gets the contiguous string, which is built if it is not cached.
+    const std::wstring& String() const;
+
+    //Gets the text in the specified range as a new string, without building the whole string. The
+    //end of the range is revised to the length of the text if it exceeds.
+    std::wstring SubString(std::size_t index, std::size_t length) const;
+
+    //Iterates over the text in the specified range. The end of the range is revised to the
+    //length of the text if it exceeds.
+    ChunkRange Chunks(std::size_t index, std::size_t length) const;
+
+    PieceTable Slice(std::size_t index, std::size_t length) const;
+
+    /*
+    Replaces the text in the specified range. The end of the range is revised to the length of the
+    text if it exceeds.
+    */
+    void Replace(std::size_t index, std::size_t length, std::wstring_view text);
+    void Replace(std::size_t index, std::size_t length, const PieceTable& text);
+
+private:
+    class Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    static std::size_t LengthOf(const NodePtr& node) noexcept;
+
+    static NodePtr CreateNode(
+        std::shared_ptr<const std::wstring> buffer,
+        std::size_t offset,
+        std::size_t length,
+        std::uint32_t priority,
+        NodePtr left,
+        NodePtr right);
+
+    static NodePtr CopyNode(const Node& node, NodePtr left, NodePtr right);
+
+    static std::pair<NodePtr, NodePtr> Split(const NodePtr& node, std::size_t count);
+    static NodePtr Merge(const NodePtr& node1, const NodePtr& node2);
+
+    static const Node& FindPiece(const NodePtr& root, std::size_t& index) noexcept;
+    static const Node& LastPiece(const Node& root) noexcept;
+    static NodePtr ExtendLastPiece(const Node& node, std::size_t length);
+
+    std::size_t ReviseEndIndex(std::size_t index, std::size_t length) const;
+    void ReplaceNodes(std::size_t index, std::size_t length, const NodePtr& nodes);
+    NodePtr AppendToBuffer(const NodePtr& head, std::wstring_view text);
+
+    std::wstring_view GetChunkAtIndex(std::size_t index, std::size_t end_index) const;
+
+    std::uint32_t GenerateRandom() noexcept;
+
+private:
+    NodePtr root_;
+
+    //The cache of the contiguous string, it is mutable as it is built on demand.
+    mutable std::shared_ptr<const std::wstring> string_;
+
+    //The buffer to which inserted text is appended. Its capacity is reserved in advance, so that
+    //appending never moves existing characters referred by pieces.
+    std::shared_ptr<std::wstring> append_buffer_;
+
+    std::uint32_t random_state_{ 2463534242 };
+};
+
+}
\ No newline at end of file
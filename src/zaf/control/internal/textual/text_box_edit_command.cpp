@@ -1,17 +1,56 @@
 #include <zaf/control/internal/textual/text_box_edit_command.h>
+#include <cwctype>
 #include <zaf/control/internal/textual/text_box_selection_manager.h>
 #include <zaf/control/internal/textual/text_model.h>
 
 namespace zaf::internal {
+namespace {
+
+bool IsLineBreak(wchar_t ch) noexcept {
+    return ch == L'\r' || ch == L'\n';
+}
+
+
+/*
+Determines whether there is a boundary between two adjacent characters, at which edits should not
+be coalesced.
+*/
+bool IsCoalescingBoundary(wchar_t previous_char, wchar_t next_char) noexcept {
+
+    if (IsLineBreak(previous_char) || IsLineBreak(next_char)) {
+        return true;
+    }
+
+    //A new word begins.
+    return std::iswspace(previous_char) && !std::iswspace(next_char);
+}
+
+
+bool IsCoalescingBoundary(
+    const textual::StyledText& previous_text,
+    const textual::StyledText& next_text) {
+
+    if (previous_text.Length() == 0 || next_text.Length() == 0) {
+        return true;
+    }
+
+    return IsCoalescingBoundary(
+        previous_text.GetCharAtIndex(previous_text.Length() - 1),
+        next_text.GetCharAtIndex(0));
+}
+
+}
 
 TextBoxEditCommand::TextBoxEditCommand(
     EditParams edit_params,
     const SelectionInfo& do_selection_info,
-    const SelectionInfo& undo_selection_info) noexcept
+    const SelectionInfo& undo_selection_info,
+    Kind kind) noexcept
     : 
     edit_params_(std::move(edit_params)),
     do_selection_info_(do_selection_info),
-    undo_selection_info_(undo_selection_info) {
+    undo_selection_info_(undo_selection_info),
+    kind_(kind) {
 
 }
 
@@ -22,6 +61,15 @@ void TextBoxEditCommand::Do(
 
     ZAF_EXPECT(!is_done_);
 
+    if (kind_ == Kind::Typing) {
+
+        const auto& typed_text = edit_params_.styled_text_slice;
+        if (typed_text.Length() > 0) {
+            first_typed_char_ = typed_text.GetCharAtIndex(0);
+            last_typed_char_ = typed_text.GetCharAtIndex(typed_text.Length() - 1);
+        }
+    }
+
     edit_params_ = Execute(
         text_box, 
         edit_params_, 
@@ -40,6 +88,85 @@ void TextBoxEditCommand::Undo(TextBox& text_box) {
 }
 
 
+bool TextBoxEditCommand::Coalesce(TextBoxEditCommand& next_command) {
+
+    if (kind_ == Kind::Other || kind_ != next_command.kind_) {
+        return false;
+    }
+
+    if (!is_done_ || !next_command.is_done_) {
+        return false;
+    }
+
+    //Both commands are done, so their edit params are used for undoing, in which replaced_range is
+    //the range of the new text and styled_text_slice is the old text.
+    auto& params = edit_params_;
+    auto& next_params = next_command.edit_params_;
+
+    switch (kind_) {
+    case Kind::Typing:
+        //The next text should be inserted right after the current text, without replacing
+        //anything.
+        if (next_params.replaced_range.index != params.replaced_range.EndIndex() ||
+            next_params.styled_text_slice.Length() > 0 ||
+            next_params.replaced_range.length == 0 ||
+            IsCoalescingBoundary(last_typed_char_, next_command.first_typed_char_)) {
+            return false;
+        }
+        params.replaced_range.length += next_params.replaced_range.length;
+        last_typed_char_ = next_command.last_typed_char_;
+        return true;
+
+    case Kind::Backspace:
+        //The next removed text should be right before the current removed text.
+        if (params.replaced_range.length > 0 ||
+            next_params.replaced_range.length > 0 ||
+            next_params.replaced_range.index + next_params.styled_text_slice.Length() !=
+            params.replaced_range.index ||
+            IsCoalescingBoundary(next_params.styled_text_slice, params.styled_text_slice)) {
+            return false;
+        }
+        next_params.styled_text_slice.SetStyledTextInRange(
+            std::move(params.styled_text_slice),
+            Range{ next_params.styled_text_slice.Length(), 0 });
+        params.styled_text_slice = std::move(next_params.styled_text_slice);
+        params.replaced_range.index = next_params.replaced_range.index;
+        return true;
+
+    case Kind::Delete:
+        //The next removed text should be right after the current removed text.
+        if (params.replaced_range.length > 0 ||
+            next_params.replaced_range.length > 0 ||
+            next_params.replaced_range.index != params.replaced_range.index ||
+            IsCoalescingBoundary(params.styled_text_slice, next_params.styled_text_slice)) {
+            return false;
+        }
+        params.styled_text_slice.SetStyledTextInRange(
+            std::move(next_params.styled_text_slice),
+            Range{ params.styled_text_slice.Length(), 0 });
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+
+std::size_t TextBoxEditCommand::EstimateMemoryUsage() const noexcept {
+
+    const auto& styled_text = edit_params_.styled_text_slice;
+
+    std::size_t result = sizeof(*this);
+    result += styled_text.Length() * sizeof(wchar_t);
+    result += styled_text.RangedFonts().Count() * (sizeof(Range) + sizeof(Font));
+    result += styled_text.RangedTextColors().Count() * (sizeof(Range) + sizeof(Color));
+    result += styled_text.RangedTextBackColors().Count() * (sizeof(Range) + sizeof(Color));
+    result += styled_text.InlineObjects().Count() *
+        (sizeof(Range) + sizeof(std::shared_ptr<textual::InlineObject>));
+    return result;
+}
+
+
 TextBoxEditCommand::EditParams TextBoxEditCommand::Execute(
     TextBox& text_box,
     EditParams& edit_params,
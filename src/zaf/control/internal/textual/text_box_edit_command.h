@@ -9,6 +9,32 @@ namespace zaf::internal {
 
 class TextBoxEditCommand : NonCopyableNonMovable {
 public:
+    /**
+    The kind of an edit, which determines whether consecutive commands can be coalesced.
+    */
+    enum class Kind {
+
+        /**
+        The command is never coalesced.
+        */
+        Other,
+
+        /**
+        Inputting text by typing.
+        */
+        Typing,
+
+        /**
+        Removing a character before the caret by the backspace key.
+        */
+        Backspace,
+
+        /**
+        Removing a character after the caret by the delete key.
+        */
+        Delete,
+    };
+
     class SelectionInfo {
     public:
         /**
@@ -39,7 +65,8 @@ public:
     TextBoxEditCommand(
         EditParams edit_params,
         const SelectionInfo& do_selection_info,
-        const SelectionInfo& undo_selection_info) noexcept;
+        const SelectionInfo& undo_selection_info,
+        Kind kind = Kind::Other) noexcept;
 
     void Do(TextBox& text_box, std::optional<textual::StyledText> undo_styled_text = std::nullopt);
     void Undo(TextBox& text_box);
@@ -48,6 +75,24 @@ public:
         return edit_params_;
     }
 
+    /**
+    Coalesces the specified command, which is done right after this command, into this command, so
+    that they are undone and redone as a whole.
+
+    @return
+        Whether the command is coalesced. Commands can be coalesced only if they are of the same
+        kind other than Kind::Other, and their edits are adjacent. Besides, they are not coalesced
+        at word boundaries, where a non-whitespace character follows a whitespace character, nor
+        at line breaks, so that a long run of typing is undone word by word.
+    */
+    bool Coalesce(TextBoxEditCommand& next_command);
+
+    /**
+    Estimates the number of bytes used by the command, including the text stored for undoing or
+    redoing.
+    */
+    std::size_t EstimateMemoryUsage() const noexcept;
+
 private:
     static EditParams Execute(
         TextBox& text_box,
@@ -66,7 +111,13 @@ private:
     EditParams edit_params_;
     const SelectionInfo do_selection_info_;
     const SelectionInfo undo_selection_info_;
+    const Kind kind_{ Kind::Other };
     bool is_done_{};
+
+    //The first and the last characters of the typed text, which are used to find boundaries when
+    //coalescing typing commands, as the typed text is not kept in edit_params_ once it's done.
+    wchar_t first_typed_char_{};
+    wchar_t last_typed_char_{};
 };
 
 }
@@ -105,12 +105,12 @@ void TextBoxEditor::SetAllowUndo(bool allow_undo) {
 
 
 bool TextBoxEditor::CanUndo() const noexcept {
-    return next_command_index_ > 0;
+    return undo_history_.CanUndo();
 }
 
 
 bool TextBoxEditor::CanRedo() const noexcept {
-    return next_command_index_ < edit_commands_.size();
+    return undo_history_.CanRedo();
 }
 
 
@@ -197,7 +197,8 @@ std::unique_ptr<TextBoxEditCommand> TextBoxEditor::HandleDelete() {
     return CreateNormalCommand(
         {},
         Range::FromIndexPair(selection_range.index, next_index),
-        true);
+        true,
+        TextBoxEditCommand::Kind::Delete);
 }
 
 
@@ -211,7 +212,7 @@ std::unique_ptr<TextBoxEditCommand> TextBoxEditor::HandleBatchDelete() {
     }
 
     //Determine the word range.
-    auto text = owner_.InnerTextModel().Text();
+    std::wstring_view text = owner_.InnerTextModel().Text();
     auto word_range = owner_.WordExtractor()(text, selection_range.index);
 
     //Nothing can be removed.
@@ -237,7 +238,7 @@ std::unique_ptr<TextBoxEditCommand> TextBoxEditor::HandleBatchBackspace() {
 
     //Determine the word range. Note that the index used to determine should be prior to the caret 
     //index.
-    auto text = owner_.InnerTextModel().Text();
+    std::wstring_view text = owner_.InnerTextModel().Text();
 
     auto determined_index = selection_range.index > 0 ? selection_range.index - 1 : 0;
     auto word_range = owner_.WordExtractor()(text, determined_index);
@@ -274,7 +275,8 @@ std::unique_ptr<TextBoxEditCommand> TextBoxEditor::HandleBackspace() {
     return CreateNormalCommand(
         {},
         Range::FromIndexPair(previous_index, selection_range.index),
-        true);
+        true,
+        TextBoxEditCommand::Kind::Backspace);
 }
 
 
@@ -339,7 +341,7 @@ void TextBoxEditor::HandleCharInput(const CharInputInfo& event_info) {
         return;
     }
 
-    InnerPerformInputText(std::wstring_view(&ch, 1), false);
+    InnerPerformInputText(std::wstring_view(&ch, 1), false, TextBoxEditCommand::Kind::Typing);
 }
 
 
@@ -348,7 +350,10 @@ bool TextBoxEditor::PerformInputText(std::wstring_view text) {
 }
 
 
-bool TextBoxEditor::InnerPerformInputText(std::wstring_view text, bool can_truncate) {
+bool TextBoxEditor::InnerPerformInputText(
+    std::wstring_view text,
+    bool can_truncate,
+    TextBoxEditCommand::Kind command_kind) {
 
     if (!CanEdit()) {
         return false;
@@ -358,7 +363,7 @@ bool TextBoxEditor::InnerPerformInputText(std::wstring_view text, bool can_trunc
     styled_text.SetText(std::wstring{ text });
 
     FillTextStyleFromCurrentSelection(styled_text);
-    return InputStyledText(std::move(styled_text), can_truncate);
+    return InputStyledText(std::move(styled_text), can_truncate, command_kind);
 }
 
 
@@ -435,7 +440,10 @@ bool TextBoxEditor::InnerPerformInputStyledText(StyledText styled_text, bool can
 }
 
 
-bool TextBoxEditor::InputStyledText(textual::StyledText styled_text, bool can_truncate) {
+bool TextBoxEditor::InputStyledText(
+    textual::StyledText styled_text,
+    bool can_truncate,
+    TextBoxEditCommand::Kind command_kind) {
 
     auto selection_range = owner_.SelectionManager().SelectionRange();
 
@@ -443,11 +451,15 @@ bool TextBoxEditor::InputStyledText(textual::StyledText styled_text, bool can_tr
         return false;
     }
 
-    if (styled_text.Text().empty()) {
+    if (styled_text.Length() == 0) {
         return false;
     }
 
-    auto command = CreateNormalCommand(std::move(styled_text), selection_range, false);
+    auto command = CreateNormalCommand(
+        std::move(styled_text),
+        selection_range,
+        false,
+        command_kind);
 
     auto auto_reset = MakeAutoReset(is_performing_edit_, true);
     ExecuteNormalCommand(std::move(command));
@@ -464,7 +476,7 @@ bool TextBoxEditor::EnforceMaxLength(
         return true;
     }
 
-    auto current_length = owner_.InnerTextModel().Text().length();
+    auto current_length = owner_.InnerTextModel().StyledText().Length();
     auto new_length = current_length - selection_range.length + styled_text.Length();
     if (new_length <= *max_length_) {
         return true;
@@ -477,8 +489,8 @@ bool TextBoxEditor::EnforceMaxLength(
     auto truncated_length = *max_length_ - current_length + selection_range.length;
 
     //Do not break the \r\n sequence.
-    if (styled_text.Text()[truncated_length] == L'\n' && truncated_length > 0) {
-        if (styled_text.Text()[truncated_length - 1] == L'\r') {
+    if (styled_text.GetCharAtIndex(truncated_length) == L'\n' && truncated_length > 0) {
+        if (styled_text.GetCharAtIndex(truncated_length - 1) == L'\r') {
             --truncated_length;
         }
     }
@@ -491,7 +503,8 @@ bool TextBoxEditor::EnforceMaxLength(
 std::unique_ptr<TextBoxEditCommand> TextBoxEditor::CreateNormalCommand(
     textual::StyledText new_text,
     const Range& replaced_selection_range,
-    bool set_caret_to_begin) const {
+    bool set_caret_to_begin,
+    TextBoxEditCommand::Kind command_kind) const {
 
     auto& selection_manager = owner_.SelectionManager();
     auto old_caret_index = selection_manager.CaretIndex();
@@ -516,7 +529,8 @@ std::unique_ptr<TextBoxEditCommand> TextBoxEditor::CreateNormalCommand(
     return std::make_unique<TextBoxEditCommand>(
         std::move(edit_params), 
         do_selection_info,
-        undo_selection_info);
+        undo_selection_info,
+        command_kind);
 }
 
 
@@ -533,42 +547,23 @@ void TextBoxEditor::ExecuteNormalCommand(std::unique_ptr<TextBoxEditCommand> com
 
 void TextBoxEditor::AddCommandToUndoHistory(std::unique_ptr<TextBoxEditCommand> command) {
 
-    edit_commands_.erase(edit_commands_.begin() + next_command_index_, edit_commands_.end());
-
     if (AllowUndo()) {
-        edit_commands_.push_back(std::move(command));
-        ++next_command_index_;
+        undo_history_.AddCommand(std::move(command));
     }
 }
 
 
 bool TextBoxEditor::PerformUndo() {
 
-    if (!CanUndo()) {
-        return false;
-    }
-
     auto auto_reset = MakeAutoReset(is_performing_edit_, true);
-
-    --next_command_index_;
-    const auto& command = edit_commands_[next_command_index_];
-    command->Undo(owner_);
-    return true;
+    return undo_history_.Undo(owner_);
 }
 
 
 bool TextBoxEditor::PerformRedo() {
 
-    if (!CanRedo()) {
-        return false;
-    }
-
     auto auto_reset = MakeAutoReset(is_performing_edit_, true);
-
-    const auto& command = edit_commands_[next_command_index_];
-    command->Do(owner_);
-    ++next_command_index_;
-    return true;
+    return undo_history_.Redo(owner_);
 }
 
 
@@ -721,7 +716,7 @@ void TextBoxEditor::DropCompositionText() {
 
     // Only add the command to undo history if the composition text is not empty. Otherwise, the
     // command will be a no-op and should not be added to the undo history.
-    if (!new_command->GetEditParams().styled_text_slice.Text().empty()) {
+    if (new_command->GetEditParams().styled_text_slice.Length() > 0) {
         AddCommandToUndoHistory(std::move(new_command));
     }
 }
@@ -781,8 +776,7 @@ void TextBoxEditor::OnTextModelChanged() {
 
 
 void TextBoxEditor::ClearCommands() {
-    edit_commands_.clear();
-    next_command_index_ = 0;
+    undo_history_.Clear();
 }
 
 }
@@ -8,6 +8,7 @@
 #include <zaf/control/event/keyboard_event_info.h>
 #include <zaf/control/textual/pasting_info.h>
 #include <zaf/control/internal/textual/text_box_edit_command.h>
+#include <zaf/control/internal/textual/text_box_undo_history.h>
 #include <zaf/rx/disposable_host.h>
 
 namespace zaf::internal {
@@ -46,6 +47,18 @@ public:
 
     void SetAllowUndo(bool allow_undo);
 
+    std::size_t UndoHistoryMemoryLimit() const noexcept {
+        return undo_history_.MemoryLimit();
+    }
+
+    void SetUndoHistoryMemoryLimit(std::size_t limit) {
+        undo_history_.SetMemoryLimit(limit);
+    }
+
+    textual::UndoHistoryStatistics GetUndoHistoryStatistics() const noexcept {
+        return undo_history_.GetStatistics();
+    }
+
     bool CanUndo() const noexcept;
     bool PerformUndo();
 
@@ -94,14 +107,20 @@ private:
     std::unique_ptr<TextBoxEditCommand> HandleBatchBackspace();
     std::unique_ptr<TextBoxEditCommand> HandleBackspace();
 
-    bool InnerPerformInputText(std::wstring_view text, bool can_truncate);
+    bool InnerPerformInputText(
+        std::wstring_view text,
+        bool can_truncate,
+        TextBoxEditCommand::Kind command_kind = TextBoxEditCommand::Kind::Other);
     void FillTextStyleFromCurrentSelection(textual::StyledText& styled_text) const;
     void FillTextStyleFromSelection(
         textual::StyledText& styled_text, 
         const Range& selection_range, 
         std::size_t caret_index) const;
     bool InnerPerformInputStyledText(textual::StyledText styled_text, bool can_truncate);
-    bool InputStyledText(textual::StyledText styled_text, bool can_truncate);
+    bool InputStyledText(
+        textual::StyledText styled_text,
+        bool can_truncate,
+        TextBoxEditCommand::Kind command_kind = TextBoxEditCommand::Kind::Other);
     bool EnforceMaxLength(
         textual::StyledText& styled_text, 
         const Range& selection_range,
@@ -110,7 +129,8 @@ private:
     std::unique_ptr<TextBoxEditCommand> CreateNormalCommand(
         textual::StyledText new_text,
         const Range& replaced_selection_range,
-        bool set_caret_to_begin) const;
+        bool set_caret_to_begin,
+        TextBoxEditCommand::Kind command_kind = TextBoxEditCommand::Kind::Other) const;
 
     void ExecuteNormalCommand(std::unique_ptr<TextBoxEditCommand> command);
     void AddCommandToUndoHistory(std::unique_ptr<TextBoxEditCommand> command);
@@ -171,8 +191,7 @@ private:
 
     Event<textual::PastingInfo> pasting_event_;
 
-    std::vector<std::unique_ptr<TextBoxEditCommand>> edit_commands_;
-    std::size_t next_command_index_{};
+    TextBoxUndoHistory undo_history_;
 };
 
 }
@@ -16,9 +16,8 @@ void TextBoxIndexManager::Initialize() {
 
 std::size_t TextBoxIndexManager::GetBackwardIndex(std::size_t index) const {
 
-    auto& text_model = owner_.InnerTextModel();
-    std::wstring_view text = text_model.Text();
-    ZAF_EXPECT(index <= text.length());
+    const auto& styled_text = owner_.InnerTextModel().StyledText();
+    ZAF_EXPECT(index <= styled_text.Length());
 
     if (index == 0) {
         return index;
@@ -30,7 +29,7 @@ std::size_t TextBoxIndexManager::GetBackwardIndex(std::size_t index) const {
     }
 
     //Move index to the beginning of the inline object if the index is inside an inline object.
-    auto& inline_objects = owner_.InnerTextModel().StyledText().InlineObjects();
+    auto& inline_objects = styled_text.InlineObjects();
     auto iterator = inline_objects.FindItemAtIndex(previous_index);
     if (iterator != inline_objects.end()) {
 
@@ -39,7 +38,8 @@ std::size_t TextBoxIndexManager::GetBackwardIndex(std::size_t index) const {
     else {
 
         //Skip CRLF line break.
-        if (text[previous_index - 1] == L'\r' && text[previous_index] == L'\n') {
+        if (styled_text.GetCharAtIndex(previous_index - 1) == L'\r' &&
+            styled_text.GetCharAtIndex(previous_index) == L'\n') {
             --previous_index;
         }
     }
@@ -50,15 +50,15 @@ std::size_t TextBoxIndexManager::GetBackwardIndex(std::size_t index) const {
 
 std::size_t TextBoxIndexManager::GetForwardIndex(std::size_t index) const {
     
-    std::wstring_view text = owner_.InnerTextModel().Text();
-    ZAF_EXPECT(index <= text.length());
+    const auto& styled_text = owner_.InnerTextModel().StyledText();
+    ZAF_EXPECT(index <= styled_text.Length());
 
-    if (index == text.length()) {
+    if (index == styled_text.Length()) {
         return index;
     }
 
     //Move index to the end of the inline object if the index is inside an inline object.
-    auto& inline_objects = owner_.InnerTextModel().StyledText().InlineObjects();
+    auto& inline_objects = styled_text.InlineObjects();
     auto iterator = inline_objects.FindItemAtIndex(index);
     if (iterator != inline_objects.end()) {
 
@@ -66,12 +66,13 @@ std::size_t TextBoxIndexManager::GetForwardIndex(std::size_t index) const {
     }
 
     auto next_index = index + 1;
-    if (next_index == text.length()) {
+    if (next_index == styled_text.Length()) {
         return next_index;
     }
 
     //Skip CRLF line break.
-    if (text[index] == L'\r' && text[next_index] == L'\n') {
+    if (styled_text.GetCharAtIndex(index) == L'\r' &&
+        styled_text.GetCharAtIndex(next_index) == L'\n') {
         ++next_index;
     }
 
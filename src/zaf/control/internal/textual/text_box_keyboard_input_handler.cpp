@@ -200,7 +200,10 @@ void TextBoxKeyboardInputHandler::MoveCaretIndexToTextHead() {
 
 
 void TextBoxKeyboardInputHandler::MoveCaretIndexToTextEnd() {
-    SetCaretIndexByKey(owner_.InnerTextModel().Text().length(), Keyboard::IsShiftDown(), true);
+    SetCaretIndexByKey(
+        owner_.InnerTextModel().StyledText().Length(),
+        Keyboard::IsShiftDown(),
+        true);
 }
 
 
@@ -211,20 +214,21 @@ std::size_t TextBoxKeyboardInputHandler::LocateCurrentLineEndIndex() const {
         return line_info.line_char_index;
     }
 
-    std::wstring_view text = owner_.InnerTextModel().Text();
+    const auto& styled_text = owner_.InnerTextModel().StyledText();
 
     auto last_char_index = line_info.line_char_index + line_info.line_length - 1;
-    if (text[last_char_index] == L'\r') {
+    auto last_char = styled_text.GetCharAtIndex(last_char_index);
+    if (last_char == L'\r') {
         return last_char_index;
     }
 
-    if (text[last_char_index] == L'\n') {
+    if (last_char == L'\n') {
 
         if (line_info.line_length == 1) {
             return last_char_index;
         }
 
-        if (text[last_char_index - 1] == L'\r') {
+        if (styled_text.GetCharAtIndex(last_char_index - 1) == L'\r') {
             return last_char_index - 1;
         }
         return last_char_index;
@@ -342,7 +346,7 @@ bool TextBoxKeyboardInputHandler::PerformCopy() {
 void TextBoxKeyboardInputHandler::HandleSelectAll() {
 
     owner_.SelectionManager().SetSelectionRange(
-        Range{ 0, owner_.InnerTextModel().Text().length() },
+        Range{ 0, owner_.InnerTextModel().StyledText().Length() },
         textual::SelectionOption::SetCaretToEnd | textual::SelectionOption::ScrollToCaret, 
         std::nullopt,
         true);
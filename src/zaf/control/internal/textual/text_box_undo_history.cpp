@@ -0,0 +1,139 @@
+#include <zaf/control/internal/textual/text_box_undo_history.h>
+
+namespace zaf::internal {
+
+void TextBoxUndoHistory::AddCommand(std::unique_ptr<TextBoxEditCommand> command) {
+
+    while (CanRedo()) {
+        DropCommand(false);
+    }
+
+    if (can_coalesce_ && !commands_.empty()) {
+
+        auto& last_item = commands_.back();
+        if (last_item.command->Coalesce(*command)) {
+
+            ++coalesced_count_;
+            UpdateMemoryUsage(last_item);
+            EnforceMemoryLimit();
+            return;
+        }
+    }
+
+    auto& new_item = commands_.emplace_back();
+    new_item.command = std::move(command);
+    UpdateMemoryUsage(new_item);
+
+    next_command_index_ = commands_.size();
+    can_coalesce_ = true;
+
+    EnforceMemoryLimit();
+}
+
+
+bool TextBoxUndoHistory::Undo(TextBox& text_box) {
+
+    if (!CanUndo()) {
+        return false;
+    }
+
+    can_coalesce_ = false;
+
+    --next_command_index_;
+    auto& item = commands_[next_command_index_];
+    item.command->Undo(text_box);
+
+    //The command holds the new text instead of the old one now.
+    UpdateMemoryUsage(item);
+    EnforceMemoryLimit();
+    return true;
+}
+
+
+bool TextBoxUndoHistory::Redo(TextBox& text_box) {
+
+    if (!CanRedo()) {
+        return false;
+    }
+
+    can_coalesce_ = false;
+
+    auto& item = commands_[next_command_index_];
+    item.command->Do(text_box);
+    ++next_command_index_;
+
+    UpdateMemoryUsage(item);
+    EnforceMemoryLimit();
+    return true;
+}
+
+
+void TextBoxUndoHistory::Clear() noexcept {
+
+    commands_.clear();
+    next_command_index_ = 0;
+    can_coalesce_ = false;
+    memory_usage_ = 0;
+}
+
+
+void TextBoxUndoHistory::SetMemoryLimit(std::size_t limit) {
+
+    memory_limit_ = limit;
+    EnforceMemoryLimit();
+}
+
+
+textual::UndoHistoryStatistics TextBoxUndoHistory::GetStatistics() const noexcept {
+
+    textual::UndoHistoryStatistics result;
+    result.undo_count = next_command_index_;
+    result.redo_count = commands_.size() - next_command_index_;
+    result.memory_usage = memory_usage_;
+    result.memory_limit = memory_limit_;
+    result.coalesced_count = coalesced_count_;
+    result.dropped_count = dropped_count_;
+    return result;
+}
+
+
+void TextBoxUndoHistory::UpdateMemoryUsage(CommandItem& item) noexcept {
+
+    memory_usage_ -= item.memory_usage;
+    item.memory_usage = item.command->EstimateMemoryUsage();
+    memory_usage_ += item.memory_usage;
+}
+
+
+void TextBoxUndoHistory::EnforceMemoryLimit() noexcept {
+
+    while (memory_usage_ > memory_limit_) {
+
+        //Drop the oldest done command first, and then the farthest undone command.
+        DropCommand(next_command_index_ > 0);
+        ++dropped_count_;
+    }
+}
+
+
+void TextBoxUndoHistory::DropCommand(bool drop_oldest) noexcept {
+
+    if (drop_oldest) {
+
+        memory_usage_ -= commands_.front().memory_usage;
+        commands_.pop_front();
+        --next_command_index_;
+
+        //The last done command is dropped, so there is nothing to be coalesced into.
+        if (next_command_index_ == 0) {
+            can_coalesce_ = false;
+        }
+    }
+    else {
+
+        memory_usage_ -= commands_.back().memory_usage;
+        commands_.pop_back();
+    }
+}
+
+}
\ No newline at end of file
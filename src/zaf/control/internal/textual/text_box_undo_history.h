@@ -0,0 +1,79 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <zaf/base/non_copyable.h>
+#include <zaf/control/internal/textual/text_box_edit_command.h>
+#include <zaf/control/textual/undo_history_statistics.h>
+
+namespace zaf::internal {
+
+/**
+Manages done and undone edit commands of a text box.
+
+@details
+    A command that is added right after a command of the same kind is coalesced into the latter if
+    their edits are adjacent, so that consecutive typing or deleting is undone as a whole. See
+    TextBoxEditCommand::Coalesce() for details.
+
+    The memory usage of commands is estimated, and the oldest commands are dropped once the usage
+    exceeds the memory limit.
+*/
+class TextBoxUndoHistory : NonCopyableNonMovable {
+public:
+    static constexpr std::size_t DefaultMemoryLimit = 16 * 1024 * 1024;
+
+public:
+    bool CanUndo() const noexcept {
+        return next_command_index_ > 0;
+    }
+
+    bool CanRedo() const noexcept {
+        return next_command_index_ < commands_.size();
+    }
+
+    /**
+    Adds a done command to the history. All undone commands are dropped.
+    */
+    void AddCommand(std::unique_ptr<TextBoxEditCommand> command);
+
+    bool Undo(TextBox& text_box);
+    bool Redo(TextBox& text_box);
+
+    void Clear() noexcept;
+
+    std::size_t MemoryLimit() const noexcept {
+        return memory_limit_;
+    }
+
+    void SetMemoryLimit(std::size_t limit);
+
+    textual::UndoHistoryStatistics GetStatistics() const noexcept;
+
+private:
+    class CommandItem {
+    public:
+        std::unique_ptr<TextBoxEditCommand> command;
+        std::size_t memory_usage{};
+    };
+
+private:
+    void UpdateMemoryUsage(CommandItem& item) noexcept;
+    void EnforceMemoryLimit() noexcept;
+    void DropCommand(bool drop_oldest) noexcept;
+
+private:
+    std::deque<CommandItem> commands_;
+    std::size_t next_command_index_{};
+
+    //Whether a new command can be coalesced into the last done command. Coalescing is stopped
+    //once the history is undone or redone.
+    bool can_coalesce_{};
+
+    std::size_t memory_limit_{ DefaultMemoryLimit };
+    std::size_t memory_usage_{};
+    std::size_t coalesced_count_{};
+    std::size_t dropped_count_{};
+};
+
+}
\ No newline at end of file
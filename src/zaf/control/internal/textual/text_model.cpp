@@ -129,7 +129,7 @@ Range TextModel::SetStyledTextInRange(
 }
 
 
-const std::wstring& TextModel::Text() const noexcept {
+const std::wstring& TextModel::Text() const {
     return styled_text_.Text();
 }
 
@@ -149,8 +149,8 @@ void TextModel::SetText(std::wstring text) {
 void TextModel::SetTextInRange(std::wstring_view text, Range range) {
 
     ZAF_EXPECT(
-        (range.index <= styled_text_.Text().length()) &&
-        (range.EndIndex() <= styled_text_.Text().length()));
+        (range.index <= styled_text_.Length()) &&
+        (range.EndIndex() <= styled_text_.Length()));
 
     auto revised_text = internal::ReviseLinesInTextView(
         text,
@@ -118,7 +118,7 @@ public:
         const Range& range,
         textual::StyledText* old_styled_text = nullptr);
 
-    const std::wstring& Text() const noexcept;
+    const std::wstring& Text() const;
     void SetText(std::wstring text);
     void SetTextInRange(std::wstring_view text, Range range);
 
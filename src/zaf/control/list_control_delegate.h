@@ -42,6 +42,26 @@ public:
         return 0;
     }
 
+    /**
+     Get a value indicating that whether item heights are estimated lazily.
+
+     This method takes effect only if HasVariableItemHeight returns true. If it returns true,
+     GetDefaultItemHeight is used as the height of items that have not been shown yet, and
+     EstimateItemHeight is called only when items are about to be shown. It is useful for lists
+     with a huge number of items, whose loading time should not depend on the item count.
+     */
+    virtual bool HasLazyItemHeight() {
+        return false;
+    }
+
+    /**
+     Get the height of items whose heights have not been estimated, if HasLazyItemHeight returns
+     true.
+     */
+    virtual float GetDefaultItemHeight() {
+        return 20;
+    }
+
     virtual std::shared_ptr<ListItem> CreateItem(
         std::size_t item_index,
         const std::shared_ptr<Object>& item_data);
@@ -10,7 +10,11 @@ PropertyValuePair::PropertyValuePair(ObjectProperty* property, std::shared_ptr<O
 
 
 PropertyValuePair::PropertyValuePair(std::wstring property_name, std::wstring value) :
-    data_(NotParsedData{ std::move(property_name), std::move(value) }) {
+    data_(NotParsedData{
+        std::move(property_name),
+        std::move(value),
+        std::make_shared<ParsedDataCache>()
+    }) {
 
 }
 
@@ -50,7 +54,7 @@ void PropertyValuePair::SetWithParsedData(const ParsedData& data, Object& object
 
 
 void PropertyValuePair::SetWithNotParsedData(const NotParsedData& data, Object& object) {
-    auto parsed_data = ConvertToParsedData(data, object);
+    const auto& parsed_data = GetParsedData(data, object);
     if (parsed_data) {
         SetWithParsedData(*parsed_data, object);
     }
@@ -94,7 +98,7 @@ bool PropertyValuePair::IsSetWithNotParsedData(
     const NotParsedData& data, 
     const Object& object) {
 
-    auto parsed_data = ConvertToParsedData(data, object);
+    const auto& parsed_data = GetParsedData(data, object);
     if (parsed_data) {
         return IsSetWithParsedData(*parsed_data, object);
     }
@@ -102,13 +106,30 @@ bool PropertyValuePair::IsSetWithNotParsedData(
 }
 
 
-std::optional<PropertyValuePair::ParsedData> PropertyValuePair::ConvertToParsedData(
+const std::optional<PropertyValuePair::ParsedData>& PropertyValuePair::GetParsedData(
     const NotParsedData& data,
     const Object& object) {
 
-    auto type = object.DynamicType();
+    const auto* type = object.DynamicType();
+
+    auto& cache = *data.parsed_data_cache;
+    auto iterator = cache.find(type);
+    if (iterator != cache.end()) {
+        return iterator->second;
+    }
+
+    //Elements of unordered_map are not relocated, so the reference is still valid even if the
+    //cache is modified re-entrantly while setting the value.
+    auto parsed_data = ConvertToParsedData(data, *type);
+    return cache.emplace(type, std::move(parsed_data)).first->second;
+}
+
+
+std::optional<PropertyValuePair::ParsedData> PropertyValuePair::ConvertToParsedData(
+    const NotParsedData& data,
+    const ObjectType& type) {
 
-    auto property = type->GetProperty(data.property_name);
+    auto property = type.GetProperty(data.property_name);
     if (!property) {
         return std::nullopt;
     }
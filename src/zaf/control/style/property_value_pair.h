@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 #include <variant>
 #include <zaf/object/object_property.h>
@@ -36,9 +37,15 @@ private:
         std::shared_ptr<Object> value;
     };
 
+    //Parsed data of each object type. Types without the property are mapped to std::nullopt.
+    using ParsedDataCache = std::unordered_map<const ObjectType*, std::optional<ParsedData>>;
+
     struct NotParsedData {
         std::wstring property_name;
         std::wstring value;
+
+        //Shared among copies of the pair, so that the value is parsed only once for each type.
+        std::shared_ptr<ParsedDataCache> parsed_data_cache;
     };
 
 private:
@@ -48,10 +55,14 @@ private:
     static bool IsSetWithParsedData(const ParsedData& data, const Object& object);
     static bool IsSetWithNotParsedData(const NotParsedData& data, const Object& object);
 
-    static std::optional<ParsedData> ConvertToParsedData(
+    static const std::optional<ParsedData>& GetParsedData(
         const NotParsedData& data,
         const Object& object);
 
+    static std::optional<ParsedData> ConvertToParsedData(
+        const NotParsedData& data,
+        const ObjectType& type);
+
 private:
     std::variant<ParsedData, NotParsedData> data_;
 };
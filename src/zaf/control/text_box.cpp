@@ -266,7 +266,7 @@ void TextBox::PaintSelection(
 
     auto background_color = SelectionBackColor();
     auto brush = canvas.Renderer().CreateSolidColorBrush(background_color);
-    std::wstring_view text = TextModel().Text();
+    const auto& styled_text = TextModel().StyledText();
 
     for (const auto& metrics : metrics_list) {
 
@@ -274,7 +274,8 @@ void TextBox::PaintSelection(
 
         //Draw extra space to represent line breaks
         auto last_index = metrics.TextIndex() + metrics.Length() - 1;
-        if (text[last_index] == L'\n' || text[last_index] == L'\r') {
+        auto last_char = styled_text.GetCharAtIndex(last_index);
+        if (last_char == L'\n' || last_char == L'\r') {
             rect.size.width += metrics.Height() / 3;
         }
 
@@ -334,6 +335,21 @@ void TextBox::SetAllowUndo(bool allow_undo) {
 }
 
 
+std::size_t TextBox::UndoHistoryMemoryLimit() const noexcept {
+    return Editor().UndoHistoryMemoryLimit();
+}
+
+
+void TextBox::SetUndoHistoryMemoryLimit(std::size_t limit) {
+    Editor().SetUndoHistoryMemoryLimit(limit);
+}
+
+
+textual::UndoHistoryStatistics TextBox::GetUndoHistoryStatistics() const noexcept {
+    return Editor().GetUndoHistoryStatistics();
+}
+
+
 bool TextBox::CanUndo() const noexcept {
     return Editor().CanUndo();
 }
@@ -568,11 +584,11 @@ const Range& TextBox::SelectionRange() const {
 
 void TextBox::SetSelectionRange(const Range& range, textual::SelectionOption selection_option) {
 
-    std::wstring_view text = TextModel().Text();
+    auto text_length = TextModel().StyledText().Length();
 
     auto revised_range = Range::FromIndexPair(
-        (std::min)(range.index, text.length()),
-        (std::min)(range.EndIndex(), text.length()));
+        (std::min)(range.index, text_length),
+        (std::min)(range.EndIndex(), text_length));
 
     SelectionManager().SetSelectionRange(
         revised_range,
@@ -609,10 +625,7 @@ void TextBox::OnInnerSelectionChanged(const internal::TextBoxSelectionChangedInf
 
 std::wstring TextBox::SelectedText() const {
 
-    std::wstring_view text = TextModel().Text();
-    auto selection_range = this->SelectionRange();
-    auto selected_text = text.substr(selection_range.index, selection_range.length);
-    return std::wstring{ selected_text };
+    return TextModel().StyledText().GetTextInRange(this->SelectionRange());
 }
 
 
@@ -14,6 +14,7 @@
 #include <zaf/control/textual/hit_test_index_result.h>
 #include <zaf/control/textual/selection_changed_info.h>
 #include <zaf/control/textual/selection_option.h>
+#include <zaf/control/textual/undo_history_statistics.h>
 #include <zaf/control/textual/word_extractor.h>
 #include <zaf/window/event/message_handling_info.h>
 
@@ -97,6 +98,30 @@ public:
     */
     void SetAllowUndo(bool allow_undo);
 
+    /**
+    Gets the maximum number of bytes that the undo history can use.
+
+    @details
+        The oldest operations are dropped from the history once the estimated memory usage of the
+        history exceeds the limit. The default limit is 16 MB.
+    */
+    std::size_t UndoHistoryMemoryLimit() const noexcept;
+
+    /**
+    Sets the maximum number of bytes that the undo history can use.
+
+    @param limit
+        The maximum number of bytes. Operations in the history are dropped immediately if the
+        current memory usage exceeds the new limit.
+    */
+    void SetUndoHistoryMemoryLimit(std::size_t limit);
+
+    /**
+    Gets statistics of the undo history, such as the number of operations and the estimated memory
+    usage.
+    */
+    textual::UndoHistoryStatistics GetUndoHistoryStatistics() const noexcept;
+
     /**
     Determines whether there are undoable text modification operations in the text box's history.
     */
@@ -105,6 +130,9 @@ public:
     /**
     Undoes the most recent text modification operation in the text box's history.
 
+    @details
+        Consecutive typing, backspacing or deleting is recorded as a single operation.
+
     @return
         Returns true if the operation is successfully undone; or returns false if there are no 
         operations in the text box's history.
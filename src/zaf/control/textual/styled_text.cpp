@@ -6,6 +6,17 @@
 #include <zaf/xml/xml_writer.h>
 
 namespace zaf::textual {
+namespace {
+
+std::size_t GetTextLength(std::wstring_view text) noexcept {
+    return text.length();
+}
+
+std::size_t GetTextLength(const internal::PieceTable& text) noexcept {
+    return text.Length();
+}
+
+}
 
 StyledText::StyledText() {
 
@@ -27,8 +38,11 @@ void StyledText::AssignStyledTextFromView(
     const StyledTextView& view,
     bool assign_objects) {
 
-    //Use SetText() to clear all ranged styles.
-    styled_text.SetText(std::wstring{ view.Text() });
+    //Share pieces of the text with the view, rather than copying characters.
+    styled_text.text_ = view.styled_text_.text_.Slice(
+        view.view_range_.index,
+        view.view_range_.length);
+    styled_text.ranged_style_.Clear();
     styled_text.default_style_ = view.DefaultStyle();
 
     for (const auto& each_item : view.RangedFonts()) {
@@ -57,7 +71,7 @@ void StyledText::AssignStyledTextFromView(
 
 void StyledText::SetText(std::wstring text) {
 
-    text_ = std::move(text);
+    text_ = internal::PieceTable{ std::move(text) };
     ranged_style_.Clear();
 }
 
@@ -67,7 +81,17 @@ Range StyledText::SetTextInRange(
     const Range& range,
     StyledText* old_styled_text) {
 
-    ZAF_EXPECT(range.index <= text_.length());
+    return InnerSetTextInRange(text, range, old_styled_text);
+}
+
+
+template<typename T>
+Range StyledText::InnerSetTextInRange(
+    const T& text,
+    const Range& range,
+    StyledText* old_styled_text) {
+
+    ZAF_EXPECT(range.index <= Length());
 
     //Preserve the old styled text in the range.
     //Inline objects should be handled carefully, as we want to return the original objects to 
@@ -83,8 +107,9 @@ Range StyledText::SetTextInRange(
         }
     }
 
-    text_.replace(range.index, range.length, text);
-    ranged_style_.ReplaceSpan(range, text.length());
+    auto text_length = GetTextLength(text);
+    text_.Replace(range.index, range.length, text);
+    ranged_style_.ReplaceSpan(range, text_length);
 
     if (old_styled_text) {
         for (auto& each_item : inline_objects) {
@@ -94,12 +119,12 @@ Range StyledText::SetTextInRange(
         }
     }
 
-    return Range{ range.index, text.length() };
+    return Range{ range.index, text_length };
 }
 
 
 Range StyledText::AppendText(std::wstring_view text) {
-    return SetTextInRange(text, Range{ text_.length(), 0 });
+    return SetTextInRange(text, Range{ Length(), 0 });
 }
 
 
@@ -146,7 +171,7 @@ void StyledText::ClearRangedFonts() {
 
 const Font& StyledText::GetFontAtIndex(std::size_t index) const {
 
-    ZAF_EXPECT(index <= text_.length());
+    ZAF_EXPECT(index <= Length());
 
     auto& fonts = ranged_style_.Fonts();
     auto iterator = fonts.FindItemAtIndex(index);
@@ -180,7 +205,7 @@ void StyledText::ClearRangedTextColors() {
 
 const Color& StyledText::GetTextColorAtIndex(std::size_t index) const {
 
-    ZAF_EXPECT(index <= text_.length());
+    ZAF_EXPECT(index <= Length());
 
     auto& text_colors = ranged_style_.TextColors();
     auto iterator = text_colors.FindItemAtIndex(index);
@@ -214,7 +239,7 @@ void StyledText::ClearRangedTextBackColors() {
 
 const Color& StyledText::GetTextBackColorAtIndex(std::size_t index) const {
 
-    ZAF_EXPECT(index <= text_.length());
+    ZAF_EXPECT(index <= Length());
 
     auto& text_back_colors = ranged_style_.TextBackColors();
     auto iterator = text_back_colors.FindItemAtIndex(index);
@@ -252,7 +277,7 @@ void StyledText::ClearInlineObjects() {
 std::shared_ptr<textual::InlineObject> StyledText::GetInlineObjectAtIndex(
     std::size_t index) const {
 
-    ZAF_EXPECT(index <= text_.length());
+    ZAF_EXPECT(index <= Length());
 
     auto& inline_objects = ranged_style_.InlineObjects();
     auto iterator = inline_objects.FindItemAtIndex(index);
@@ -280,7 +305,7 @@ Range StyledText::SetStyledTextInRange(
     StyledText* old_styled_text) {
 
     //Text
-    auto new_range = SetTextInRange(styled_text.Text(), range, old_styled_text);
+    auto new_range = InnerSetTextInRange(styled_text.text_, range, old_styled_text);
 
     //Default style
     const auto& other_default_style = styled_text.DefaultStyle();
@@ -362,7 +387,8 @@ void StyledText::Truncate(std::size_t new_length) {
 
 StyledText StyledText::Clone() const {
 
-    StyledText result{ this->text_ };
+    StyledText result;
+    result.text_ = this->text_;
     result.default_style_ = this->default_style_;
     result.ranged_style_ = this->ranged_style_.Clone();
     return result;
@@ -372,8 +398,8 @@ StyledText StyledText::Clone() const {
 void StyledText::CheckRange(const Range& range) const {
 
     ZAF_EXPECT(
-        (range.index <= text_.length()) &&
-        (range.EndIndex() <= text_.length()));
+        (range.index <= Length()) &&
+        (range.EndIndex() <= Length()));
 }
 
 
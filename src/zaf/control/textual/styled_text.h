@@ -9,6 +9,7 @@
 #include <zaf/base/error/precondition_error.h>
 #include <zaf/base/non_copyable.h>
 #include <zaf/base/range.h>
+#include <zaf/control/internal/textual/piece_table.h>
 #include <zaf/control/textual/default_text_style.h>
 #include <zaf/control/textual/inline_object.h>
 #include <zaf/control/textual/ranged_text_style.h>
@@ -31,6 +32,10 @@ Represents a text with various styles, such as the font, text color, and attache
 
     Copying a StyledText is a high-cost operation, so copy construction and copy assignment are 
     forbidden. Users can use the Clone() method to copy the StyledText explicitly if needed.
+
+    The text is stored in pieces, so that setting text in a range doesn't move the rest of the
+    text. The contiguous text is built on demand by Text(), and it is cached until the text is
+    modified. Use TextChunks() or GetTextInRange() to access the text without building it.
 */
 class StyledText : public XMLSerializable, NonCopyable {
 public:
@@ -44,6 +49,11 @@ public:
     */
     using RangedColorAccessor = RangedTextStyle::ColorAccessor;
 
+    /**
+    A range of std::wstring_view chunks that make up a part of the text.
+    */
+    using TextChunkRange = internal::PieceTable::ChunkRange;
+
 public:
     /**
     Constructs an empty StyledText.
@@ -72,7 +82,7 @@ public:
     explicit StyledText(const StyledTextView& styled_text_view);
 
     std::size_t Length() const noexcept {
-        return text_.length();
+        return text_.Length();
     }
 
     /**
@@ -80,9 +90,76 @@ public:
 
     @return
         The text of the StyledText.
+
+    @details
+        The contiguous text is built if the text has been modified since the last call, which is
+        O(n). The returned reference is valid until the text is modified. Use GetCharAtIndex(),
+        GetTextInRange() or TextChunks() to access a part of the text without building it.
+
+    @throw std::bad_alloc
+        Thrown if it fails to build the contiguous text.
+    */
+    const std::wstring& Text() const {
+        return text_.String();
+    }
+
+    /**
+    Gets the character at the specified index.
+
+    @param index
+        The index of the character.
+
+    @pre
+        The index is less than the length of the text.
+
+    @return
+        The character at the index.
+
+    @throw zaf::PreconditionError
+    */
+    wchar_t GetCharAtIndex(std::size_t index) const {
+        return text_.At(index);
+    }
+
+    /**
+    Gets the text in the specified range, without building the whole text.
+
+    @param range
+        The range of the text. The end index of the range may exceed the length of the text; in
+        such a case, the end index will be revised to the length of the text.
+
+    @pre
+        The start index of the range does not exceed the length of the text.
+
+    @return
+        The text in the range.
+
+    @throw zaf::PreconditionError
+
+    @throw std::bad_alloc
     */
-    const std::wstring& Text() const noexcept {
-        return text_;
+    std::wstring GetTextInRange(const Range& range) const {
+        return text_.SubString(range.index, range.length);
+    }
+
+    /**
+    Gets the text in the specified range as a sequence of chunks, without building the contiguous
+    text.
+
+    @param range
+        The range of the text. The end index of the range may exceed the length of the text; in
+        such a case, the end index will be revised to the length of the text.
+
+    @pre
+        The start index of the range does not exceed the length of the text.
+
+    @return
+        A range of std::wstring_view chunks, which are valid until the text is modified.
+
+    @throw zaf::PreconditionError
+    */
+    TextChunkRange TextChunks(const Range& range) const {
+        return text_.Chunks(range.index, range.length);
     }
 
     /**
@@ -294,12 +371,15 @@ private:
         const Range& item_range,
         const Range& sub_text_range);
 
+    template<typename T>
+    Range InnerSetTextInRange(const T& text, const Range& range, StyledText* old_styled_text);
+
     void CheckRange(const Range& range) const;
 
     void ReadTextFromXML(XMLReader& reader);
 
 private:
-    std::wstring text_;
+    internal::PieceTable text_;
     DefaultTextStyle default_style_;
     RangedTextStyle ranged_style_;
 };
@@ -15,11 +15,25 @@ StyledTextView::StyledTextView(const StyledText& styled_text, const Range& view_
 }
 
 
-std::wstring_view StyledTextView::Text() const noexcept {
-    return std::wstring_view{ 
-        styled_text_.Text().data() + view_range_.index,
-        view_range_.length 
-    };
+std::wstring_view StyledTextView::Text() const {
+
+    //Refer to the piece directly if the range is within a single one, which is the usual case, so
+    //that neither the whole text nor the text in the range is built.
+    auto chunks = styled_text_.TextChunks(view_range_);
+    auto iterator = chunks.begin();
+    if (iterator == chunks.end()) {
+        return {};
+    }
+
+    auto first_chunk = *iterator;
+    if (++iterator == chunks.end()) {
+        return first_chunk;
+    }
+
+    if (!joined_text_) {
+        joined_text_ = styled_text_.GetTextInRange(view_range_);
+    }
+    return *joined_text_;
 }
 
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+#include <string>
 #include <zaf/base/range.h>
 #include <zaf/control/textual/ranged_text_style.h>
 #include <zaf/control/textual/default_text_style.h>
@@ -263,7 +265,7 @@ public:
 public:
     StyledTextView(const StyledText& styled_text, const Range& view_range);
 
-    std::wstring_view Text() const noexcept;
+    std::wstring_view Text() const;
 
     const DefaultTextStyle& DefaultStyle() const noexcept;
 
@@ -282,9 +284,15 @@ public:
     std::shared_ptr<InlineObject> GetInlineObjectAtIndex(std::size_t index) const;
     InlineObjectView InlineObjects() const noexcept;
 
+private:
+    friend class StyledText;
+
 private:
     const StyledText& styled_text_;
     Range view_range_;
+
+    //The text in the view range, which is built on demand if the range spans multiple pieces.
+    mutable std::optional<std::wstring> joined_text_;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+@file
+    Defines the zaf::textual::UndoHistoryStatistics class.
+*/
+
+#include <cstddef>
+
+namespace zaf::textual {
+
+/**
+Contains statistics of the undo history of a text box.
+*/
+class UndoHistoryStatistics {
+public:
+    /**
+    The number of operations that can be undone.
+    */
+    std::size_t undo_count{};
+
+    /**
+    The number of operations that can be redone.
+    */
+    std::size_t redo_count{};
+
+    /**
+    The estimated number of bytes used by the history.
+    */
+    std::size_t memory_usage{};
+
+    /**
+    The maximum number of bytes that the history can use.
+    */
+    std::size_t memory_limit{};
+
+    /**
+    The total number of operations that have been coalesced into previous operations, such as
+    consecutive typing.
+    */
+    std::size_t coalesced_count{};
+
+    /**
+    The total number of operations that have been dropped from the history due to the memory
+    limit.
+    */
+    std::size_t dropped_count{};
+};
+
+}
\ No newline at end of file
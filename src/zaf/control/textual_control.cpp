@@ -203,7 +203,7 @@ void TextualControl::UpdateTextRect(const zaf::Rect& text_rect) {
 
 
 std::size_t TextualControl::TextLength() const {
-    return text_model_->Text().length();
+    return text_model_->StyledText().Length();
 }
 
 
@@ -264,6 +264,9 @@ const ColorPicker& TextualControl::TextColorPicker() const {
 
 void TextualControl::SetTextColorPicker(ColorPicker picker) {
     text_model_->SetTextColorPicker(std::move(picker), *this);
+
+    //Update the style to track states read by the new picker.
+    NeedUpdateStyle();
 }
 
 
@@ -292,6 +295,9 @@ const ColorPicker& TextualControl::TextBackColorPicker() const {
 
 void TextualControl::SetTextBackColorPicker(ColorPicker picker) {
     text_model_->SetTextBackColorPicker(std::move(picker), *this);
+
+    //Update the style to track states read by the new picker.
+    NeedUpdateStyle();
 }
 
 
@@ -38,6 +38,39 @@ public:
         return Create<Object>();
     }
 
+    /**
+    Indicates whether children of the specified parent data are loaded asynchronously.
+
+    @details
+        If this method returns true, the tree control calls `LoadChildDataAsync()` to load
+        children of the parent data when it is expanded, instead of calling `GetChildDataCount()`
+        and `GetChildDataAtIndex()`.
+    */
+    virtual bool ShouldLoadChildDataAsync(const std::shared_ptr<Object>& parent_data) {
+        return false;
+    }
+
+    /**
+    Loads children of the specified parent data asynchronously.
+
+    @return
+        An observable that emits children in pages. Children in each page are appended to the
+        parent data as soon as the page is emitted, so that they are shown without waiting for
+        the whole loading. The observable is subscribed each time the parent data is expanded, and
+        the subscription is disposed if the parent data is collapsed or removed before the loading
+        finishes.
+
+    @details
+        The observable must emit pages on the UI thread, consider using `ObserveOn()` with
+        `zaf::rx::MainThreadScheduler`. Children loaded asynchronously are not reserved after the
+        parent data is collapsed, they are loaded again on next expanding.
+    */
+    virtual rx::Observable<std::vector<std::shared_ptr<Object>>> LoadChildDataAsync(
+        const std::shared_ptr<Object>& parent_data) {
+
+        return rx::Observable<std::vector<std::shared_ptr<Object>>>::Empty();
+    }
+
     rx::Observable<TreeDataSourceDataAddInfo> DataAddEvent() {
         return data_add_event_.AsObservable();
     }
@@ -15,12 +15,12 @@ std::shared_ptr<Image> Image::FromFile(const std::filesystem::path& file_path) {
 
 
 std::shared_ptr<Image> Image::FromURI(const std::wstring& uri) {
-    return FromStream(ResourceFactory::Instance().LoadURI(uri));
+    return ResourceFactory::Instance().LoadURIImage(uri);
 }
 
 
 std::shared_ptr<Image> Image::FromURI(const std::wstring& uri, float dpi) {
-    return FromStream(ResourceFactory::Instance().LoadURI(uri, dpi));
+    return ResourceFactory::Instance().LoadURIImage(uri, dpi);
 }
 
 
@@ -94,8 +94,7 @@ void URIImage::LoadImageIfNot() {
         return;
     }
 
-    auto stream = ResourceFactory::Instance().LoadURI(uri_, dpi_);
-    image_ = Image::FromStream(stream);
+    image_ = ResourceFactory::Instance().LoadURIImage(uri_, dpi_);
 }
 
 }
\ No newline at end of file
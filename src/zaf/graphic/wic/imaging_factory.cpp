@@ -56,4 +56,19 @@ Bitmap ImagingFactory::CreateBitmap(const Size& size, const BitmapCreateOptions&
     return Bitmap{ ptr };
 }
 
+
+Bitmap ImagingFactory::CreateBitmapFromSource(
+    const BitmapSource& source,
+    BitmapCacheOption cache_option) {
+
+    COMPtr<IWICBitmap> ptr;
+    HRESULT com_error = Ptr()->CreateBitmapFromSource(
+        source.Ptr().Inner(),
+        static_cast<WICBitmapCreateCacheOption>(cache_option),
+        ptr.Reset());
+
+    ZAF_THROW_IF_COM_ERROR(com_error);
+    return Bitmap{ ptr };
+}
+
 }
\ No newline at end of file
@@ -95,6 +95,9 @@ public:
     }
 
 
+    Bitmap CreateBitmapFromSource(const BitmapSource& source, BitmapCacheOption cache_option);
+
+
     Bitmap CreateBitmapFromHBITMAP(
         HBITMAP bitmap,
         const BitmapCreateFromHBITMAPOptions& options) {
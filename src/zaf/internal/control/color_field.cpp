@@ -17,6 +17,8 @@ void ColorField::SetColorPicker(zaf::ColorPicker color_picker, Control& owner) {
     color_picker_ = std::move(color_picker);
     UpdateColor(owner);
 
+    //Update the style to track states read by the new picker.
+    owner.NeedUpdateStyle();
     owner.NeedRepaint();
 }
 
@@ -0,0 +1,173 @@
+#include <zaf/internal/graphic/dirty_region.h>
+#include <algorithm>
+#include <limits>
+
+namespace zaf::internal {
+namespace {
+
+float Area(const Rect& rect) noexcept {
+    return rect.size.width * rect.size.height;
+}
+
+
+bool HasPositiveArea(const Rect& rect) noexcept {
+    return rect.size.width > 0 && rect.size.height > 0;
+}
+
+
+//Gets the parts of rect that are outside the intersecting rect excluded_rect, which are at most
+//four disjoint rects.
+std::vector<Rect> SubtractRect(const Rect& rect, const Rect& excluded_rect) {
+
+    float left = rect.position.x;
+    float top = rect.position.y;
+    float right = rect.position.x + rect.size.width;
+    float bottom = rect.position.y + rect.size.height;
+
+    float excluded_left = excluded_rect.position.x;
+    float excluded_top = excluded_rect.position.y;
+    float excluded_right = excluded_rect.position.x + excluded_rect.size.width;
+    float excluded_bottom = excluded_rect.position.y + excluded_rect.size.height;
+
+    std::vector<Rect> result;
+
+    if (excluded_top > top) {
+        result.emplace_back(left, top, right - left, excluded_top - top);
+    }
+
+    if (excluded_bottom < bottom) {
+        result.emplace_back(left, excluded_bottom, right - left, bottom - excluded_bottom);
+    }
+
+    float middle_top = (std::max)(top, excluded_top);
+    float middle_bottom = (std::min)(bottom, excluded_bottom);
+
+    if (excluded_left > left) {
+        result.emplace_back(left, middle_top, excluded_left - left, middle_bottom - middle_top);
+    }
+
+    if (excluded_right < right) {
+        result.emplace_back(
+            excluded_right,
+            middle_top,
+            right - excluded_right,
+            middle_bottom - middle_top);
+    }
+
+    std::erase_if(result, [](const Rect& rect) { return !HasPositiveArea(rect); });
+    return result;
+}
+
+}
+
+void DirtyRegion::Add(const Rect& rect) {
+
+    if (!HasPositiveArea(rect)) {
+        return;
+    }
+
+    Insert(rect, true);
+
+    while (rects_.size() > MaxRectCount) {
+        MergeCheapestPair();
+    }
+}
+
+
+Rect DirtyRegion::Bounds() const noexcept {
+
+    if (rects_.empty()) {
+        return Rect{};
+    }
+
+    Rect result = rects_.front();
+    for (const auto& each_rect : rects_) {
+        result.Union(each_rect);
+    }
+    return result;
+}
+
+
+void DirtyRegion::Insert(const Rect& rect, bool can_split) {
+
+    Rect pending_rect = rect;
+
+    //Merge with existing rects as long as it saves area. Merging is forced for intersecting rects
+    //if splitting is not allowed.
+    std::size_t index{};
+    while (index < rects_.size()) {
+
+        const auto& existing_rect = rects_[index];
+
+        //Merging saves area if the bounding rect is not larger than painting both rects. It is
+        //also true if one rect contains the other.
+        auto union_rect = Rect::Union(existing_rect, pending_rect);
+        bool can_merge =
+            (Area(union_rect) <= Area(existing_rect) + Area(pending_rect)) ||
+            (!can_split && existing_rect.HasIntersection(pending_rect));
+
+        if (can_merge) {
+
+            rects_.erase(rects_.begin() + index);
+            pending_rect = union_rect;
+
+            //The merged rect may be mergeable with rects that have been checked.
+            index = 0;
+            continue;
+        }
+
+        ++index;
+    }
+
+    //Keep rects disjoint by adding only the parts outside existing rects.
+    std::vector<Rect> parts{ pending_rect };
+    for (const auto& each_rect : rects_) {
+
+        std::vector<Rect> new_parts;
+        for (const auto& each_part : parts) {
+
+            if (each_part.HasIntersection(each_rect)) {
+                auto sub_parts = SubtractRect(each_part, each_rect);
+                new_parts.insert(new_parts.end(), sub_parts.begin(), sub_parts.end());
+            }
+            else {
+                new_parts.push_back(each_part);
+            }
+        }
+        parts = std::move(new_parts);
+    }
+
+    rects_.insert(rects_.end(), parts.begin(), parts.end());
+}
+
+
+void DirtyRegion::MergeCheapestPair() {
+
+    std::size_t merged_index1{};
+    std::size_t merged_index2{ 1 };
+    float min_wasted_area = (std::numeric_limits<float>::max)();
+
+    for (std::size_t index1 = 0; index1 < rects_.size(); ++index1) {
+        for (std::size_t index2 = index1 + 1; index2 < rects_.size(); ++index2) {
+
+            const auto& rect1 = rects_[index1];
+            const auto& rect2 = rects_[index2];
+
+            auto wasted_area = Area(Rect::Union(rect1, rect2)) - Area(rect1) - Area(rect2);
+            if (wasted_area < min_wasted_area) {
+                min_wasted_area = wasted_area;
+                merged_index1 = index1;
+                merged_index2 = index2;
+            }
+        }
+    }
+
+    auto union_rect = Rect::Union(rects_[merged_index1], rects_[merged_index2]);
+    rects_.erase(rects_.begin() + merged_index2);
+    rects_.erase(rects_.begin() + merged_index1);
+
+    //The union rect is not split, otherwise the count of rects may not decrease.
+    Insert(union_rect, false);
+}
+
+}
\ No newline at end of file
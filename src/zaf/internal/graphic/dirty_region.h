@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+#include <zaf/graphic/rect.h>
+
+namespace zaf::internal {
+
+/**
+A region that needs to be repainted, which is represented as a bounded list of disjoint rects.
+
+@details
+    A newly added rect is merged with an existing rect only if their bounding rect is not larger
+    than the sum of their areas, otherwise it is split around the existing rect. Once the count of
+    rects exceeds MaxRectCount, the pair of rects that wastes the least area is merged.
+*/
+class DirtyRegion {
+public:
+    static constexpr std::size_t MaxRectCount = 8;
+
+public:
+    /**
+    Adds a rect to the region. Rects whose width or height is not positive are ignored.
+    */
+    void Add(const Rect& rect);
+
+    void Clear() noexcept {
+        rects_.clear();
+    }
+
+    bool IsEmpty() const noexcept {
+        return rects_.empty();
+    }
+
+    /**
+    Gets the disjoint rects of the region, in no particular order.
+    */
+    const std::vector<Rect>& Rects() const noexcept {
+        return rects_;
+    }
+
+    /**
+    Gets the bounding rect of the region. It is an empty rect if the region is empty.
+    */
+    Rect Bounds() const noexcept;
+
+private:
+    void Insert(const Rect& rect, bool can_split);
+    void MergeCheapestPair();
+
+private:
+    std::vector<Rect> rects_;
+};
+
+}
\ No newline at end of file
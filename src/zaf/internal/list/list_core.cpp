@@ -522,6 +522,9 @@ void ListCore::SetScrollContentHeight(float height) {
 
 void ListCore::ScrollToItemAtIndex(std::size_t index) {
 
+    //Make sure the position of the item is accurate before scrolling to it.
+    MeasureItems(Range{ index, 1 });
+
     auto position_and_height = Parts().ItemHeightManager().GetItemPositionAndHeight(index);
 
     Rect visible_scroll_area_rect = Parts().Owner().GetVisibleScrollContentRect();
@@ -542,6 +545,47 @@ void ListCore::ScrollToItemAtIndex(std::size_t index) {
 }
 
 
+bool ListCore::MeasureItems(const Range& range) {
+
+    auto& item_height_manager = Parts().ItemHeightManager();
+
+    //Remember the offset of the first visible item to the top of the visible area.
+    auto visible_rect = Parts().Owner().GetVisibleScrollContentRect();
+    auto [anchor_index, visible_count] = item_height_manager.GetItemRange(
+        visible_rect.position.y,
+        visible_rect.position.y + visible_rect.size.height);
+
+    float anchor_offset{};
+    if (visible_count > 0) {
+        anchor_offset =
+            item_height_manager.GetItemPositionAndHeight(anchor_index).first -
+            visible_rect.position.y;
+    }
+
+    if (!item_height_manager.MeasureItems(range)) {
+        return false;
+    }
+
+    //Disable OnLayout() for preventing from reentering.
+    auto auto_reset = MakeAutoReset(disable_on_layout_, true);
+    AdjustContentHeight();
+
+    //Keep the first visible item at the same place, so that the content doesn't jump if items
+    //above it are measured.
+    if (visible_count > 0) {
+
+        float new_position =
+            item_height_manager.GetItemPositionAndHeight(anchor_index).first - anchor_offset;
+
+        if (new_position != visible_rect.position.y) {
+            Parts().Owner().ScrollToScrollContentPosition(
+                Point{ visible_rect.position.x, new_position });
+        }
+    }
+    return true;
+}
+
+
 std::optional<std::size_t> ListCore::FindItemIndexAtPosition(
     const Point& position) {
 
@@ -71,6 +71,13 @@ public:
 
     void ScrollToItemAtIndex(std::size_t index);
 
+    /*
+    Measures items in the specified range if item heights are estimated lazily, and adjusts the
+    content height and the scroll position accordingly. Returns a value indicating whether any item
+    height is changed.
+    */
+    bool MeasureItems(const Range& range);
+
     std::optional<std::size_t> FindItemIndexAtPosition(const Point& position);
 
     bool AutoAdjustScrollBarSmallChange() const {
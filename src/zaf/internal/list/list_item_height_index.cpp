@@ -0,0 +1,370 @@
+#include <zaf/internal/list/list_item_height_index.h>
+#include <algorithm>
+#include <zaf/base/error/precondition_error.h>
+
+namespace zaf::internal {
+
+class ListItemHeightIndex::Node {
+public:
+    //The extent of each item in the node.
+    float extent{};
+
+    //The number of items in the node.
+    std::size_t count{ 1 };
+
+    //The sum of extents of all items in the subtree.
+    float sum{};
+
+    //The number of items in the subtree.
+    std::size_t size{};
+
+    //The number of nodes in the subtree.
+    std::size_t node_count{};
+
+    std::unique_ptr<Node> left;
+    std::unique_ptr<Node> right;
+};
+
+
+ListItemHeightIndex::ListItemHeightIndex() = default;
+
+ListItemHeightIndex::~ListItemHeightIndex() = default;
+
+ListItemHeightIndex::ListItemHeightIndex(ListItemHeightIndex&&) noexcept = default;
+
+ListItemHeightIndex& ListItemHeightIndex::operator=(ListItemHeightIndex&&) noexcept = default;
+
+
+std::size_t ListItemHeightIndex::Count() const noexcept {
+    return SizeOf(root_.get());
+}
+
+
+float ListItemHeightIndex::TotalExtent() const noexcept {
+    return SumOf(root_.get());
+}
+
+
+void ListItemHeightIndex::Reset(const std::vector<float>& extents) {
+    root_ = Build(extents.data(), extents.size());
+}
+
+
+void ListItemHeightIndex::Reset(std::size_t count, float extent) {
+    root_ = BuildRun(count, extent);
+}
+
+
+void ListItemHeightIndex::Insert(std::size_t index, const std::vector<float>& extents) {
+    ZAF_EXPECT(index <= Count());
+    InsertSubtree(index, Build(extents.data(), extents.size()));
+}
+
+
+void ListItemHeightIndex::Insert(std::size_t index, std::size_t count, float extent) {
+    ZAF_EXPECT(index <= Count());
+    InsertSubtree(index, BuildRun(count, extent));
+}
+
+
+void ListItemHeightIndex::InsertSubtree(std::size_t index, std::unique_ptr<Node> subtree) {
+
+    auto spare_node = std::make_unique<Node>();
+
+    auto [head, tail] = Split(std::move(root_), index, spare_node);
+    root_ = Merge(Merge(std::move(head), std::move(subtree)), std::move(tail));
+}
+
+
+void ListItemHeightIndex::Erase(std::size_t index, std::size_t count) {
+
+    ZAF_EXPECT(index + count <= Count());
+
+    auto spare_node1 = std::make_unique<Node>();
+    auto spare_node2 = std::make_unique<Node>();
+
+    auto [head, rest] = Split(std::move(root_), index, spare_node1);
+    auto [erased, tail] = Split(std::move(rest), count, spare_node2);
+    root_ = Merge(std::move(head), std::move(tail));
+}
+
+
+void ListItemHeightIndex::Update(std::size_t index, const std::vector<float>& extents) {
+
+    ZAF_EXPECT(index + extents.size() <= Count());
+
+    auto updated = Build(extents.data(), extents.size());
+    auto spare_node1 = std::make_unique<Node>();
+    auto spare_node2 = std::make_unique<Node>();
+
+    auto [head, rest] = Split(std::move(root_), index, spare_node1);
+    auto [replaced, tail] = Split(std::move(rest), extents.size(), spare_node2);
+    root_ = Merge(Merge(std::move(head), std::move(updated)), std::move(tail));
+}
+
+
+float ListItemHeightIndex::GetPosition(std::size_t index) const {
+
+    ZAF_EXPECT(index <= Count());
+
+    float position{};
+    auto node = root_.get();
+    while (node) {
+
+        auto left_size = SizeOf(node->left.get());
+        if (index <= left_size) {
+            node = node->left.get();
+        }
+        else if (index < left_size + node->count) {
+            position += SumOf(node->left.get());
+            position += node->extent * (index - left_size);
+            break;
+        }
+        else {
+            //Accumulate in the same order as CountItemsEndBefore(), so that the results are
+            //consistent.
+            position += SumOf(node->left.get());
+            position += node->extent * node->count;
+            index -= left_size + node->count;
+            node = node->right.get();
+        }
+    }
+    return position;
+}
+
+
+float ListItemHeightIndex::GetExtent(std::size_t index) const {
+    return GetNode(index).extent;
+}
+
+
+const ListItemHeightIndex::Node& ListItemHeightIndex::GetNode(std::size_t index) const {
+
+    ZAF_EXPECT(index < Count());
+
+    auto node = root_.get();
+    while (true) {
+
+        auto left_size = SizeOf(node->left.get());
+        if (index < left_size) {
+            node = node->left.get();
+        }
+        else if (index < left_size + node->count) {
+            return *node;
+        }
+        else {
+            index -= left_size + node->count;
+            node = node->right.get();
+        }
+    }
+}
+
+
+std::size_t ListItemHeightIndex::UpperBound(float position) const noexcept {
+
+    //The first position is always 0.
+    if (position < 0) {
+        return 0;
+    }
+    return CountItemsEndBefore(position, true) + 1;
+}
+
+
+std::size_t ListItemHeightIndex::LowerBound(float position) const noexcept {
+
+    if (position <= 0) {
+        return 0;
+    }
+    return CountItemsEndBefore(position, false) + 1;
+}
+
+
+std::size_t ListItemHeightIndex::CountItemsEndBefore(
+    float position,
+    bool inclusive) const noexcept {
+
+    auto is_before = [position, inclusive](float end_position) {
+        return inclusive ? end_position <= position : end_position < position;
+    };
+
+    //Extents are not negative, so end positions of items are in ascending order.
+    std::size_t result{};
+    float base_position{};
+    auto node = root_.get();
+    while (node) {
+
+        float begin_position = base_position + SumOf(node->left.get());
+        float end_position = begin_position + node->extent * node->count;
+        if (is_before(end_position)) {
+            result += SizeOf(node->left.get()) + node->count;
+            base_position = end_position;
+            node = node->right.get();
+            continue;
+        }
+
+        if (!is_before(begin_position + node->extent)) {
+            node = node->left.get();
+            continue;
+        }
+
+        //Only a part of items in the run are before the position. In such case the first item is
+        //before the position and the last one is not, so the extent is positive.
+        result += SizeOf(node->left.get());
+
+        std::size_t count_in_run = node->count - 1;
+        float estimated_count = (position - begin_position) / node->extent;
+        if (estimated_count < count_in_run) {
+            count_in_run = (std::max)(static_cast<std::size_t>(estimated_count), std::size_t(1));
+        }
+
+        //Correct the rounding error of the division above.
+        while (count_in_run > 1 &&
+               !is_before(begin_position + node->extent * count_in_run)) {
+            --count_in_run;
+        }
+
+        while (count_in_run < node->count - 1 &&
+               is_before(begin_position + node->extent * (count_in_run + 1))) {
+            ++count_in_run;
+        }
+
+        result += count_in_run;
+        break;
+    }
+    return result;
+}
+
+
+std::size_t ListItemHeightIndex::SizeOf(const Node* node) noexcept {
+    return node ? node->size : 0;
+}
+
+
+std::size_t ListItemHeightIndex::NodeCountOf(const Node* node) noexcept {
+    return node ? node->node_count : 0;
+}
+
+
+float ListItemHeightIndex::SumOf(const Node* node) noexcept {
+    return node ? node->sum : 0;
+}
+
+
+void ListItemHeightIndex::UpdateNode(Node& node) noexcept {
+    node.size = SizeOf(node.left.get()) + node.count + SizeOf(node.right.get());
+    node.node_count = NodeCountOf(node.left.get()) + 1 + NodeCountOf(node.right.get());
+    node.sum = SumOf(node.left.get()) + node.extent * node.count + SumOf(node.right.get());
+}
+
+
+std::unique_ptr<ListItemHeightIndex::Node> ListItemHeightIndex::Build(
+    const float* extents,
+    std::size_t count) {
+
+    if (count == 0) {
+        return nullptr;
+    }
+
+    auto middle = count / 2;
+
+    auto node = std::make_unique<Node>();
+    node->extent = extents[middle];
+    node->left = Build(extents, middle);
+    node->right = Build(extents + middle + 1, count - middle - 1);
+    UpdateNode(*node);
+    return node;
+}
+
+
+std::unique_ptr<ListItemHeightIndex::Node> ListItemHeightIndex::BuildRun(
+    std::size_t count,
+    float extent) {
+
+    if (count == 0) {
+        return nullptr;
+    }
+
+    auto node = std::make_unique<Node>();
+    node->extent = extent;
+    node->count = count;
+    UpdateNode(*node);
+    return node;
+}
+
+
+std::pair<std::unique_ptr<ListItemHeightIndex::Node>, std::unique_ptr<ListItemHeightIndex::Node>>
+    ListItemHeightIndex::Split(
+        std::unique_ptr<Node> node,
+        std::size_t count,
+        std::unique_ptr<Node>& spare_node) noexcept {
+
+    if (!node) {
+        return {};
+    }
+
+    auto left_size = SizeOf(node->left.get());
+    if (count <= left_size) {
+        auto [left, right] = Split(std::move(node->left), count, spare_node);
+        node->left = std::move(right);
+        UpdateNode(*node);
+        return { std::move(left), std::move(node) };
+    }
+
+    if (count < left_size + node->count) {
+
+        //Split the run into two nodes, the latter one takes the right subtree.
+        auto latter_node = std::move(spare_node);
+        latter_node->extent = node->extent;
+        latter_node->count = left_size + node->count - count;
+        latter_node->right = std::move(node->right);
+        UpdateNode(*latter_node);
+
+        node->count -= latter_node->count;
+        UpdateNode(*node);
+        return { std::move(node), std::move(latter_node) };
+    }
+
+    auto [left, right] = Split(std::move(node->right), count - left_size - node->count, spare_node);
+    node->right = std::move(left);
+    UpdateNode(*node);
+    return { std::move(node), std::move(right) };
+}
+
+
+std::unique_ptr<ListItemHeightIndex::Node> ListItemHeightIndex::Merge(
+    std::unique_ptr<Node> node1,
+    std::unique_ptr<Node> node2) noexcept {
+
+    if (!node1) {
+        return node2;
+    }
+
+    if (!node2) {
+        return node1;
+    }
+
+    //Choose the root randomly in proportion to the numbers of nodes in subtrees, which keeps the
+    //tree balanced in expectation without storing priorities, so that subtrees built by Build()
+    //can be merged directly.
+    auto total_node_count = node1->node_count + node2->node_count;
+    if (GenerateRandom() % total_node_count < node1->node_count) {
+        node1->right = Merge(std::move(node1->right), std::move(node2));
+        UpdateNode(*node1);
+        return node1;
+    }
+
+    node2->left = Merge(std::move(node1), std::move(node2->left));
+    UpdateNode(*node2);
+    return node2;
+}
+
+
+std::uint32_t ListItemHeightIndex::GenerateRandom() noexcept {
+    //xorshift32
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    return random_state_;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <zaf/base/non_copyable.h>
+
+namespace zaf::internal {
+
+/*
+Stores the extents of list items, each of which is the item height plus the item spacing, in a
+balanced tree with subtree sums. Item positions are the prefix sums of extents, they can be
+calculated, searched and modified in O(log n), without rewriting positions of following items.
+
+Continuous items with the same extent can be stored as a single run, so that a huge number of
+items with a default extent can be added in O(log n).
+*/
+class ListItemHeightIndex : NonCopyable {
+public:
+    ListItemHeightIndex();
+    ~ListItemHeightIndex();
+
+    ListItemHeightIndex(ListItemHeightIndex&&) noexcept;
+    ListItemHeightIndex& operator=(ListItemHeightIndex&&) noexcept;
+
+    std::size_t Count() const noexcept;
+
+    //The sum of all extents, in O(1).
+    float TotalExtent() const noexcept;
+
+    void Reset(const std::vector<float>& extents);
+    void Reset(std::size_t count, float extent);
+
+    void Insert(std::size_t index, const std::vector<float>& extents);
+    void Insert(std::size_t index, std::size_t count, float extent);
+    void Erase(std::size_t index, std::size_t count);
+
+    //Replaces the extents of items starting at the specified index.
+    void Update(std::size_t index, const std::vector<float>& extents);
+
+    //Gets the sum of extents of items before the specified index. The index can be Count(), in
+    //which case the total extent is returned.
+    float GetPosition(std::size_t index) const;
+    float GetExtent(std::size_t index) const;
+
+    /*
+    The following methods have the same semantics as std::upper_bound and std::lower_bound applied
+    to the sorted positions of all items, including the end position of the last item. That is,
+    the results are in the range [0, Count() + 1].
+    */
+    std::size_t UpperBound(float position) const noexcept;
+    std::size_t LowerBound(float position) const noexcept;
+
+private:
+    class Node;
+
+    static std::size_t SizeOf(const Node* node) noexcept;
+    static std::size_t NodeCountOf(const Node* node) noexcept;
+    static float SumOf(const Node* node) noexcept;
+    static void UpdateNode(Node& node) noexcept;
+
+    static std::unique_ptr<Node> Build(const float* extents, std::size_t count);
+    static std::unique_ptr<Node> BuildRun(std::size_t count, float extent);
+
+    /*
+    Splits the first specified number of items from the tree. A run may be split into two nodes,
+    in which case the spare node is used, so that splitting never fails.
+    */
+    static std::pair<std::unique_ptr<Node>, std::unique_ptr<Node>> Split(
+        std::unique_ptr<Node> node,
+        std::size_t count,
+        std::unique_ptr<Node>& spare_node) noexcept;
+
+    void InsertSubtree(std::size_t index, std::unique_ptr<Node> subtree);
+
+    std::unique_ptr<Node> Merge(std::unique_ptr<Node> node1, std::unique_ptr<Node> node2) noexcept;
+
+    const Node& GetNode(std::size_t index) const;
+    std::size_t CountItemsEndBefore(float position, bool inclusive) const noexcept;
+
+    std::uint32_t GenerateRandom() noexcept;
+
+private:
+    std::unique_ptr<Node> root_;
+    std::uint32_t random_state_{ 2463534242 };
+};
+
+}
\ No newline at end of file
@@ -82,6 +82,14 @@ float ListItemHeightManager::GetTotalHeight() const {
 }
 
 
+bool ListItemHeightManager::MeasureItems(const Range& range) {
+    if (strategy_) {
+        return strategy_->MeasureItems(range);
+    }
+    return false;
+}
+
+
 void ListItemHeightManager::OnDataAdded(const ListDataAddedInfo& event_info) {
     if (strategy_) {
         strategy_->OnDataAdded(event_info);
@@ -30,6 +30,9 @@ public:
 
     float GetTotalHeight() const;
 
+    //Returns a value indicating whether any item height is changed.
+    bool MeasureItems(const Range& range);
+
     void OnDataAdded(const ListDataAddedInfo& event_info);
     void OnDataRemoved(const ListDataRemovedInfo& event_info);
     void OnDataUpdated(const ListDataUpdatedInfo& event_info);
@@ -17,6 +17,11 @@ void ListItemHeightStrategy::Initialize() {
 }
 
 
+bool ListItemHeightStrategy::MeasureItems(const Range& range) {
+    return false;
+}
+
+
 void ListItemHeightStrategy::OnDataAdded(const ListDataAddedInfo& event_info) {
 
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <zaf/base/non_copyable.h>
+#include <zaf/base/range.h>
 #include <zaf/control/list_control_delegate.h>
 #include <zaf/control/list_data_source.h>
 
@@ -26,6 +27,12 @@ public:
 
     virtual float GetTotalHeight() = 0;
 
+    /*
+    Estimates heights of items in the specified range that have not been estimated, if heights are
+    estimated lazily. Returns a value indicating whether any item height is changed.
+    */
+    virtual bool MeasureItems(const Range& range);
+
     virtual void OnDataAdded(const ListDataAddedInfo& event_info);
     virtual void OnDataUpdated(const ListDataUpdatedInfo& event_info);
     virtual void OnDataMoved(const ListDataMovedInfo& event_info);
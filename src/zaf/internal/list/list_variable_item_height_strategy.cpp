@@ -19,18 +19,18 @@ void ListVariableItemHeightStrategy::Initialize() {
     item_spacing_ = delegate->GetItemSpacing();
 
     auto data_count = data_source->GetDataCount();
-    item_positions_.reserve(data_count + 1);
 
-    float position = 0;
-    for (std::size_t index = 0; index < data_count; ++index) {
-
-        item_positions_.push_back(position);
-
-        auto item_data = data_source->GetDataAtIndex(index);
-        position += delegate->EstimateItemHeight(index, item_data) + item_spacing_;
+    //In lazy mode, all items have the default height until they are measured, so that neither
+    //item data nor item heights are retrieved here.
+    is_lazy_ = delegate->HasLazyItemHeight();
+    if (is_lazy_) {
+        default_item_extent_ = delegate->GetDefaultItemHeight() + item_spacing_;
+        item_height_index_.Reset(data_count, default_item_extent_);
+        return;
     }
 
-    item_positions_.push_back(position);
+    item_height_index_.Reset(
+        EstimateItemExtents(*data_source, *delegate, Range{ 0, data_count }));
 }
 
 
@@ -53,10 +53,10 @@ std::pair<float, float> ListVariableItemHeightStrategy::GetItemPositionAndHeight
 std::pair<float, float> ListVariableItemHeightStrategy::InnerGetItemPositionAndHeight(
     std::size_t index) const {
 
-    ZAF_EXPECT(index < item_positions_.size() - 1);
+    ZAF_EXPECT(index < item_height_index_.Count());
 
-    float position = item_positions_[index];
-    float height = item_positions_[index + 1] - position - item_spacing_;
+    float position = item_height_index_.GetPosition(index);
+    float height = item_height_index_.GetExtent(index) - item_spacing_;
 
     return std::make_pair(position, height);
 }
@@ -76,14 +76,13 @@ std::optional<std::size_t> ListVariableItemHeightStrategy::InnerGetItemIndex(
         return std::nullopt;
     }
 
-    auto iterator = std::upper_bound(item_positions_.begin(), item_positions_.end(), position);
-    if (iterator == item_positions_.begin() ||
-        iterator == item_positions_.end()) {
+    auto upper_bound = item_height_index_.UpperBound(position);
+    if (upper_bound == 0 ||
+        upper_bound > item_height_index_.Count()) {
         return std::nullopt;
     }
 
-    std::advance(iterator, -1);
-    std::size_t index = std::distance(item_positions_.begin(), iterator);
+    std::size_t index = upper_bound - 1;
 
     auto item_position_height = InnerGetItemPositionAndHeight(index);
     if (item_position_height.first + item_position_height.second <= position) {
@@ -117,14 +116,11 @@ std::pair<std::size_t, std::size_t> ListVariableItemHeightStrategy::GetItemRange
         return {};
     }
 
-    auto end_iterator = std::lower_bound(
-        item_positions_.begin(), 
-        item_positions_.end(),
-        end_position);
+    auto lower_bound = item_height_index_.LowerBound(end_position);
 
     std::size_t end_index{};
-    if (end_iterator != item_positions_.end()) {
-        end_index = std::distance(item_positions_.begin(), end_iterator);
+    if (lower_bound <= item_height_index_.Count()) {
+        end_index = lower_bound;
     }
     else {
         end_index = data_source->GetDataCount();
@@ -136,8 +132,8 @@ std::pair<std::size_t, std::size_t> ListVariableItemHeightStrategy::GetItemRange
 
 float ListVariableItemHeightStrategy::GetTotalHeight() {
 
-    if (item_positions_.size() > 1) {
-        return item_positions_.back() - item_spacing_;
+    if (item_height_index_.Count() > 0) {
+        return item_height_index_.TotalExtent() - item_spacing_;
     }
     else {
         return 0;
@@ -159,34 +155,18 @@ void ListVariableItemHeightStrategy::OnDataAdded(const ListDataAddedInfo& event_
         return;
     }
 
-    item_positions_.insert(
-        std::next(item_positions_.begin(), event_info.Index()),
-        event_info.Count(),
-        0);
-
-    auto old_item_index = event_info.Index() + event_info.Count();
-    float old_position = item_positions_[old_item_index];
-    float current_position = old_position;
-
-    //Set position for new items.
-    for (std::size_t current_index = event_info.Index();
-        current_index < old_item_index;
-        ++current_index) {
-
-        item_positions_[current_index] = current_position;
-
-        auto item_data = data_source->GetDataAtIndex(current_index);
-        current_position += delegate->EstimateItemHeight(current_index, item_data) + item_spacing_;
+    if (is_lazy_) {
+        item_height_index_.Insert(event_info.Index(), event_info.Count(), default_item_extent_);
+        measured_items_.InsertSpan(Range{ event_info.Index(), event_info.Count() });
+        return;
     }
 
-    //Update position for old items.
-    float position_increasement = current_position - old_position;
-    for (std::size_t current_index = old_item_index; 
-         current_index < item_positions_.size(); 
-         ++current_index) {
-
-        item_positions_[current_index] += position_increasement;
-    }
+    item_height_index_.Insert(
+        event_info.Index(),
+        EstimateItemExtents(
+            *data_source,
+            *delegate,
+            Range{ event_info.Index(), event_info.Count() }));
 }
 
 
@@ -202,6 +182,18 @@ void ListVariableItemHeightStrategy::OnDataMoved(const ListDataMovedInfo& event_
 
     __super::OnDataMoved(event_info);
 
+    //Move the measured state along with the item.
+    if (is_lazy_) {
+
+        bool is_measured = measured_items_.ContainsIndex(event_info.PreviousIndex());
+        measured_items_.EraseSpan(Range{ event_info.PreviousIndex(), 1 });
+        measured_items_.InsertSpan(Range{ event_info.NewIndex(), 1 });
+
+        if (is_measured) {
+            measured_items_.AddRange(Range{ event_info.NewIndex(), 1 });
+        }
+    }
+
     auto min_index = std::min(event_info.PreviousIndex(), event_info.NewIndex());
     auto max_index = std::max(event_info.PreviousIndex(), event_info.NewIndex());
 
@@ -221,29 +213,91 @@ void ListVariableItemHeightStrategy::UpdateItemHeightsInRange(const Range& range
         return;
     }
 
-    float position = item_positions_[range.Index()];
-    float previous_heights = item_positions_[range.EndIndex()] - position;
-    float current_heights = 0;
+    //In lazy mode, only items that have been measured are estimated again.
+    if (is_lazy_) {
+
+        std::vector<float> extents;
+        extents.reserve(range.Length());
+
+        for (auto index : range) {
+            if (measured_items_.ContainsIndex(index)) {
+                extents.push_back(EstimateItemExtent(*data_source, *delegate, index));
+            }
+            else {
+                extents.push_back(default_item_extent_);
+            }
+        }
+
+        item_height_index_.Update(range.Index(), extents);
+        return;
+    }
+
+    item_height_index_.Update(
+        range.Index(),
+        EstimateItemExtents(*data_source, *delegate, range));
+}
+
+
+bool ListVariableItemHeightStrategy::MeasureItems(const Range& range) {
+
+    if (!is_lazy_) {
+        return false;
+    }
+
+    auto data_source = DataSource();
+    if (!data_source) {
+        return false;
+    }
+
+    auto delegate = Delegate();
+    if (!delegate) {
+        return false;
+    }
+
+    bool has_changed{};
 
-    for (std::size_t current_index = range.Index();
-        current_index < range.EndIndex();
-        ++current_index) {
+    auto end_index = (std::min)(range.EndIndex(), item_height_index_.Count());
+    for (auto index = range.Index(); index < end_index; ++index) {
 
-        item_positions_[current_index] = position + current_heights;
+        if (measured_items_.ContainsIndex(index)) {
+            continue;
+        }
+
+        auto extent = EstimateItemExtent(*data_source, *delegate, index);
+        if (extent != item_height_index_.GetExtent(index)) {
+            item_height_index_.Update(index, { extent });
+            has_changed = true;
+        }
 
-        auto item_data = data_source->GetDataAtIndex(current_index);
-        float height = delegate->EstimateItemHeight(current_index, item_data);
-        current_heights += height + item_spacing_;
+        measured_items_.AddRange(Range{ index, 1 });
     }
 
-    float difference = current_heights - previous_heights;
+    return has_changed;
+}
+
+
+std::vector<float> ListVariableItemHeightStrategy::EstimateItemExtents(
+    ListDataSource& data_source,
+    ListControlDelegate& delegate,
+    const Range& range) const {
 
-    for (std::size_t current_index = range.EndIndex();
-        current_index < item_positions_.size();
-        ++current_index) {
+    std::vector<float> result;
+    result.reserve(range.Length());
 
-        item_positions_[current_index] += difference;
+    for (auto index : range) {
+        result.push_back(EstimateItemExtent(data_source, delegate, index));
     }
+    return result;
+}
+
+
+float ListVariableItemHeightStrategy::EstimateItemExtent(
+    ListDataSource& data_source,
+    ListControlDelegate& delegate,
+    std::size_t index) const {
+
+    auto item_data = data_source.GetDataAtIndex(index);
+    return delegate.EstimateItemHeight(index, item_data) + item_spacing_;
 }
 
 
@@ -251,17 +305,10 @@ void ListVariableItemHeightStrategy::OnDataRemoved(const ListDataRemovedInfo& ev
 
     __super::OnDataRemoved(event_info);
 
-    float position_decreasement =
-        item_positions_[event_info.Index() + event_info.Count()] -
-        item_positions_[event_info.Index()];
-
-    auto erase_iterator = std::next(item_positions_.begin(), event_info.Index());
-    auto remain_iterator = item_positions_.erase(
-        erase_iterator,
-        std::next(erase_iterator, event_info.Count()));
+    item_height_index_.Erase(event_info.Index(), event_info.Count());
 
-    for (; remain_iterator != item_positions_.end(); ++remain_iterator) {
-        *remain_iterator -= position_decreasement;
+    if (is_lazy_) {
+        measured_items_.EraseSpan(Range{ event_info.Index(), event_info.Count() });
     }
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <zaf/control/internal/range_set.h>
+#include <zaf/internal/list/list_item_height_index.h>
 #include <zaf/internal/list/list_item_height_strategy.h>
 
 namespace zaf::internal {
@@ -20,6 +22,8 @@ public:
 
     float GetTotalHeight() override;
 
+    bool MeasureItems(const Range& range) override;
+
     void OnDataAdded(const ListDataAddedInfo& event_info) override;
     void OnDataUpdated(const ListDataUpdatedInfo& event_info) override;
     void OnDataMoved(const ListDataMovedInfo& event_info) override;
@@ -30,9 +34,24 @@ private:
     std::optional<std::size_t> InnerGetItemIndex(float position, bool skip_spacing) const;
     void UpdateItemHeightsInRange(const Range& range);
 
+    std::vector<float> EstimateItemExtents(
+        ListDataSource& data_source,
+        ListControlDelegate& delegate,
+        const Range& range) const;
+
+    float EstimateItemExtent(
+        ListDataSource& data_source,
+        ListControlDelegate& delegate,
+        std::size_t index) const;
+
 private:
-    std::vector<float> item_positions_;
+    ListItemHeightIndex item_height_index_;
     float item_spacing_{};
+
+    //Lazy mode, in which items are measured only when they are about to be shown.
+    bool is_lazy_{};
+    float default_item_extent_{};
+    RangeSet measured_items_;
 };
 
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <zaf/internal/list/list_visible_item_manager.h>
+#include <zaf/base/auto_reset.h>
 #include <zaf/internal/list/list_core.h>
 #include <zaf/internal/list/list_control_parts_context.h>
 
@@ -285,8 +286,43 @@ void ListVisibleItemManager::HandleDataMoved(std::size_t previous_index, std::si
 }
 
 
+void ListVisibleItemManager::ResetVisibleItemRects() {
+
+    auto& item_height_manager = Parts().ItemHeightManager();
+    for (auto visible_index : Range{ 0, visible_items_.size() }) {
+
+        auto item_index = visible_index + first_visible_item_index_;
+        auto [position, height] = item_height_manager.GetItemPositionAndHeight(item_index);
+
+        const auto& item = visible_items_[visible_index];
+        auto rect = item->Rect();
+        rect.position.y = position;
+        rect.size.height = height;
+        item->SetRect(rect);
+    }
+}
+
+
 void ListVisibleItemManager::UpdateVisibleItems() {
 
+    //Measuring items may adjust the scroll position, which calls this method again. The reentering
+    //update is deferred until the current one is finished.
+    if (is_updating_visible_items_) {
+        has_pending_update_ = true;
+        return;
+    }
+
+    auto auto_reset = MakeAutoReset(is_updating_visible_items_, true);
+    do {
+        has_pending_update_ = false;
+        InnerUpdateVisibleItems();
+    }
+    while (has_pending_update_);
+}
+
+
+void ListVisibleItemManager::InnerUpdateVisibleItems() {
+
     std::size_t old_index = first_visible_item_index_;
     std::size_t old_count = visible_items_.size();
 
@@ -295,6 +331,19 @@ void ListVisibleItemManager::UpdateVisibleItems() {
     std::size_t new_count = 0;
     GetVisibleItemsRange(new_index, new_count);
 
+    //Measure items that are about to be shown if item heights are estimated lazily. Item
+    //positions change after measuring, so the range is calculated again until all items in it
+    //have been measured.
+    bool has_measured_items{};
+    while (Parts().Core().MeasureItems(Range{ new_index, new_count })) {
+        has_measured_items = true;
+        GetVisibleItemsRange(new_index, new_count);
+    }
+
+    if (has_measured_items) {
+        ResetVisibleItemRects();
+    }
+
     //Calculate the difference.
     bool remove_head = false;
     std::size_t head_change_count = 0;
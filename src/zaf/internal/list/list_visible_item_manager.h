@@ -40,6 +40,9 @@ private:
     void UpdateVisibleItemsByUpdatingItems(const Range& updated_range);
 
     void AdjustVisibleItemPositions(std::size_t begin_adjust_index, float difference);
+    void ResetVisibleItemRects();
+
+    void InnerUpdateVisibleItems();
 
     void GetVisibleItemsRange(std::size_t& index, std::size_t& count);
     void AdjustVisibleItems(
@@ -65,6 +68,9 @@ private:
 private:
     std::size_t first_visible_item_index_{};
     std::deque<std::shared_ptr<ListItem>> visible_items_;
+
+    bool is_updating_visible_items_{};
+    bool has_pending_update_{};
 };
 
 }
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <zaf/base/byte_array.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/io/stream/memory_stream_core.h>
+
+namespace zaf::internal {
+
+//A read-only stream core that shares its byte array with other owners, so that the content is
+//valid as long as any stream on it is alive.
+class SharedByteArrayStreamCore : public MemoryStreamCore {
+public:
+    explicit SharedByteArrayStreamCore(std::shared_ptr<const ByteArray> byte_array) :
+        byte_array_(std::move(byte_array)) {
+
+        ZAF_EXPECT(byte_array_);
+    }
+
+    bool CanWrite() noexcept override {
+        return false;
+    }
+
+    HRESULT GetInfo(std::byte** pointer, std::size_t* size) noexcept override {
+
+        if (pointer) {
+            *pointer = const_cast<std::byte*>(byte_array_->Data());
+        }
+
+        if (size) {
+            *size = byte_array_->Size();
+        }
+
+        return S_OK;
+    }
+
+    HRESULT Resize(std::size_t new_size) noexcept override {
+        return E_NOTIMPL;
+    }
+
+    std::unique_ptr<MemoryStreamCore> Clone() noexcept override {
+        try {
+            return std::make_unique<SharedByteArrayStreamCore>(byte_array_);
+        }
+        catch (...) {
+            return nullptr;
+        }
+    }
+
+private:
+    std::shared_ptr<const ByteArray> byte_array_;
+};
+
+}
\ No newline at end of file
@@ -50,6 +50,12 @@ TreeCore::TreeCore(ScrollBox& owner) : list_parts_(&owner) {
 }
 
 
+TreeCore::~TreeCore() {
+
+    CancelAllChildDataLoads();
+}
+
+
 void TreeCore::Initialize(const InitializeParameters& parameters) {
 
     InstallDataSource(parameters.data_source);
@@ -175,6 +181,8 @@ void TreeCore::Reload() {
 
 void TreeCore::ReloadRootNode() {
 
+    CancelAllChildDataLoads();
+
     tree_index_mapping_.Clear();
     tree_data_manager_.Clear();
 
@@ -484,6 +492,9 @@ bool TreeCore::ExpandItemUI(
         item_expand_event_(expanded_data);
     }
 
+    //Start loading after the expanded items are added to the list, as pages may be emitted
+    //immediately on subscribing.
+    StartChildDataLoads();
     return true;
 }
 
@@ -533,6 +544,14 @@ std::size_t TreeCore::ExpandItemRecursively(
     TreeNodeExpander& node_expander, 
     const IndexPath& node_index_path) {
 
+    //Expand the node without children, they will be added when they are loaded.
+    if (data_source.ShouldLoadChildDataAsync(node_expander.GetNodeData())) {
+
+        node_expander.SetAsyncLoading();
+        pending_child_data_loads_.push_back(node_expander.GetNodeData());
+        return 0;
+    }
+
     auto child_count = data_source.GetChildDataCount(node_expander.GetNodeData());
 
     //Expand the node with specified child count.
@@ -572,6 +591,108 @@ std::size_t TreeCore::ExpandItemRecursively(
 }
 
 
+void TreeCore::StartChildDataLoads() {
+
+    auto pending_loads = std::move(pending_child_data_loads_);
+    pending_child_data_loads_.clear();
+
+    auto data_source = data_source_.lock();
+    if (!data_source) {
+        return;
+    }
+
+    for (const auto& each_data : pending_loads) {
+
+        //Loading may have been finished if pages are emitted synchronously, so the subscription is
+        //recorded only if it is still alive.
+        auto subscription = data_source->LoadChildDataAsync(each_data).Subscribe(
+            [this, each_data](const std::vector<std::shared_ptr<Object>>& page) {
+                OnChildDataPageLoad(each_data, page);
+            },
+            [this, each_data](const std::exception_ptr&) {
+                child_data_loads_.erase(each_data);
+            },
+            [this, each_data]() {
+                child_data_loads_.erase(each_data);
+            });
+
+        if (!subscription->IsDisposed()) {
+            child_data_loads_[each_data] = std::move(subscription);
+        }
+    }
+}
+
+
+void TreeCore::OnChildDataPageLoad(
+    const std::shared_ptr<Object>& parent_data,
+    const std::vector<std::shared_ptr<Object>>& page) {
+
+    if (page.empty()) {
+        return;
+    }
+
+    auto parent_index_path = tree_data_manager_.GetIndexPathOfData(parent_data);
+    if (!parent_index_path) {
+        return;
+    }
+
+    auto parent_node = tree_data_manager_.GetNodeAtIndexPath(*parent_index_path);
+    auto children_adder = tree_data_manager_.AddChildrenAtIndexPath(*parent_index_path);
+    if (!parent_node || !children_adder) {
+        return;
+    }
+
+    //Pages are appended to loaded children.
+    auto child_index = parent_node->children.size();
+    children_adder->SetAddRange(child_index, page.size());
+
+    auto page_iterator = page.begin();
+    while (children_adder->MoveToNextChild()) {
+        children_adder->SetDataToCurrentChild(*page_iterator);
+        ++page_iterator;
+    }
+
+    //Get list index at which to insert new items.
+    auto list_index = GetChildListIndex(*parent_index_path, child_index);
+    if (list_index) {
+
+        //Add children to tree ui data.
+        tree_index_mapping_.AddChildren(*parent_index_path, child_index, page.size());
+
+        //Raise event, the list updates visible items if new items are in the visible range.
+        NotifyDataAdded(*list_index, page.size());
+    }
+}
+
+
+void TreeCore::CancelChildDataLoadsOfCollapsedItems() {
+
+    auto iterator = child_data_loads_.begin();
+    while (iterator != child_data_loads_.end()) {
+
+        if (tree_data_manager_.IsNodeExpanded(iterator->first)) {
+            ++iterator;
+            continue;
+        }
+
+        auto subscription = std::move(iterator->second);
+        iterator = child_data_loads_.erase(iterator);
+        subscription->Dispose();
+    }
+}
+
+
+void TreeCore::CancelAllChildDataLoads() {
+
+    auto loads = std::move(child_data_loads_);
+    child_data_loads_.clear();
+
+    for (const auto& each_pair : loads) {
+        each_pair.second->Dispose();
+    }
+}
+
+
 bool TreeCore::CollapseItemUI(
     const IndexPath& index_path,
     const std::optional<std::size_t>& list_index,
@@ -600,6 +721,8 @@ bool TreeCore::CollapseItemUI(
     auto removed_count = tree_index_mapping_.RemoveAllChildrenRecursively(index_path);
 
     auto collapse_result = tree_data_manager_.CollapseNode(tree_node->data);
+    CancelChildDataLoadsOfCollapsedItems();
+
     if (collapse_result.selection_changed) {
         NotifySelectionChange();
     }
@@ -688,7 +811,9 @@ void TreeCore::OnChangeExpandStateByArrowKeys(bool is_to_expand) {
             ExpandItemUI(index_path, selected_index, true);
         }
         else {
-            selected_index = GetChildListIndex(index_path, 0);
+            auto first_child_index_path = index_path;
+            first_child_index_path.push_back(0);
+            selected_index = tree_index_mapping_.GetIndexAtIndexPath(first_child_index_path);
             if (selected_index) {
                 auto& selection_manager = list_parts_.SelectionManager();
                 selection_manager.SelectItemAtIndex(*selected_index);
@@ -748,6 +873,8 @@ void TreeCore::CheckIfItemHasChildren(
 
     //Remove all children if the node doesn't have children after updating.
     auto collapse_node = tree_data_manager_.CollapseNodeWithoutReserveExpandState(tree_node->data);
+    CancelChildDataLoadsOfCollapsedItems();
+
     if (collapse_node.selection_changed) {
         NotifySelectionChange();
     }
@@ -890,7 +1017,12 @@ std::optional<std::size_t> TreeCore::GetChildListIndex(
 
     auto old_child_count = tree_index_mapping_.GetChildCount(parent_index_path);
     if (!old_child_count) {
-        return std::nullopt;
+
+        //Expanded items without children are not in the mapping.
+        if (!IsIndexPathExpanded(parent_index_path)) {
+            return std::nullopt;
+        }
+        old_child_count = 0;
     }
 
     //Child index must not exceed child count.
@@ -899,6 +1031,10 @@ std::optional<std::size_t> TreeCore::GetChildListIndex(
     //There is no child, get next index of parent's index.
     if (old_child_count == 0) {
 
+        if (parent_index_path.empty()) {
+            return 0;
+        }
+
         auto list_index = tree_index_mapping_.GetIndexAtIndexPath(parent_index_path);
         if (!list_index) {
             return std::nullopt;
@@ -947,6 +1083,8 @@ void TreeCore::OnDataRemove(const TreeDataSourceDataRemoveInfo& event_info) {
         event_info.index,
         event_info.count);
 
+    CancelChildDataLoadsOfCollapsedItems();
+
     //Get list index at which begin removing.
     auto child_index_path = *parent_index_path;
     child_index_path.push_back(event_info.index);
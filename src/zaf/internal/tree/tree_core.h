@@ -1,5 +1,6 @@
 #pragma once
 
+#include <unordered_map>
 #include <zaf/base/non_copyable.h>
 #include <zaf/internal/tree/tree_data_manager.h>
 #include <zaf/internal/tree/tree_index_mapping.h>
@@ -40,7 +41,7 @@ public:
 
 public:
     TreeCore(ScrollBox& owner);
-    ~TreeCore() = default;
+    ~TreeCore();
 
     ListControlPartsContext& ListParts() {
         return list_parts_;
@@ -123,6 +124,12 @@ private:
         TreeDataSource& data_source,
         TreeNodeExpander& node_expander,
         const IndexPath& node_index_path);
+    void StartChildDataLoads();
+    void OnChildDataPageLoad(
+        const std::shared_ptr<Object>& parent_data,
+        const std::vector<std::shared_ptr<Object>>& page);
+    void CancelChildDataLoadsOfCollapsedItems();
+    void CancelAllChildDataLoads();
     bool CollapseItemUI(
         const IndexPath& index_path,
         const std::optional<std::size_t>& list_index,
@@ -180,6 +187,16 @@ private:
     
     TreeIndexMapping tree_index_mapping_;
     TreeDataManager tree_data_manager_;
+
+    //Data whose children are going to be loaded asynchronously, after expanding is done.
+    std::vector<std::shared_ptr<Object>> pending_child_data_loads_;
+
+    std::unordered_map<
+        std::shared_ptr<Object>,
+        std::shared_ptr<rx::Disposable>,
+        TreeDataHash,
+        TreeDataEqual
+    > child_data_loads_;
 };
 
 }
\ No newline at end of file
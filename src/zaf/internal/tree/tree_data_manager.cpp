@@ -114,6 +114,21 @@ void TreeDataManager::ExpandNodeWithChildCount(TreeNode& node, std::size_t child
 }
 
 
+void TreeDataManager::ExpandNodeForAsyncLoading(TreeNode& node) {
+
+    ZAF_EXPECT(!node.is_expanded);
+
+    //Children will be loaded again, so the reserved ones are removed.
+    bool selection_changed{};
+    for (const auto& each_child : node.children) {
+        RemoveDataFromMapRecursively(each_child->data, selection_changed);
+    }
+
+    node.children.clear();
+    node.is_expanded = true;
+}
+
+
 void TreeDataManager::SetChildDataToNode(
     const std::shared_ptr<TreeNode>& parent_node,
     std::size_t index_in_parent,
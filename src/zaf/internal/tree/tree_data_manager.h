@@ -58,6 +58,7 @@ private:
     friend class TreeNodeExpander;
 
     void ExpandNodeWithChildCount(TreeNode& node, std::size_t child_count);
+    void ExpandNodeForAsyncLoading(TreeNode& node);
     void SetChildDataToNode(
         const std::shared_ptr<TreeNode>& parent_node, 
         std::size_t index_in_parent, 
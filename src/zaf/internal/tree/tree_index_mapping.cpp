@@ -1,506 +1,532 @@
 #include <zaf/internal/tree/tree_index_mapping.h>
 #include <zaf/base/error/precondition_error.h>
-#include <zaf/base/range.h>
-#include <zaf/internal/tree/utility.h>
 
 namespace zaf::internal {
-namespace {
 
-/*
-bool CurrentNodeChecker(const IndexPath& current_node, std::size_t current_index);
+class TreeIndexMapping::Node {
+public:
+    //Entries of children, which is null if there is no child.
+    std::unique_ptr<Entry> children;
+};
 
-bool CurrentNodeChildrenChecker(
-    const IndexPath& current_node, 
-    std::size_t current_index,
-    std::size_t child_count, 
-    std::size_t last_child_index);
 
-bool BackwardNodeChildrenChecker(
-    const IndexPath& backward_node, 
-    std::size_t current_index,
-    std::size_t child_count,
-    std::size_t last_child_index);
- */
-template<
-    typename CurrentNodeChecker, 
-    typename CurrentNodeChildrenChecker, 
-    typename BackwardNodeChildrenChecker
->
-void EnumerateNodes(
-    const std::vector<std::pair<IndexPath, std::size_t>>& node_child_count_pairs,
-    const CurrentNodeChecker& current_node_checker,
-    const CurrentNodeChildrenChecker& current_node_children_checker,
-    const BackwardNodeChildrenChecker& backward_node_children_checker) {
-
-    //Check children nodes in root node if there is only a root node.
-    if (node_child_count_pairs.size() == 1) {
-
-        std::size_t child_count = node_child_count_pairs.front().second;
-        std::size_t current_index = child_count - 1;
-        IndexPath current_node{ current_index };
-        current_node_checker(current_node, current_index);
-        return;
-    }
+class TreeIndexMapping::Entry {
+public:
+    //The number of children in the entry, it is 1 if the child is expanded.
+    std::size_t child_count{ 1 };
 
-    struct LevelInfo {
-        std::size_t children_count{};
-        std::size_t last_handled_child_index{};
-    };
+    //The expanded child, which is null if children in the entry are collapsed.
+    std::unique_ptr<Node> node;
 
-    std::vector<LevelInfo> level_infos;
-    std::vector<std::size_t> root_path;
-    std::size_t current_global_index{};
+    std::uint32_t priority{};
 
-    auto iterator = node_child_count_pairs.begin();
-    while (iterator != node_child_count_pairs.end()) {
+    //The number of children in the subtree.
+    std::size_t total_child_count{};
 
-        const auto& current_node_path = iterator->first;
-        if (current_node_path.empty()) {
+    //The number of visible nodes in the subtree, including the children and their descendants.
+    std::size_t total_visible_count{};
 
-            LevelInfo root_level_infos;
-            root_level_infos.children_count = iterator->second;
-            root_level_infos.last_handled_child_index = 0;
+    std::unique_ptr<Entry> left;
+    std::unique_ptr<Entry> right;
+};
 
-            level_infos.push_back(root_level_infos);
-            ++iterator;
-            continue;
-        }
 
-        //Calculate current global index
-        std::size_t current_node_index =
-            current_global_index +
-            (current_node_path.back() - level_infos.back().last_handled_child_index);
+TreeIndexMapping::TreeIndexMapping() = default;
 
-        //Check if current node is the expected one.
-        if (current_node_checker(current_node_path, current_node_index)) {
-            return;
-        }
+TreeIndexMapping::~TreeIndexMapping() = default;
 
-        auto next_iterator = std::next(iterator);
 
-        const auto& next_node_path =
-            next_iterator != node_child_count_pairs.end() ?
-            next_iterator->first :
-            root_path;
+IndexPath TreeIndexMapping::GetIndexPathAtIndex(std::size_t index) const {
 
-        //Next expanded node is child of current node.
-        if (next_node_path.size() > current_node_path.size()) {
+    if (index >= GetNodeCount()) {
+        return {};
+    }
 
-            level_infos.back().last_handled_child_index = current_node_path.back();
+    IndexPath result;
 
-            //Enter child node
-            LevelInfo level_info;
-            level_info.children_count = iterator->second;
-            level_info.last_handled_child_index = 0;
-            level_infos.push_back(level_info);
+    auto node = root_.get();
+    while (true) {
 
-            iterator = next_iterator;
+        //Find the entry which contains the visible node at the index.
+        std::size_t child_index{};
+        auto entry = node->children.get();
+        while (true) {
 
-            //Global index should increase 1 when entering next level.
-            current_global_index = current_node_index + 1;
-            continue;
+            auto left_visible_count = VisibleCountOf(entry->left.get());
+            if (index < left_visible_count) {
+                entry = entry->left.get();
+                continue;
+            }
+
+            index -= left_visible_count;
+            child_index += ChildCountOf(entry->left.get());
+
+            auto own_visible_count = OwnVisibleCountOf(*entry);
+            if (index < own_visible_count) {
+                break;
+            }
+
+            index -= own_visible_count;
+            child_index += entry->child_count;
+            entry = entry->right.get();
         }
 
-        //Next expanded node is not child of current node, 
-        //check children of current node.
-        //Increase 1 to global index implicitly.
-        auto last_child_global_index = current_node_index + iterator->second;
-        if (current_node_children_checker(
-            current_node_path, 
-            current_node_index,
-            iterator->second, 
-            last_child_global_index)) {
-            return;
+        //Children in the entry are collapsed, each of them is a single visible node.
+        if (!entry->node) {
+            result.push_back(child_index + index);
+            return result;
         }
 
-        //Finish checking children, return to current level.
-        //Global index should decrease 1 when returning, in order to balance the increasement 
-        //when entering the child level
-        current_global_index = (last_child_global_index - 1) + 1;
+        result.push_back(child_index);
+        if (index == 0) {
+            return result;
+        }
 
-        level_infos.back().last_handled_child_index = current_node_path.back();
+        //Enter the expanded child, skipping the child itself.
+        index -= 1;
+        node = entry->node.get();
+    }
+}
 
-        if (next_node_path.size() < current_node_path.size()) {
 
-            auto backward_node_path = current_node_path;
-            while (backward_node_path.size() > next_node_path.size()) {
+std::optional<std::size_t> TreeIndexMapping::GetIndexAtIndexPath(const IndexPath& path) const {
 
-                std::size_t last_child_index =
-                    (level_infos.back().children_count - backward_node_path.back()) - 1 +
-                    current_global_index;
+    if (path.empty()) {
+        return std::nullopt;
+    }
 
-                //Check remain children in current level.
-                if (backward_node_children_checker(
-                    backward_node_path, 
-                    current_global_index,
-                    level_infos.back().children_count,
-                    last_child_index)) {
-                    return;
-                }
+    std::size_t result{};
 
-                //Return to previous level.
-                current_global_index = (last_child_index - 1) + 1;
+    auto node = root_.get();
+    for (std::size_t level = 0; level < path.size(); ++level) {
 
-                backward_node_path.pop_back();
-                level_infos.pop_back();
-            }
+        auto child_index = path[level];
+        if (!node || child_index >= ChildCountOf(node->children.get())) {
+            return std::nullopt;
         }
 
-        //Enter next expaned node
-        iterator = next_iterator;
+        std::size_t child_index_in_entry{};
+        std::size_t visible_count_before{};
+        const auto& entry = FindEntry(
+            node->children.get(),
+            child_index,
+            child_index_in_entry,
+            visible_count_before,
+            nullptr);
+
+        result += visible_count_before + child_index_in_entry;
+
+        //Global index should increase 1 when entering next level.
+        if (level != path.size() - 1) {
+            result += 1;
+            node = entry.node.get();
+        }
     }
+
+    return result;
 }
 
 
-bool IsGreaterOrEqualInSameParent(const IndexPath& path1, const IndexPath& path2) {
+std::size_t TreeIndexMapping::GetNodeCount() const {
+    return root_ ? VisibleCountOf(root_->children.get()) : 0;
+}
 
-    if (path1.size() != path2.size()) {
-        return false;
-    }
 
-    for (auto index : Range(0, path1.size() - 1)) {
-        if (path1[index] != path2[index]) {
-            return false;
-        }
+std::optional<std::size_t> TreeIndexMapping::GetChildCount(const IndexPath& parent) const {
+
+    auto node = FindNode(parent, nullptr);
+    if (!node) {
+        return std::nullopt;
     }
 
-    return path1.back() >= path2.back();
+    return ChildCountOf(node->children.get());
 }
 
-}
 
+std::optional<std::size_t> TreeIndexMapping::GetChildCountRecursively(const IndexPath& parent) const {
 
-IndexPath TreeIndexMapping::GetIndexPathAtIndex(std::size_t index) const {
+    auto node = FindNode(parent, nullptr);
+    if (!node) {
+        return std::nullopt;
+    }
 
-    IndexPath result{};
+    return VisibleCountOf(node->children.get());
+}
 
-    EnumerateNodes(
-        node_child_count_pairs,
-        [index, &result](const IndexPath& current_node, std::size_t current_index) {
 
-            if (current_index >= index) {
-                result = current_node;
-                result.back() -= current_index - index;
-                return true;
-            }
-            return false;
-        },
-        [index, &result](
-            const IndexPath& current_node, 
-            std::size_t current_index,
-            std::size_t child_count,
-            std::size_t last_child_index) {
-
-            if (last_child_index >= index) {
-                result = current_node;
-                result.push_back(index - current_index - 1);
-                return true;
-            }
-            return false;
-        },
-        [index, &result](
-            const IndexPath& backward_node,
-            std::size_t current_index,
-            std::size_t child_count,
-            std::size_t last_child_index) {
-
-            if (last_child_index >= index) {
-                result = backward_node;
-                result.back() += index - current_index;
-                return true;
-            }
-            return false;
-        }
-    );
+void TreeIndexMapping::AddChildren(const IndexPath& parent, std::size_t index, std::size_t count) {
 
-    return result;
-}
+    if (count == 0) {
+        return;
+    }
 
+    //Entries are created before splitting, so that the tree is unchanged if creation fails.
+    auto added_entry = CreateEntry(count, nullptr);
+    auto spare_entry1 = std::make_unique<Entry>();
+    auto spare_entry2 = std::make_unique<Entry>();
 
-std::optional<std::size_t> TreeIndexMapping::GetIndexAtIndexPath(const IndexPath& path) const {
+    std::vector<Entry*> search_path;
+    auto node = FindNode(parent, &search_path);
+    if (node) {
 
-    if (path.empty()) {
-        return std::nullopt;
+        //Check index.
+        ZAF_EXPECT(index <= ChildCountOf(node->children.get()));
+
+        auto [head, tail] = Split(std::move(node->children), index, spare_entry1);
+        node->children = Merge(Merge(std::move(head), std::move(added_entry)), std::move(tail));
     }
+    else {
 
-    std::optional<std::size_t> result;
+        //Insert new node, index must be 0.
+        ZAF_EXPECT(index == 0);
 
-    EnumerateNodes(
-        node_child_count_pairs,
-        [&path, &result](const IndexPath& current_node, std::size_t current_index) {
+        auto new_node = std::make_unique<Node>();
+        new_node->children = std::move(added_entry);
 
-            if (IsGreaterOrEqualInSameParent(current_node, path)) {
-                result = current_index - (current_node.back() - path.back());
-                return true;
-            }
-            return false;
-        },
-        [&path, &result](
-            const IndexPath& current_node,
-            std::size_t current_index,
-            std::size_t child_count,
-            std::size_t last_child_index) {
-
-            auto last_child_node_path = current_node;
-            last_child_node_path.push_back(child_count - 1);
-            if (IsGreaterOrEqualInSameParent(last_child_node_path, path)) {
-
-                result = last_child_index - (last_child_node_path.back() - path.back());
-                return true;
-            }
-            return false;
-        },
-        [&path, &result](
-            const IndexPath& backward_node,
-            std::size_t current_index,
-            std::size_t child_count,
-            std::size_t last_child_index) {
-
-            auto last_child_node_path = backward_node;
-            last_child_node_path.back() = child_count - 1;
-
-            if (IsGreaterOrEqualInSameParent(last_child_node_path, path)) {
-                result = last_child_index - (last_child_node_path.back() - path.back());
-                return true;
-            }
-            return false;
+        if (parent.empty()) {
+            root_ = std::move(new_node);
+            return;
         }
-    );
 
-    return result;
-}
+        //Ensure parent's parent is in the tree.
+        auto grand_parent = parent;
+        grand_parent.pop_back();
 
+        search_path.clear();
+        auto grand_parent_node = FindNode(grand_parent, &search_path);
+        ZAF_EXPECT(grand_parent_node);
+        ZAF_EXPECT(parent.back() < ChildCountOf(grand_parent_node->children.get()));
 
-std::size_t TreeIndexMapping::GetNodeCount() const {
+        //Replace the collapsed child with the expanded one.
+        auto expanded_entry = CreateEntry(1, std::move(new_node));
 
-    std::size_t result{};
-    for (const auto each_pair : node_child_count_pairs) {
-        result += each_pair.second;
+        auto [head, rest] = Split(
+            std::move(grand_parent_node->children),
+            parent.back(),
+            spare_entry1);
+
+        auto [collapsed, tail] = Split(std::move(rest), 1, spare_entry2);
+
+        grand_parent_node->children = Merge(
+            Merge(std::move(head), std::move(expanded_entry)),
+            std::move(tail));
     }
-    return result;
+
+    UpdateSearchPath(search_path);
 }
 
 
-std::optional<std::size_t> TreeIndexMapping::GetChildCount(const IndexPath& parent) const {
+std::size_t TreeIndexMapping::RemoveChildren(const IndexPath& parent, std::size_t index, std::size_t count) {
 
-    auto iterator = std::lower_bound(
-        node_child_count_pairs.begin(), 
-        node_child_count_pairs.end(), 
-        parent, 
-        [](const auto& pair, const auto& index_path) {
-    
-        return pair.first < index_path;
-    });
-
-    if (iterator == node_child_count_pairs.end() ||
-        iterator->first != parent) {
-        return std::nullopt;
+    if (count == 0) {
+        return 0;
     }
 
-    return iterator->second;
-}
+    std::vector<Entry*> search_path;
+    auto node = FindNode(parent, &search_path);
+    if (!node) {
+        return 0;
+    }
+
+    //Check index and count.
+    auto child_count = ChildCountOf(node->children.get());
+    if (index >= child_count || index + count > child_count) {
+        return 0;
+    }
 
+    auto spare_entry1 = std::make_unique<Entry>();
+    auto spare_entry2 = std::make_unique<Entry>();
 
-std::optional<std::size_t> TreeIndexMapping::GetChildCountRecursively(const IndexPath& parent) const {
+    auto [head, rest] = Split(std::move(node->children), index, spare_entry1);
+    auto [removed, tail] = Split(std::move(rest), count, spare_entry2);
+    node->children = Merge(std::move(head), std::move(tail));
 
-    auto iterator = std::lower_bound(
-        node_child_count_pairs.begin(),
-        node_child_count_pairs.end(),
-        parent,
-        [](const auto& pair, const auto& index_path) {
-            return pair.first < index_path;
-        }
-    );
+    //Removed children and their descendants are all removed.
+    auto remove_count = VisibleCountOf(removed.get());
 
-    if (iterator == node_child_count_pairs.end() ||
-        iterator->first != parent) {
-        return std::nullopt;
+    //Remove current node if there is no child.
+    if (!node->children) {
+        RemoveNode(parent, search_path);
     }
 
-    std::size_t child_count = iterator->second;
+    UpdateSearchPath(search_path);
 
-    for (++iterator; iterator != node_child_count_pairs.end(); ++iterator) {
+    return remove_count;
+}
 
-        if (!IsAncestorOf(parent, iterator->first)) {
-            break;
-        }
 
-        child_count += iterator->second;
+std::size_t TreeIndexMapping::RemoveAllChildrenRecursively(const IndexPath& parent) {
+
+    std::vector<Entry*> search_path;
+    auto node = FindNode(parent, &search_path);
+    if (!node) {
+        return 0;
     }
 
-    return child_count;
+    auto removed_count = VisibleCountOf(node->children.get());
+    RemoveNode(parent, search_path);
+
+    UpdateSearchPath(search_path);
+
+    return removed_count;
 }
 
 
-void TreeIndexMapping::AddChildren(const IndexPath& parent, std::size_t index, std::size_t count) {
+void TreeIndexMapping::RemoveNode(const IndexPath& path, const std::vector<Entry*>& search_path) {
 
-    if (count == 0) {
+    if (path.empty()) {
+        root_.reset();
         return;
     }
 
-    bool has_added{};
+    //The last entry on the search path is the one of the node, it becomes a collapsed child.
+    search_path.back()->node.reset();
+}
 
-    for (auto iterator = node_child_count_pairs.begin(); 
-         iterator != node_child_count_pairs.end(); 
-         ++iterator) {
 
-        auto& current_path = iterator->first;
-        if (current_path < parent) {
-            continue;
-        }
+void TreeIndexMapping::Clear() {
+
+    root_.reset();
+}
+
+
+std::vector<std::pair<IndexPath, std::size_t>> TreeIndexMapping::GetNodeChildCountPairs() const {
 
-        if (current_path == parent) {
+    std::vector<std::pair<IndexPath, std::size_t>> result;
+    if (root_) {
 
-            //Check index.
-            ZAF_EXPECT(index <= iterator->second);
+        IndexPath path;
+        GetNodeChildCountPairs(*root_, path, result);
+    }
+    return result;
+}
 
-            //Increase children count.
-            iterator->second += count;
 
-            has_added = true;
+void TreeIndexMapping::GetNodeChildCountPairs(
+    const Node& node,
+    IndexPath& path,
+    std::vector<std::pair<IndexPath, std::size_t>>& result) {
+
+    result.emplace_back(path, ChildCountOf(node.children.get()));
+
+    //Visit entries in order.
+    std::vector<const Entry*> stack;
+    std::size_t child_index{};
+    const Entry* entry = node.children.get();
+    while (entry || !stack.empty()) {
+
+        if (entry) {
+            stack.push_back(entry);
+            entry = entry->left.get();
             continue;
         }
 
-        if (has_added) {
-        
-            if (IsAncestorOf(parent, current_path)) {
-        
-                //Update children's index path.
-                auto& child_index = current_path[parent.size()];
-                if (child_index >= index) {
-                    child_index += count;
-                }
-            }
+        entry = stack.back();
+        stack.pop_back();
+
+        if (entry->node) {
+            path.push_back(child_index);
+            GetNodeChildCountPairs(*entry->node, path, result);
+            path.pop_back();
         }
-        else {
 
-            if (!IsAncestorOf(parent, current_path)) {
+        child_index += entry->child_count;
+        entry = entry->right.get();
+    }
+}
+
 
-                //Insert new node, index must be 0.
-                ZAF_EXPECT(index == 0);
+TreeIndexMapping::Node* TreeIndexMapping::FindNode(
+    const IndexPath& path,
+    std::vector<Entry*>* search_path) const {
 
-                node_child_count_pairs.insert(iterator, std::make_pair(parent, count));
-                return;
-            }
+    auto node = root_.get();
+    for (auto child_index : path) {
+
+        if (!node || child_index >= ChildCountOf(node->children.get())) {
+            return nullptr;
         }
-    }
 
-    if (!has_added) {
-        node_child_count_pairs.push_back(std::make_pair(parent, count));
-    }
+        std::size_t child_index_in_entry{};
+        std::size_t visible_count_before{};
+        auto& entry = FindEntry(
+            node->children.get(),
+            child_index,
+            child_index_in_entry,
+            visible_count_before,
+            search_path);
 
-#ifndef NDEBUG
-    //Ensure parent's parent is in the tree.
-    if (parent.empty()) {
-        return;
+        node = entry.node.get();
     }
+    return node;
+}
 
-    auto grand_parent = parent;
-    grand_parent.pop_back();
 
-    for (const auto& each_pair : node_child_count_pairs) {
-        if (each_pair.first == grand_parent) {
-            return;
+TreeIndexMapping::Entry& TreeIndexMapping::FindEntry(
+    Entry* root,
+    std::size_t child_index,
+    std::size_t& child_index_in_entry,
+    std::size_t& visible_count_before,
+    std::vector<Entry*>* search_path) {
+
+    ZAF_EXPECT(child_index < ChildCountOf(root));
+
+    visible_count_before = 0;
+
+    auto entry = root;
+    while (true) {
+
+        if (search_path) {
+            search_path->push_back(entry);
+        }
+
+        auto left_child_count = ChildCountOf(entry->left.get());
+        if (child_index < left_child_count) {
+            entry = entry->left.get();
+        }
+        else if (child_index < left_child_count + entry->child_count) {
+            visible_count_before += VisibleCountOf(entry->left.get());
+            child_index_in_entry = child_index - left_child_count;
+            return *entry;
+        }
+        else {
+            visible_count_before += VisibleCountOf(entry->left.get()) + OwnVisibleCountOf(*entry);
+            child_index -= left_child_count + entry->child_count;
+            entry = entry->right.get();
         }
     }
-    ZAF_EXPECT(false);
-#endif
 }
 
 
-std::size_t TreeIndexMapping::RemoveChildren(const IndexPath& parent, std::size_t index, std::size_t count) {
+void TreeIndexMapping::UpdateSearchPath(const std::vector<Entry*>& search_path) noexcept {
 
-    if (count == 0) {
-        return 0;
+    //Update entries from bottom to top.
+    for (auto iterator = search_path.rbegin(); iterator != search_path.rend(); ++iterator) {
+        UpdateEntry(**iterator);
     }
+}
 
-    std::size_t remove_count{};
-
-    auto iterator = node_child_count_pairs.begin();
-    while (iterator != node_child_count_pairs.end()) {
 
-        auto& current_path = iterator->first;
-        if (current_path < parent) {
-            ++iterator;
-            continue;
-        }
+std::size_t TreeIndexMapping::ChildCountOf(const Entry* entry) noexcept {
+    return entry ? entry->total_child_count : 0;
+}
 
-        if (current_path == parent) {
 
-            //Check index and count.
-            if (index >= iterator->second || index + count > iterator->second) {
-                break;
-            }
+std::size_t TreeIndexMapping::VisibleCountOf(const Entry* entry) noexcept {
+    return entry ? entry->total_visible_count : 0;
+}
 
-            //Decrease children count.
-            iterator->second -= count;
-            remove_count += count;
 
-            //Remove current node if there is no child.
-            if (iterator->second == 0) {
-                iterator = node_child_count_pairs.erase(iterator);
-            }
-            else {
-                ++iterator;
-            }
-            continue;
-        }
+std::size_t TreeIndexMapping::OwnVisibleCountOf(const Entry& entry) noexcept {
 
-        if (!IsAncestorOf(parent, current_path)) {
-            break;
-        }
+    if (entry.node) {
+        return 1 + VisibleCountOf(entry.node->children.get());
+    }
+    return entry.child_count;
+}
 
-        auto& child_index = current_path[parent.size()];
 
-        //Remove children if it is removed.
-        if (index <= child_index && child_index < index + count) {
-            remove_count += iterator->second;
-            iterator = node_child_count_pairs.erase(iterator);
-            continue;
-        }
+void TreeIndexMapping::UpdateEntry(Entry& entry) noexcept {
 
-        //Update children's index path.
-        if (child_index >= index + count) {
-            child_index -= count;
-        }
-        ++iterator;
-    }
+    entry.total_child_count =
+        ChildCountOf(entry.left.get()) +
+        entry.child_count +
+        ChildCountOf(entry.right.get());
 
-    return remove_count;
+    entry.total_visible_count =
+        VisibleCountOf(entry.left.get()) +
+        OwnVisibleCountOf(entry) +
+        VisibleCountOf(entry.right.get());
 }
 
 
-std::size_t TreeIndexMapping::RemoveAllChildrenRecursively(const IndexPath& parent) {
+std::pair<std::unique_ptr<TreeIndexMapping::Entry>, std::unique_ptr<TreeIndexMapping::Entry>>
+    TreeIndexMapping::Split(
+        std::unique_ptr<Entry> entry,
+        std::size_t child_count,
+        std::unique_ptr<Entry>& spare_entry) noexcept {
 
-    std::size_t removed_count{};
+    if (!entry) {
+        return {};
+    }
 
-    auto iterator = node_child_count_pairs.begin();
-    while (iterator != node_child_count_pairs.end()) {
+    auto left_child_count = ChildCountOf(entry->left.get());
+    if (child_count <= left_child_count) {
+        auto [left, right] = Split(std::move(entry->left), child_count, spare_entry);
+        entry->left = std::move(right);
+        UpdateEntry(*entry);
+        return { std::move(left), std::move(entry) };
+    }
 
-        const auto& current_path = iterator->first;
-        if (current_path < parent) {
-            ++iterator;
-            continue;
-        }
+    if (child_count < left_child_count + entry->child_count) {
 
-        if (current_path == parent || 
-            IsAncestorOf(parent, current_path)) {
+        //Split collapsed children into two entries, the latter one takes the right subtree. An
+        //expanded child is never split as there is only one child in its entry.
+        auto latter_entry = std::move(spare_entry);
+        latter_entry->child_count = left_child_count + entry->child_count - child_count;
+        latter_entry->priority = entry->priority;
+        latter_entry->right = std::move(entry->right);
+        UpdateEntry(*latter_entry);
 
-            removed_count += iterator->second;
-            iterator = node_child_count_pairs.erase(iterator);
-            continue;
-        }
+        entry->child_count -= latter_entry->child_count;
+        UpdateEntry(*entry);
+        return { std::move(entry), std::move(latter_entry) };
+    }
 
-        break;
-    };
+    auto [left, right] = Split(
+        std::move(entry->right),
+        child_count - left_child_count - entry->child_count,
+        spare_entry);
 
-    return removed_count;
+    entry->right = std::move(left);
+    UpdateEntry(*entry);
+    return { std::move(entry), std::move(right) };
 }
 
 
-void TreeIndexMapping::Clear() {
+std::unique_ptr<TreeIndexMapping::Entry> TreeIndexMapping::CreateEntry(
+    std::size_t child_count,
+    std::unique_ptr<Node> node) {
+
+    auto entry = std::make_unique<Entry>();
+    entry->child_count = child_count;
+    entry->node = std::move(node);
+    entry->priority = GenerateRandom();
+    UpdateEntry(*entry);
+    return entry;
+}
+
+
+std::unique_ptr<TreeIndexMapping::Entry> TreeIndexMapping::Merge(
+    std::unique_ptr<Entry> entry1,
+    std::unique_ptr<Entry> entry2) noexcept {
+
+    if (!entry1) {
+        return entry2;
+    }
+
+    if (!entry2) {
+        return entry1;
+    }
+
+    if (entry1->priority >= entry2->priority) {
+        entry1->right = Merge(std::move(entry1->right), std::move(entry2));
+        UpdateEntry(*entry1);
+        return entry1;
+    }
+
+    entry2->left = Merge(std::move(entry1), std::move(entry2->left));
+    UpdateEntry(*entry2);
+    return entry2;
+}
+
 
-    node_child_count_pairs.clear();
+std::uint32_t TreeIndexMapping::GenerateRandom() noexcept {
+    //xorshift32
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    return random_state_;
 }
 
 }
\ No newline at end of file
@@ -1,14 +1,26 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <vector>
 #include <zaf/base/define.h>
 
 namespace zaf::internal {
 
+/*
+Maps index paths of visible tree nodes to list indexes, and vice versa.
+
+Each expanded node stores its children in a balanced tree of entries, an entry is either a run of
+collapsed children or a single expanded child. Each entry caches the number of children and the
+number of visible nodes in its subtree, so that mapping between index paths and list indexes is
+O(depth * log fanout), and expanding or collapsing a node updates only the entries on the path
+from the root to the node.
+*/
 class TreeIndexMapping {
 public:
-    TreeIndexMapping() = default;
+    TreeIndexMapping();
+    ~TreeIndexMapping();
 
     TreeIndexMapping(const TreeIndexMapping&) = delete;
     TreeIndexMapping& operator=(const TreeIndexMapping&) = delete;
@@ -28,7 +40,53 @@ public:
     void Clear();
 
 public: //For unitest.
-    std::vector<std::pair<IndexPath, std::size_t>> node_child_count_pairs;
+    //Gets index paths and child counts of all expanded nodes, in pre-order.
+    std::vector<std::pair<IndexPath, std::size_t>> GetNodeChildCountPairs() const;
+
+private:
+    class Node;
+    class Entry;
+
+    static std::size_t ChildCountOf(const Entry* entry) noexcept;
+    static std::size_t VisibleCountOf(const Entry* entry) noexcept;
+    static std::size_t OwnVisibleCountOf(const Entry& entry) noexcept;
+    static void UpdateEntry(Entry& entry) noexcept;
+    static void UpdateSearchPath(const std::vector<Entry*>& search_path) noexcept;
+
+    static Entry& FindEntry(
+        Entry* root,
+        std::size_t child_index,
+        std::size_t& child_index_in_entry,
+        std::size_t& visible_count_before,
+        std::vector<Entry*>* search_path);
+
+    static std::pair<std::unique_ptr<Entry>, std::unique_ptr<Entry>> Split(
+        std::unique_ptr<Entry> entry,
+        std::size_t child_count,
+        std::unique_ptr<Entry>& spare_entry) noexcept;
+
+    static void GetNodeChildCountPairs(
+        const Node& node,
+        IndexPath& path,
+        std::vector<std::pair<IndexPath, std::size_t>>& result);
+
+    /*
+    Finds the expanded node at the specified path. Entries on the search path in ancestors of the
+    node are recorded, so that their caches can be updated after modifying the node.
+    */
+    Node* FindNode(const IndexPath& path, std::vector<Entry*>* search_path) const;
+
+    //Removes the expanded node at the specified path, which is found by FindNode().
+    void RemoveNode(const IndexPath& path, const std::vector<Entry*>& search_path);
+
+    std::unique_ptr<Entry> CreateEntry(std::size_t child_count, std::unique_ptr<Node> node);
+    std::unique_ptr<Entry> Merge(std::unique_ptr<Entry> entry1, std::unique_ptr<Entry> entry2) noexcept;
+
+    std::uint32_t GenerateRandom() noexcept;
+
+private:
+    std::unique_ptr<Node> root_;
+    std::uint32_t random_state_{ 2463534242 };
 };
 
 }
\ No newline at end of file
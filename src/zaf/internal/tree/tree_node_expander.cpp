@@ -22,6 +22,14 @@ void TreeNodeExpander::SetChildCount(std::size_t count) {
 }
 
 
+void TreeNodeExpander::SetAsyncLoading() {
+
+    ZAF_EXPECT(!current_child_index_);
+
+    tree_data_manager_.ExpandNodeForAsyncLoading(*tree_node_);
+}
+
+
 bool TreeNodeExpander::MoveToNextChild() {
 
     if (!current_child_index_) {
@@ -22,6 +22,9 @@ public:
 
     void SetChildCount(std::size_t count);
 
+    //Expands the node without children, children are added after they are loaded.
+    void SetAsyncLoading();
+
     bool MoveToNextChild();
     std::size_t GetCurrentChildIndex() const;
 
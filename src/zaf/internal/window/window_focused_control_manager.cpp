@@ -236,7 +236,7 @@ void WindowFocusedControlManager::BubbleFocusEvent(
 
         //Controls at the bubble path should update their styles to reflect the change of focus 
         //state. For example, parents may use ContainsFocus property for their styles.
-        sender->NeedUpdateStyle();
+        sender->NeedUpdateStyle(StyleInput::IsFocused);
         bubble_event_invoker(event_state, sender);
 
         //Stop event routing if there is reentrance.
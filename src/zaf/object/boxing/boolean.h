@@ -2,6 +2,7 @@
 
 #include <zaf/object/boxing/boolean_parser.h>
 #include <zaf/object/boxing/custom_boxing_traits.h>
+#include <zaf/object/boxing/internal/boxed_object_pool.h>
 #include <zaf/object/boxing/internal/boxed_represent.h>
 #include <zaf/object/object.h>
 
@@ -28,7 +29,7 @@ struct zaf__CustomBoxingTraits<bool> {
     using BoxedType = Boolean;
 
     static std::shared_ptr<Boolean> Box(bool value) {
-        return std::make_shared<Boolean>(value);
+        return std::allocate_shared<Boolean>(internal::PooledAllocator<Boolean>{}, value);
     }
 
     static const bool* Unbox(const Boolean& object) {
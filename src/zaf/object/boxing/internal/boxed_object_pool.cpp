@@ -0,0 +1,114 @@
+#include <zaf/object/boxing/internal/boxed_object_pool.h>
+#include <array>
+
+namespace zaf::internal {
+namespace {
+
+constexpr std::size_t SizeClassCount =
+    BoxedObjectPool::MaxBlockSize / BoxedObjectPool::BlockSizeGranularity;
+
+
+class ThreadBlockCache {
+public:
+    ThreadBlockCache() = default;
+
+    ThreadBlockCache(const ThreadBlockCache&) = delete;
+    ThreadBlockCache& operator=(const ThreadBlockCache&) = delete;
+
+    ~ThreadBlockCache();
+
+    void* Pop(std::size_t size_class) noexcept {
+
+        auto& free_list = free_lists_[size_class];
+        if (free_list.count == 0) {
+            return nullptr;
+        }
+
+        --free_list.count;
+        return free_list.blocks[free_list.count];
+    }
+
+    bool Push(std::size_t size_class, void* block) noexcept {
+
+        auto& free_list = free_lists_[size_class];
+        if (free_list.count == free_list.blocks.size()) {
+            return false;
+        }
+
+        free_list.blocks[free_list.count] = block;
+        ++free_list.count;
+        return true;
+    }
+
+private:
+    class FreeList {
+    public:
+        std::array<void*, BoxedObjectPool::MaxCachedBlockCount> blocks{};
+        std::size_t count{};
+    };
+
+private:
+    std::array<FreeList, SizeClassCount> free_lists_;
+};
+
+
+//Boxed objects may still be freed during thread exit after the cache is destroyed, for example
+//by destructors of other thread local objects. This flag is trivially destructible so that it is
+//always accessible.
+thread_local bool is_cache_destroyed{};
+
+thread_local ThreadBlockCache thread_cache;
+
+
+ThreadBlockCache::~ThreadBlockCache() {
+
+    is_cache_destroyed = true;
+
+    for (auto& each_list : free_lists_) {
+        for (std::size_t index = 0; index < each_list.count; ++index) {
+            ::operator delete(each_list.blocks[index]);
+        }
+        each_list.count = 0;
+    }
+}
+
+
+std::size_t GetSizeClass(std::size_t size) noexcept {
+    return (size - 1) / BoxedObjectPool::BlockSizeGranularity;
+}
+
+
+std::size_t GetBlockSize(std::size_t size_class) noexcept {
+    return (size_class + 1) * BoxedObjectPool::BlockSizeGranularity;
+}
+
+}
+
+void* BoxedObjectPool::Allocate(std::size_t size) {
+
+    auto size_class = GetSizeClass(size);
+    if (!is_cache_destroyed) {
+        auto block = thread_cache.Pop(size_class);
+        if (block) {
+            return block;
+        }
+    }
+
+    //Blocks are always allocated with the size of their size classes, so that they can be reused
+    //by objects of other sizes in the same class.
+    return ::operator new(GetBlockSize(size_class));
+}
+
+
+void BoxedObjectPool::Deallocate(void* block, std::size_t size) noexcept {
+
+    if (!is_cache_destroyed) {
+        if (thread_cache.Push(GetSizeClass(size), block)) {
+            return;
+        }
+    }
+
+    ::operator delete(block);
+}
+
+}
\ No newline at end of file
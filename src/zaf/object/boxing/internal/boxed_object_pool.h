@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace zaf::internal {
+
+/**
+Caches freed memory blocks of small boxed objects, so that boxing values repeatedly doesn't go to
+the heap each time.
+
+@details
+    Blocks are grouped into size classes, and each thread caches a limited number of blocks for
+    each class. A block can be freed in a thread other than the one allocating it.
+*/
+class BoxedObjectPool {
+public:
+    static constexpr std::size_t BlockSizeGranularity = 16;
+    static constexpr std::size_t MaxBlockSize = 128;
+    static constexpr std::size_t MaxCachedBlockCount = 128;
+
+public:
+    static void* Allocate(std::size_t size);
+    static void Deallocate(void* block, std::size_t size) noexcept;
+
+public:
+    BoxedObjectPool() = delete;
+};
+
+
+/**
+An allocator used with std::allocate_shared to allocate boxed objects from BoxedObjectPool.
+*/
+template<typename T>
+class PooledAllocator {
+public:
+    using value_type = T;
+
+public:
+    PooledAllocator() noexcept = default;
+
+    template<typename U>
+    PooledAllocator(const PooledAllocator<U>&) noexcept { }
+
+    T* allocate(std::size_t count) {
+
+        if (count == 1 &&
+            sizeof(T) <= BoxedObjectPool::MaxBlockSize &&
+            alignof(T) <= alignof(std::max_align_t)) {
+            return static_cast<T*>(BoxedObjectPool::Allocate(sizeof(T)));
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept {
+
+        if (count == 1 &&
+            sizeof(T) <= BoxedObjectPool::MaxBlockSize &&
+            alignof(T) <= alignof(std::max_align_t)) {
+            BoxedObjectPool::Deallocate(pointer, sizeof(T));
+            return;
+        }
+        ::operator delete(pointer);
+    }
+
+    template<typename U>
+    bool operator==(const PooledAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <zaf/object/boxing/custom_boxing_traits.h>
+#include <zaf/object/boxing/internal/boxed_object_pool.h>
 #include <zaf/object/boxing/internal/boxed_represent.h>
 #include <zaf/object/boxing/numeric_parser.h>
 #include <zaf/object/object.h>
@@ -24,7 +25,9 @@ template<>
 struct zaf__CustomBoxingTraits<NumericType> {                                                          \
     using BoxedType = BoxTypeName;                                                                \
     static std::shared_ptr<BoxedType> Box(NumericType value) {                                    \
-        return std::make_shared<BoxedType>(value);                                                \
+        return std::allocate_shared<BoxedType>(                                                   \
+            internal::PooledAllocator<BoxedType>{},                                               \
+            value);                                                                               \
     }                                                                                             \
     static const NumericType* Unbox(const BoxedType& object) {                                    \
         return &object.Value();                                                                   \
@@ -12,34 +12,18 @@ ReflectionManager& ReflectionManager::Instance() {
 
 void ReflectionManager::RegisterType(ObjectType* type) {
 
-    auto iterator = std::lower_bound(
-        types_.begin(), 
-        types_.end(),
-        type, 
-        [](auto type1, auto type2) {
-    
-        return type1->Name() < type2->Name();
-    });
-
-    types_.insert(iterator, type);
+    //The last registered type takes precedence if there are types with the same name.
+    types_.insert_or_assign(type->Name(), type);
 }
 
 
 ObjectType* ReflectionManager::GetType(std::wstring_view name) const noexcept {
 
-    auto iterator = std::lower_bound(
-        types_.begin(),
-        types_.end(),
-        name,
-        [](auto type, std::wstring_view name) {
-            return type->Name() < name;
-        });
-
-    if (iterator == types_.end() || (*iterator)->Name() != name) {
+    auto iterator = types_.find(name);
+    if (iterator == types_.end()) {
         return nullptr;
     }
-
-    return *iterator;
+    return iterator->second;
 }
 
 }
\ No newline at end of file
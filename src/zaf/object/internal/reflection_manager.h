@@ -1,6 +1,7 @@
 #pragma once
 
-#include <vector>
+#include <string_view>
+#include <unordered_map>
 
 namespace zaf {
 
@@ -24,7 +25,7 @@ private:
     ReflectionManager() = default;
 
 private:
-    std::vector<ObjectType*> types_;
+    std::unordered_map<std::wstring_view, ObjectType*> types_;
 };
 
 }
@@ -1,5 +1,6 @@
 #include <zaf/object/object_type.h>
 #include <zaf/base/container/utility/append.h>
+#include <zaf/base/error/precondition_error.h>
 #include <zaf/object/object_property.h>
 
 namespace zaf {
@@ -19,25 +20,6 @@ std::vector<ObjectProperty*> GetPropertiesInInheritanceChain(const ObjectType* t
     return result;
 }
 
-
-ObjectProperty* GetPropertyInInheritanceChain(
-    const ObjectType* type, 
-    std::wstring_view name) noexcept {
-
-    auto current_type = type;
-    while (current_type) {
-
-        auto property = current_type->GetNonInheritedProperty(name);
-        if (property) {
-            return property;
-        }
-
-        current_type = current_type->BaseType();
-    }
-
-    return nullptr;
-}
-
 }
 
 ObjectParser* ObjectType::Parser() const {
@@ -52,6 +34,8 @@ std::wstring_view ObjectType::ResourceURI() const noexcept {
 
 void ObjectType::RegisterProperty(ObjectProperty* property) {
 
+    ZAF_EXPECT(!is_property_registration_closed_);
+
     auto iterator = std::lower_bound(
         properties_.begin(),
         properties_.end(),
@@ -94,12 +78,39 @@ ObjectProperty* ObjectType::GetNonInheritedProperty(std::wstring_view name) cons
 
 
 ObjectProperty* ObjectType::GetInheritedProperty(std::wstring_view name) const noexcept{
-    return GetPropertyInInheritanceChain(BaseType(), name);
+
+    auto base_type = BaseType();
+    if (!base_type) {
+        return nullptr;
+    }
+    return base_type->GetProperty(name);
 }
 
 
 ObjectProperty* ObjectType::GetProperty(std::wstring_view name) const noexcept {
-    return GetPropertyInInheritanceChain(this, name);
+
+    std::call_once(property_table_once_flag_, [this]() {
+
+        //Properties of derived types are added first, so that they hide properties with the same
+        //names in base types.
+        auto current_type = this;
+        while (current_type) {
+
+            for (auto each_property : current_type->NonInheritedProperties()) {
+                property_table_.emplace(each_property->Name(), each_property);
+            }
+
+            //The table won't be updated if the type registers more properties later.
+            current_type->is_property_registration_closed_ = true;
+            current_type = current_type->BaseType();
+        }
+    });
+
+    auto iterator = property_table_.find(name);
+    if (iterator == property_table_.end()) {
+        return nullptr;
+    }
+    return iterator->second;
 }
 
 }
\ No newline at end of file
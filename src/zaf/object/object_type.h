@@ -1,9 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <zaf/base/non_copyable.h>
 #include <zaf/object/object_property.h>
@@ -119,8 +121,11 @@ public:
         The property with the specified name, or null if the property does not exist.
 
     @details
-        This function searches for the property from the most derived type to the base type,
-        following the inheritance chain.
+        If there are properties with the same name in the inheritance chain, the one in the most
+        derived type is returned.
+
+        This function looks up a hash table of all properties in the inheritance chain, which is
+        built on the first call, so it is O(1) regardless of the depth of the inheritance chain.
     */
     ObjectProperty* GetProperty(std::wstring_view name) const noexcept;
 
@@ -131,6 +136,16 @@ private:
 
 private:
     std::vector<ObjectProperty*> properties_;
+
+    //Properties in the inheritance chain indexed by names. It is built on the first lookup, as
+    //properties of base types might not have been registered when the type is constructed.
+    //Properties are registered during static initialization, before any lookup.
+    mutable std::once_flag property_table_once_flag_;
+    mutable std::unordered_map<std::wstring_view, ObjectProperty*> property_table_;
+
+    //Registering properties is not allowed once they are added to the property table of the type,
+    //or of any derived type, as the table won't contain the new ones.
+    mutable std::atomic<bool> is_property_registration_closed_{};
 };
 
 }
\ No newline at end of file
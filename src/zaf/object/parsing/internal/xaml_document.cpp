@@ -0,0 +1,68 @@
+#include <zaf/object/parsing/internal/xaml_document.h>
+
+namespace zaf::internal {
+
+//An allocator which allocates from the arena of a document, and shares the ownership of the
+//document, so that the arena is alive as long as any object allocated from it is alive.
+template<typename T>
+class XamlDocument::Allocator {
+public:
+    using value_type = T;
+
+public:
+    explicit Allocator(std::shared_ptr<XamlDocument> document) noexcept :
+        document_(std::move(document)) {
+
+    }
+
+    template<typename U>
+    Allocator(const Allocator<U>& other) noexcept : document_(other.document_) {
+
+    }
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(
+            document_->memory_resource_.allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept {
+        //Memory is freed together with the document.
+    }
+
+    template<typename U>
+    bool operator==(const Allocator<U>& other) const noexcept {
+        return document_ == other.document_;
+    }
+
+private:
+    template<typename U>
+    friend class Allocator;
+
+    std::shared_ptr<XamlDocument> document_;
+};
+
+
+XamlDocument::XamlDocument() : memory_resource_(InitialBufferSize) {
+
+}
+
+
+XamlDocument::~XamlDocument() = default;
+
+
+std::shared_ptr<XamlNode> XamlDocument::CreateNode() {
+    return std::allocate_shared<XamlNode>(Allocator<XamlNode>{ shared_from_this() });
+}
+
+
+std::shared_ptr<XamlAttribute> XamlDocument::CreateAttribute(
+    const std::wstring& name,
+    const std::wstring& value) {
+
+    return std::allocate_shared<XamlAttribute>(
+        Allocator<XamlAttribute>{ shared_from_this() },
+        name,
+        value);
+}
+
+}
\ No newline at end of file
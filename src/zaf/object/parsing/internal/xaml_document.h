@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <zaf/base/non_copyable.h>
+#include <zaf/object/parsing/xaml_node.h>
+
+namespace zaf::internal {
+
+/**
+An arena in which node and attribute objects of a XAML document are allocated.
+
+@details
+    Memory is allocated from a bump allocator and is freed all at once when the document is
+    destroyed. Nodes and attributes created by the document are owning shared pointers whose
+    control blocks are allocated in the arena as well, each of them keeps the document alive, so
+    they remain valid even if they outlive other nodes of the document. Holding the document costs
+    a reference count update for each node and attribute.
+
+    Only the node and attribute objects come from the arena. Their names, values and child lists
+    are std::wstring and std::vector exposed by XamlNode and XamlAttribute, so their contents are
+    still allocated on the heap.
+*/
+class XamlDocument : public std::enable_shared_from_this<XamlDocument>, NonCopyableNonMovable {
+public:
+    XamlDocument();
+    ~XamlDocument();
+
+    std::shared_ptr<XamlNode> CreateNode();
+    std::shared_ptr<XamlAttribute> CreateAttribute(
+        const std::wstring& name,
+        const std::wstring& value);
+
+private:
+    template<typename T>
+    class Allocator;
+
+    static constexpr std::size_t InitialBufferSize = 16 * 1024;
+
+private:
+    std::pmr::monotonic_buffer_resource memory_resource_;
+};
+
+}
\ No newline at end of file
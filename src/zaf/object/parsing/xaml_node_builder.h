@@ -1,5 +1,6 @@
 #pragma once
 
+#include <zaf/object/parsing/internal/xaml_document.h>
 #include <zaf/object/parsing/xaml_node.h>
 
 namespace zaf {
@@ -10,6 +11,13 @@ public:
 
     }
 
+    //Builds a node in the specified document, as well as its attributes.
+    explicit XamlNodeBuilder(internal::XamlDocument& document) :
+        document_(&document),
+        node_(document.CreateNode()) {
+
+    }
+
     ~XamlNodeBuilder() = default;
 
     XamlNodeBuilder(const XamlNodeBuilder&) = delete;
@@ -24,7 +32,10 @@ public:
     }
 
     void AddAttribute(const std::wstring& name, const std::wstring& value) {
-        node_->attributes_.push_back(std::make_shared<XamlAttribute>(name, value));
+        node_->attributes_.push_back(
+            document_ ?
+            document_->CreateAttribute(name, value) :
+            std::make_shared<XamlAttribute>(name, value));
     }
 
     void AddChildNode(const std::shared_ptr<XamlNode>& node) {
@@ -41,6 +52,7 @@ public:
     }
 
 private:
+    internal::XamlDocument* document_{};
     std::shared_ptr<XamlNode> node_;
 };
 
@@ -4,6 +4,7 @@
 #include <zaf/base/error/com_error.h>
 #include <zaf/io/stream/stream.h>
 #include <zaf/base/string/encoding_conversion.h>
+#include <zaf/object/parsing/internal/xaml_document.h>
 #include <zaf/object/parsing/xaml_node_builder.h>
 
 namespace zaf {
@@ -77,15 +78,19 @@ XamlReader::~XamlReader() {
 
 std::shared_ptr<XamlNode> XamlReader::Read() {
 
+    auto document = std::make_shared<internal::XamlDocument>();
+
     std::shared_ptr<XamlNode> root_node;
-    HRESULT result = ReadRootNode(root_node);
+    HRESULT result = ReadRootNode(*document, root_node);
 
     ZAF_THROW_IF_COM_ERROR(result);
     return root_node;
 }
 
 
-HRESULT XamlReader::ReadRootNode(std::shared_ptr<XamlNode>& root_node) {
+HRESULT XamlReader::ReadRootNode(
+    internal::XamlDocument& document,
+    std::shared_ptr<XamlNode>& root_node) {
 
     XmlNodeType xml_node_type{};
     auto result = AdvanceToNextNode(xml_node_type);
@@ -97,29 +102,32 @@ HRESULT XamlReader::ReadRootNode(std::shared_ptr<XamlNode>& root_node) {
         return E_INVALIDARG;
     }
 
-    return ReadElementNode(root_node);
+    return ReadElementNode(document, root_node);
 }
 
 
-HRESULT XamlReader::ReadElementNode(std::shared_ptr<XamlNode>& node) {
+HRESULT XamlReader::ReadElementNode(
+    internal::XamlDocument& document,
+    std::shared_ptr<XamlNode>& node) {
 
-    XamlNodeBuilder node_builder;
+    XamlNodeBuilder node_builder{ document };
     node_builder.SetType(XamlNodeType::Element);
 
     const wchar_t* name{};
-    HRESULT result = handle_->GetLocalName(&name, nullptr);
+    UINT name_length{};
+    HRESULT result = handle_->GetLocalName(&name, &name_length);
     if (result != S_OK) {
         return result;
     }
 
-    node_builder.SetValue(name);
+    node_builder.SetValue(std::wstring{ name, name_length });
 
     result = ReadAttributes(node_builder);
     if (FAILED(result)) {
         return result;
     }
 
-    result = ReadChildren(node_builder);
+    result = ReadChildren(document, node_builder);
     if (FAILED(result)) {
         return result;
     }
@@ -141,18 +149,22 @@ HRESULT XamlReader::ReadAttributes(XamlNodeBuilder& node_builder) {
         }
 
         const wchar_t* name = nullptr;
-        result = handle_->GetLocalName(&name, nullptr);
+        UINT name_length{};
+        result = handle_->GetLocalName(&name, &name_length);
         if (result != S_OK) {
             break;
         }
 
         const wchar_t* value = nullptr;
-        result = handle_->GetValue(&value, nullptr);
+        UINT value_length{};
+        result = handle_->GetValue(&value, &value_length);
         if (result != S_OK) {
             break;
         }
 
-        node_builder.AddAttribute(name, value);
+        node_builder.AddAttribute(
+            std::wstring{ name, name_length },
+            std::wstring{ value, value_length });
         has_attributes = true;
     }
 
@@ -164,7 +176,9 @@ HRESULT XamlReader::ReadAttributes(XamlNodeBuilder& node_builder) {
 }
 
 
-HRESULT XamlReader::ReadChildren(XamlNodeBuilder& node_builder) {
+HRESULT XamlReader::ReadChildren(
+    internal::XamlDocument& document,
+    XamlNodeBuilder& node_builder) {
 
     if (handle_->IsEmptyElement()) {
         return S_OK;
@@ -182,7 +196,7 @@ HRESULT XamlReader::ReadChildren(XamlNodeBuilder& node_builder) {
         if (node_type == XmlNodeType_Element) {
 
             std::shared_ptr<XamlNode> child_node;
-            result = ReadElementNode(child_node);
+            result = ReadElementNode(document, child_node);
             if (result != S_OK) {
                 break;
             }
@@ -192,7 +206,7 @@ HRESULT XamlReader::ReadChildren(XamlNodeBuilder& node_builder) {
         else if (node_type == XmlNodeType_Text) {
 
             std::shared_ptr<XamlNode> child_node;
-            result = ReadTextNode(child_node);
+            result = ReadTextNode(document, child_node);
             if (result != S_OK) {
                 break;
             }
@@ -212,18 +226,21 @@ HRESULT XamlReader::ReadChildren(XamlNodeBuilder& node_builder) {
 }
 
 
-HRESULT XamlReader::ReadTextNode(std::shared_ptr<XamlNode>& node) {
+HRESULT XamlReader::ReadTextNode(
+    internal::XamlDocument& document,
+    std::shared_ptr<XamlNode>& node) {
 
-    XamlNodeBuilder node_builder;
+    XamlNodeBuilder node_builder{ document };
     node_builder.SetType(XamlNodeType::Text);
 
     const wchar_t* value{};
-    HRESULT result = handle_->GetValue(&value, nullptr);
+    UINT value_length{};
+    HRESULT result = handle_->GetValue(&value, &value_length);
     if (result != S_OK) {
         return result;
     }
 
-    node_builder.SetValue(value);
+    node_builder.SetValue(std::wstring{ value, value_length });
     node = node_builder.Build();
     return S_OK;
 }
@@ -4,6 +4,9 @@
 #include <zaf/object/parsing/xaml_node.h>
 
 namespace zaf {
+namespace internal {
+class XamlDocument;
+}
 
 class Stream;
 class XamlNodeBuilder;
@@ -24,11 +27,11 @@ public:
     std::shared_ptr<XamlNode> Read();
 
 private:
-    HRESULT ReadRootNode(std::shared_ptr<XamlNode>& root_node);
-    HRESULT ReadElementNode(std::shared_ptr<XamlNode>& node);
+    HRESULT ReadRootNode(internal::XamlDocument& document, std::shared_ptr<XamlNode>& root_node);
+    HRESULT ReadElementNode(internal::XamlDocument& document, std::shared_ptr<XamlNode>& node);
     HRESULT ReadAttributes(XamlNodeBuilder& node_builder);
-    HRESULT ReadChildren(XamlNodeBuilder& node_builder);
-    HRESULT ReadTextNode(std::shared_ptr<XamlNode>& node);
+    HRESULT ReadChildren(internal::XamlDocument& document, XamlNodeBuilder& node_builder);
+    HRESULT ReadTextNode(internal::XamlDocument& document, std::shared_ptr<XamlNode>& node);
     HRESULT AdvanceToNextNode(XmlNodeType& next_node_type);
 
 private:
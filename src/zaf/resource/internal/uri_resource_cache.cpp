@@ -0,0 +1,209 @@
+#include <zaf/resource/internal/uri_resource_cache.h>
+#include <zaf/base/com_ptr.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/base/hash.h>
+#include <zaf/graphic/image.h>
+#include <zaf/graphic/wic/imaging_factory.h>
+#include <zaf/internal/graphic/utility.h>
+#include <zaf/internal/stream/memory_stream_impl.h>
+#include <zaf/internal/stream/shared_byte_array_stream_core.h>
+#include <zaf/resource/uri_loader.h>
+
+namespace zaf::internal {
+namespace {
+
+Stream CreateStreamOnContent(std::shared_ptr<const ByteArray> content) {
+    return Stream{ MakeCOMPtr<MemoryStreamImpl>(
+        std::make_unique<SharedByteArrayStreamCore>(std::move(content))) };
+}
+
+
+//Decodes the first frame into memory, so that creating render bitmaps from the shared image later
+//doesn't decode the pixels again.
+std::shared_ptr<Image> DecodeImage(const Stream& stream) {
+
+    auto bitmap_decoder = CreateBitmapDecoderFromSteam(stream);
+    auto bitmap = wic::ImagingFactory::Instance().CreateBitmapFromSource(
+        bitmap_decoder.GetFrame(0),
+        wic::BitmapCacheOption::CacheOnLoad);
+
+    return Image::FromBitmap(bitmap);
+}
+
+
+ByteArray ReadAllContent(const Stream& stream, std::size_t size) {
+
+    auto buffer = stream.UnderlyingBuffer();
+    if (buffer) {
+        return ByteArray::FromMemory(buffer, size);
+    }
+
+    ByteArray result(size);
+    std::size_t total_read_size{};
+    while (total_read_size < size) {
+
+        auto read_size = stream.Read(size - total_read_size, result.Data() + total_read_size);
+        if (read_size == 0) {
+            break;
+        }
+        total_read_size += read_size;
+    }
+
+    result.Resize(total_read_size);
+    return result;
+}
+
+}
+
+std::size_t URIResourceCache::KeyHash::operator()(const Key& key) const noexcept {
+    return CalculateHash(key.uri, key.dpi);
+}
+
+
+URIResourceCache::URIResourceCache(
+    std::shared_ptr<URILoader> uri_loader,
+    std::size_t byte_budget)
+    :
+    uri_loader_(std::move(uri_loader)),
+    byte_budget_(byte_budget) {
+
+    ZAF_EXPECT(uri_loader_);
+}
+
+
+Stream URIResourceCache::Load(std::wstring_view uri, float dpi) {
+
+    Key key{ std::wstring{ uri }, dpi };
+
+    auto content = FindContent(key);
+    if (content) {
+        return CreateStreamOnContent(std::move(content));
+    }
+
+    return LoadAndAddContent(key);
+}
+
+
+std::shared_ptr<const ByteArray> URIResourceCache::FindContent(const Key& key) {
+
+    std::lock_guard<std::mutex> lock_guard{ lock_ };
+
+    auto iterator = entry_map_.find(key);
+    if (iterator == entry_map_.end()) {
+        ++statistics_.miss_count;
+        return nullptr;
+    }
+
+    //Move the entry to the front as it's the most recently used one.
+    entries_.splice(entries_.begin(), entries_, iterator->second);
+
+    ++statistics_.hit_count;
+    return iterator->second->content;
+}
+
+
+Stream URIResourceCache::LoadAndAddContent(const Key& key) {
+
+    //Load without holding the lock, as loading may be slow, and the loader may call back into the
+    //cache.
+    auto stream = uri_loader_->Load(key.uri, key.dpi);
+
+    //A content larger than the budget is returned as is, without being read into memory.
+    auto size = stream.Size();
+    if (byte_budget_ == 0 || size > byte_budget_) {
+        return stream;
+    }
+
+    auto content = std::make_shared<const ByteArray>(ReadAllContent(stream, size));
+
+    std::lock_guard<std::mutex> lock_guard{ lock_ };
+
+    //The same content may have been added by another thread in the meantime.
+    auto iterator = entry_map_.find(key);
+    if (iterator != entry_map_.end()) {
+        entries_.splice(entries_.begin(), entries_, iterator->second);
+        return CreateStreamOnContent(iterator->second->content);
+    }
+
+    entries_.push_front(Entry{ key, content });
+    entry_map_[key] = entries_.begin();
+    cached_byte_count_ += content->Size();
+
+    EvictIfNeeded();
+    return CreateStreamOnContent(std::move(content));
+}
+
+
+void URIResourceCache::EvictIfNeeded() {
+
+    while (cached_byte_count_ > byte_budget_ && !entries_.empty()) {
+
+        const auto& entry = entries_.back();
+        cached_byte_count_ -= entry.content->Size();
+        entry_map_.erase(entry.key);
+        entries_.pop_back();
+
+        ++statistics_.eviction_count;
+    }
+}
+
+
+std::shared_ptr<Image> URIResourceCache::LoadDecodedImage(std::wstring_view uri, float dpi) {
+
+    Key key{ std::wstring{ uri }, dpi };
+
+    {
+        std::lock_guard<std::mutex> lock_guard{ lock_ };
+
+        auto iterator = decoded_images_.find(key);
+        if (iterator != decoded_images_.end()) {
+
+            auto image = iterator->second.lock();
+            if (image) {
+                ++statistics_.image_hit_count;
+                return image;
+            }
+        }
+    }
+
+    auto image = DecodeImage(Load(uri, dpi));
+
+    std::lock_guard<std::mutex> lock_guard{ lock_ };
+
+    ++statistics_.image_miss_count;
+
+    //Remove images that are no longer used by anyone.
+    std::erase_if(decoded_images_, [](const auto& pair) {
+        return pair.second.expired();
+    });
+
+    decoded_images_[std::move(key)] = image;
+    return image;
+}
+
+
+void URIResourceCache::Clear() {
+
+    std::lock_guard<std::mutex> lock_guard{ lock_ };
+
+    entries_.clear();
+    entry_map_.clear();
+    cached_byte_count_ = 0;
+    decoded_images_.clear();
+}
+
+
+std::size_t URIResourceCache::CachedByteCount() const {
+
+    std::lock_guard<std::mutex> lock_guard{ lock_ };
+    return cached_byte_count_;
+}
+
+
+URIResourceCacheStatistics URIResourceCache::Statistics() const {
+
+    std::lock_guard<std::mutex> lock_guard{ lock_ };
+    return statistics_;
+}
+
+}
\ No newline at end of file
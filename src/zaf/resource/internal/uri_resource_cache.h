@@ -0,0 +1,113 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <zaf/base/byte_array.h>
+#include <zaf/base/non_copyable.h>
+#include <zaf/io/stream/stream.h>
+
+namespace zaf {
+class Image;
+class URILoader;
+}
+
+namespace zaf::internal {
+
+class URIResourceCacheStatistics {
+public:
+    //Count of loadings that are served by cached content.
+    std::size_t hit_count{};
+
+    //Count of loadings that are served by the URI loader.
+    std::size_t miss_count{};
+
+    //Count of cached contents that have been evicted to fit in the byte budget.
+    std::size_t eviction_count{};
+
+    //Count of image loadings that are served by an alive decoded image.
+    std::size_t image_hit_count{};
+
+    //Count of image loadings that need to decode the content.
+    std::size_t image_miss_count{};
+};
+
+
+/**
+A cache of contents loaded by a URILoader, keyed by URI and DPI.
+
+@details
+    Contents are kept in memory as long as their total size is within the byte budget, the least
+    recently used ones are evicted once it's exceeded. A content larger than the budget is never
+    cached. Streams returned from the cache are read-only and share the cached content.
+
+    Decoded images are shared as long as they are alive, so that an image used by many controls is
+    decoded only once. Their pixels are decoded into an in-memory WIC bitmap when loading, rather
+    than on each creation of a render bitmap. The WIC bitmap is only read after that, so the
+    shared image can be used by renderers on different threads.
+
+    All methods are thread-safe.
+*/
+class URIResourceCache : NonCopyableNonMovable {
+public:
+    URIResourceCache(std::shared_ptr<URILoader> uri_loader, std::size_t byte_budget);
+
+    Stream Load(std::wstring_view uri, float dpi);
+    std::shared_ptr<Image> LoadDecodedImage(std::wstring_view uri, float dpi);
+
+    void Clear();
+
+    std::size_t ByteBudget() const noexcept {
+        return byte_budget_;
+    }
+
+    std::size_t CachedByteCount() const;
+    URIResourceCacheStatistics Statistics() const;
+
+private:
+    class Key {
+    public:
+        std::wstring uri;
+        float dpi{};
+
+        friend bool operator==(const Key&, const Key&) = default;
+    };
+
+    class KeyHash {
+    public:
+        std::size_t operator()(const Key& key) const noexcept;
+    };
+
+    class Entry {
+    public:
+        Key key;
+        std::shared_ptr<const ByteArray> content;
+    };
+
+    using EntryList = std::list<Entry>;
+
+private:
+    std::shared_ptr<const ByteArray> FindContent(const Key& key);
+    Stream LoadAndAddContent(const Key& key);
+    void EvictIfNeeded();
+
+private:
+    std::shared_ptr<URILoader> uri_loader_;
+    std::size_t byte_budget_{};
+
+    mutable std::mutex lock_;
+
+    //Most recently used entries are at the front.
+    EntryList entries_;
+    std::unordered_map<Key, EntryList::iterator, KeyHash> entry_map_;
+    std::size_t cached_byte_count_{};
+
+    std::unordered_map<Key, std::weak_ptr<Image>, KeyHash> decoded_images_;
+
+    URIResourceCacheStatistics statistics_;
+};
+
+}
\ No newline at end of file
@@ -9,8 +9,13 @@ ResourceFactory& ResourceFactory::Instance() {
 }
 
 
-ResourceFactory::ResourceFactory(const std::shared_ptr<URILoader>& custom_uri_loader) :
-    custom_uri_loader_(custom_uri_loader) {
+ResourceFactory::ResourceFactory(
+    const std::shared_ptr<URILoader>& custom_uri_loader,
+    std::size_t cache_byte_budget)
+    :
+    cache_(std::make_unique<internal::URIResourceCache>(
+        custom_uri_loader ? custom_uri_loader : URILoader::DefaultLoader(),
+        cache_byte_budget)) {
 
 }
 
@@ -26,12 +31,27 @@ Stream ResourceFactory::LoadURI(std::wstring_view uri) {
 
 
 Stream ResourceFactory::LoadURI(std::wstring_view uri, float dpi) {
+    return cache_->Load(uri, dpi);
+}
+
+
+std::shared_ptr<Image> ResourceFactory::LoadURIImage(std::wstring_view uri) {
+    return LoadURIImage(uri, Application::Instance().GetSystemDPI());
+}
+
+
+std::shared_ptr<Image> ResourceFactory::LoadURIImage(std::wstring_view uri, float dpi) {
+    return cache_->LoadDecodedImage(uri, dpi);
+}
+
+
+void ResourceFactory::ClearCache() {
+    cache_->Clear();
+}
 
-    if (custom_uri_loader_) {
-        return custom_uri_loader_->Load(uri, dpi);
-    }
 
-    return URILoader::DefaultLoader()->Load(uri, dpi);
+internal::URIResourceCacheStatistics ResourceFactory::CacheStatistics() const {
+    return cache_->Statistics();
 }
 
 }
\ No newline at end of file
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <memory>
 #include <zaf/io/stream/stream.h>
+#include <zaf/resource/internal/uri_resource_cache.h>
 
 namespace zaf {
 
 class Application;
+class Image;
 class URILoader;
 
 class ResourceFactory {
@@ -17,16 +20,42 @@ public:
     ResourceFactory(const ResourceFactory&) = delete;
     ResourceFactory& operator=(const ResourceFactory&) = delete;
 
+    /**
+    Loads the content of the specified URI.
+
+    @details
+        Contents are cached by URI and DPI within the byte budget specified in
+        InitializationOptions, so loading the same URI again doesn't access the file or the DLL
+        resource. The returned stream is read-only if the content is cached.
+    */
     Stream LoadURI(std::wstring_view uri);
     Stream LoadURI(std::wstring_view, float dpi);
 
+    /**
+    Loads and decodes the image of the specified URI.
+
+    @details
+        The decoded image is shared by all callers as long as it is alive.
+    */
+    std::shared_ptr<Image> LoadURIImage(std::wstring_view uri);
+    std::shared_ptr<Image> LoadURIImage(std::wstring_view uri, float dpi);
+
+    /**
+    Removes all cached contents and images, so that changes of files take effect in later loadings.
+    */
+    void ClearCache();
+
+    internal::URIResourceCacheStatistics CacheStatistics() const;
+
 private:
     friend class zaf::Application;
 
-    explicit ResourceFactory(const std::shared_ptr<URILoader>& custom_uri_loader);
+    ResourceFactory(
+        const std::shared_ptr<URILoader>& custom_uri_loader,
+        std::size_t cache_byte_budget);
 
 private:
-    std::shared_ptr<URILoader> custom_uri_loader_;
+    std::unique_ptr<internal::URIResourceCache> cache_;
 };
 
 }
\ No newline at end of file
@@ -1,19 +1,20 @@
 #include <zaf/rx/internal/observable/observable_core.h>
 #include <zaf/rx/internal/observable/connectable_observable_core.h>
+#include <zaf/rx/internal/operator/bounded_observe_on_operator.h>
+#include <zaf/rx/internal/operator/buffer_operator.h>
 #include <zaf/rx/internal/operator/catch_operator.h>
 #include <zaf/rx/internal/operator/debounce_operator.h>
 #include <zaf/rx/internal/operator/do_after_terminate_operator.h>
 #include <zaf/rx/internal/operator/do_on_terminate_operator.h>
-#include <zaf/rx/internal/operator/do_operator.h>
-#include <zaf/rx/internal/operator/filter_operator.h>
 #include <zaf/rx/internal/operator/finally_operator.h>
 #include <zaf/rx/internal/operator/flat_map_operator.h>
-#include <zaf/rx/internal/operator/map_operator.h>
+#include <zaf/rx/internal/operator/fused_operator.h>
 #include <zaf/rx/internal/operator/observe_on_operator.h>
 #include <zaf/rx/internal/operator/sample_operator.h>
 #include <zaf/rx/internal/operator/subscribe_on_operator.h>
 #include <zaf/rx/internal/operator/throttle_first_operator.h>
 #include <zaf/rx/internal/operator/throttle_last_operator.h>
+#include <zaf/rx/internal/operator/window_operator.h>
 #include <zaf/rx/internal/subject/subject_core_indirect.h>
 
 namespace zaf::rx::internal {
@@ -30,10 +31,23 @@ std::shared_ptr<ObservableCore> ObservableCore::ObserveOn(std::shared_ptr<Schedu
 }
 
 
+std::shared_ptr<ObservableCore> ObservableCore::ObserveOn(
+    std::shared_ptr<Scheduler> scheduler,
+    std::size_t queue_capacity,
+    OverflowPolicy overflow_policy) {
+
+    return std::make_shared<BoundedObserveOnOperator>(
+        shared_from_this(),
+        std::move(scheduler),
+        queue_capacity,
+        overflow_policy);
+}
+
+
 std::shared_ptr<ObservableCore> ObservableCore::Do(
     std::shared_ptr<ObserverCore> do_observer) {
 
-    return std::make_shared<DoOperator>(shared_from_this(), std::move(do_observer));
+    return FusedOperator::Append(shared_from_this(), std::move(do_observer));
 }
 
 
@@ -56,7 +70,7 @@ std::shared_ptr<ObservableCore> ObservableCore::Finally(Closure work) {
 
 
 std::shared_ptr<ObservableCore> ObservableCore::Map(Mapper mapper) {
-    return std::make_shared<MapOperator>(shared_from_this(), std::move(mapper));
+    return FusedOperator::Append(shared_from_this(), std::move(mapper));
 }
 
 
@@ -99,8 +113,38 @@ std::shared_ptr<ObservableCore> ObservableCore::ThrottleLast(
 }
 
 
+std::shared_ptr<ObservableCore> ObservableCore::Buffer(
+    std::optional<std::size_t> count,
+    std::optional<std::chrono::steady_clock::duration> period,
+    std::shared_ptr<Scheduler> scheduler,
+    BufferPacker packer) {
+
+    return std::make_shared<BufferOperator>(
+        shared_from_this(),
+        count,
+        period,
+        std::move(scheduler),
+        std::move(packer));
+}
+
+
+std::shared_ptr<ObservableCore> ObservableCore::Window(
+    std::optional<std::size_t> count,
+    std::optional<std::chrono::steady_clock::duration> period,
+    std::shared_ptr<Scheduler> scheduler,
+    WindowPacker packer) {
+
+    return std::make_shared<WindowOperator>(
+        shared_from_this(),
+        count,
+        period,
+        std::move(scheduler),
+        std::move(packer));
+}
+
+
 std::shared_ptr<ObservableCore> ObservableCore::Filter(FilterPredicate predicate) {
-    return std::make_shared<FilterOperator>(shared_from_this(), std::move(predicate));
+    return FusedOperator::Append(shared_from_this(), std::move(predicate));
 }
 
 
@@ -110,11 +154,12 @@ std::shared_ptr<ConnectableObservableCore> ObservableCore::Publish() {
 
 
 std::shared_ptr<ConnectableObservableCore> ObservableCore::Replay(
-    std::optional<std::size_t> replay_size) {
+    std::optional<std::size_t> replay_size,
+    std::optional<std::chrono::steady_clock::duration> replay_window) {
 
     return std::make_shared<ConnectableObservableCore>(
         shared_from_this(), 
-        CreateReplaySubjectCore(replay_size));
+        CreateReplaySubjectCore(replay_size, replay_window));
 }
 
 }
\ No newline at end of file
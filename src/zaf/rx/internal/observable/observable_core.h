@@ -6,10 +6,13 @@
 #include <optional>
 #include <zaf/base/closure.h>
 #include <zaf/rx/internal/observer_shim.h>
+#include <zaf/rx/internal/operator/buffer_packer.h>
 #include <zaf/rx/internal/operator/catch_handler.h>
 #include <zaf/rx/internal/operator/filter_predicate.h>
 #include <zaf/rx/internal/operator/flat_mapper.h>
 #include <zaf/rx/internal/operator/mapper.h>
+#include <zaf/rx/internal/operator/window_packer.h>
+#include <zaf/rx/overflow_policy.h>
 
 namespace zaf::rx {
 class Disposable;
@@ -33,6 +36,10 @@ public:
 
     std::shared_ptr<ObservableCore> SubscribeOn(std::shared_ptr<Scheduler> scheduler);
     std::shared_ptr<ObservableCore> ObserveOn(std::shared_ptr<Scheduler> scheduler);
+    std::shared_ptr<ObservableCore> ObserveOn(
+        std::shared_ptr<Scheduler> scheduler,
+        std::size_t queue_capacity,
+        OverflowPolicy overflow_policy);
 
     std::shared_ptr<ObservableCore> Do(std::shared_ptr<ObserverCore> do_observer);
     std::shared_ptr<ObservableCore> DoOnTerminate(Closure work);
@@ -56,10 +63,24 @@ public:
         std::chrono::steady_clock::duration duration,
         std::shared_ptr<Scheduler> scheduler);
 
+    std::shared_ptr<ObservableCore> Buffer(
+        std::optional<std::size_t> count,
+        std::optional<std::chrono::steady_clock::duration> period,
+        std::shared_ptr<Scheduler> scheduler,
+        BufferPacker packer);
+
+    std::shared_ptr<ObservableCore> Window(
+        std::optional<std::size_t> count,
+        std::optional<std::chrono::steady_clock::duration> period,
+        std::shared_ptr<Scheduler> scheduler,
+        WindowPacker packer);
+
     std::shared_ptr<ObservableCore> Filter(FilterPredicate predicate);
 
     std::shared_ptr<ConnectableObservableCore> Publish();
-    std::shared_ptr<ConnectableObservableCore> Replay(std::optional<std::size_t> replay_size);
+    std::shared_ptr<ConnectableObservableCore> Replay(
+        std::optional<std::size_t> replay_size,
+        std::optional<std::chrono::steady_clock::duration> replay_window);
 };
 
 }
\ No newline at end of file
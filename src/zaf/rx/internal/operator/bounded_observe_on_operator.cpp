@@ -0,0 +1,259 @@
+#include <zaf/rx/internal/operator/bounded_observe_on_operator.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <variant>
+#include <zaf/base/as.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/base/none.h>
+#include <zaf/rx/internal/observer_core.h>
+#include <zaf/rx/internal/producer.h>
+#include <zaf/rx/queue_overflow_error.h>
+
+namespace zaf::rx::internal {
+namespace {
+
+class BoundedObserveOnProducer : public Producer, public ObserverCore {
+public:
+    BoundedObserveOnProducer(
+        ObserverShim&& next_observer,
+        std::shared_ptr<Scheduler> scheduler,
+        std::size_t queue_capacity,
+        OverflowPolicy overflow_policy)
+        :
+        Producer(std::move(next_observer)),
+        scheduler_(std::move(scheduler)),
+        queue_capacity_(queue_capacity),
+        overflow_policy_(overflow_policy) {
+
+    }
+
+    ~BoundedObserveOnProducer() {
+        DoDisposal();
+    }
+
+    void Run(const std::shared_ptr<ObservableCore>& source) {
+
+        auto subscription = source->Subscribe(
+            ObserverShim::FromWeak(As<ObserverCore>(shared_from_this())));
+
+        // The subscription may have been disposed during subscribing, either by overflowing or by
+        // disposing the producer, in which case the new subscription should be disposed as well.
+        std::shared_ptr<Disposable> expected;
+        if (!source_subscription_.compare_exchange_strong(expected, subscription)) {
+            subscription->Dispose();
+        }
+    }
+
+    void OnNext(const std::any& value) override {
+
+        bool is_overflowed{};
+        {
+            std::unique_lock<std::mutex> lock(lock_);
+            if (is_unsubscribed_ || !std::holds_alternative<std::monostate>(termination_)) {
+                return;
+            }
+
+            if (queue_.size() >= queue_capacity_) {
+
+                switch (overflow_policy_) {
+                case OverflowPolicy::Block:
+                    queue_not_full_.wait(lock, [this]() {
+                        return is_unsubscribed_ || queue_.size() < queue_capacity_;
+                    });
+                    if (is_unsubscribed_) {
+                        return;
+                    }
+                    break;
+
+                case OverflowPolicy::DropOldest:
+                    queue_.pop_front();
+                    break;
+
+                case OverflowPolicy::DropNewest:
+                    return;
+
+                case OverflowPolicy::Error:
+                    termination_ = std::make_exception_ptr(
+                        QueueOverflowError{ ZAF_SOURCE_LOCATION() });
+                    is_overflowed = true;
+                    break;
+                }
+            }
+
+            if (!is_overflowed) {
+                queue_.push_back(value);
+            }
+        }
+
+        if (is_overflowed) {
+            // No more items are accepted after overflowing, so stop observing the source.
+            DisposeSourceSubscription();
+        }
+
+        ScheduleDrainIfNeeded();
+    }
+
+    void OnError(const std::exception_ptr& error) override {
+        Terminate(error);
+    }
+
+    void OnCompleted() override {
+        Terminate(None{});
+    }
+
+protected:
+    void OnDispose() noexcept override {
+        DoDisposal();
+    }
+
+private:
+    void Terminate(std::variant<std::monostate, std::exception_ptr, None> termination) {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            if (is_unsubscribed_ || !std::holds_alternative<std::monostate>(termination_)) {
+                return;
+            }
+            termination_ = std::move(termination);
+        }
+        ScheduleDrainIfNeeded();
+    }
+
+    void ScheduleDrainIfNeeded() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            if (is_drain_scheduled_) {
+                return;
+            }
+            is_drain_scheduled_ = true;
+        }
+
+        try {
+            scheduler_->ScheduleWork(std::bind(
+                &BoundedObserveOnProducer::DrainOnScheduler,
+                As<BoundedObserveOnProducer>(shared_from_this())));
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(lock_);
+            is_drain_scheduled_ = false;
+            throw;
+        }
+    }
+
+    void DrainOnScheduler() {
+
+        std::deque<std::any> items;
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            items.swap(queue_);
+        }
+        queue_not_full_.notify_all();
+
+        for (const auto& each_item : items) {
+            if (is_unsubscribed_) {
+                return;
+            }
+            EmitOnNext(each_item);
+        }
+
+        bool has_more_items{};
+        std::variant<std::monostate, std::exception_ptr, None> termination;
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            has_more_items = !queue_.empty();
+            if (!has_more_items) {
+                // The termination is read under the same lock that clears the flag, so that a 
+                // termination arriving during the drain is either seen here, or schedules a new 
+                // drain after the flag is cleared.
+                termination = termination_;
+            }
+
+            // Once the termination is taken, the flag is kept to prevent further drains.
+            if (std::holds_alternative<std::monostate>(termination)) {
+                is_drain_scheduled_ = false;
+            }
+        }
+
+        if (has_more_items) {
+            // Schedule another drain work rather than looping here, to give other works on the 
+            // scheduler a chance to run.
+            ScheduleDrainIfNeeded();
+            return;
+        }
+
+        // The termination is emitted only after all items queued before it are emitted.
+        if (auto error = std::get_if<std::exception_ptr>(&termination)) {
+            EmitOnError(*error);
+        }
+        else if (std::holds_alternative<None>(termination)) {
+            EmitOnCompleted();
+        }
+    }
+
+    void DisposeSourceSubscription() noexcept {
+        // The subscription is replaced with the empty disposable rather than null, so that Run()
+        // knows it has been disposed.
+        auto subscription = source_subscription_.exchange(Disposable::Empty());
+        if (subscription) {
+            subscription->Dispose();
+        }
+    }
+
+    void DoDisposal() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            is_unsubscribed_ = true;
+            queue_.clear();
+        }
+        queue_not_full_.notify_all();
+        DisposeSourceSubscription();
+    }
+
+private:
+    std::shared_ptr<Scheduler> scheduler_;
+    const std::size_t queue_capacity_{};
+    const OverflowPolicy overflow_policy_{};
+    //Disposed from both the source thread on overflow and the disposing thread.
+    std::atomic<std::shared_ptr<Disposable>> source_subscription_;
+
+    std::mutex lock_;
+    std::condition_variable queue_not_full_;
+    std::deque<std::any> queue_;
+    //std::exception_ptr for error termination; None for normal termination.
+    std::variant<std::monostate, std::exception_ptr, None> termination_;
+    bool is_drain_scheduled_{};
+    std::atomic<bool> is_unsubscribed_{};
+};
+
+}
+
+BoundedObserveOnOperator::BoundedObserveOnOperator(
+    std::shared_ptr<ObservableCore> source,
+    std::shared_ptr<Scheduler> scheduler,
+    std::size_t queue_capacity,
+    OverflowPolicy overflow_policy)
+    :
+    source_(std::move(source)),
+    scheduler_(std::move(scheduler)),
+    queue_capacity_(queue_capacity),
+    overflow_policy_(overflow_policy) {
+
+    ZAF_EXPECT(source_);
+    ZAF_EXPECT(scheduler_);
+    ZAF_EXPECT(queue_capacity_ > 0);
+}
+
+
+std::shared_ptr<Disposable> BoundedObserveOnOperator::Subscribe(ObserverShim&& observer) {
+
+    auto producer = std::make_shared<BoundedObserveOnProducer>(
+        std::move(observer),
+        scheduler_,
+        queue_capacity_,
+        overflow_policy_);
+
+    producer->Run(source_);
+    return producer;
+}
+
+}
\ No newline at end of file
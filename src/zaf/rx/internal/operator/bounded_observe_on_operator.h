@@ -0,0 +1,35 @@
+#pragma once
+
+#include <zaf/rx/internal/observable/observable_core.h>
+#include <zaf/rx/overflow_policy.h>
+#include <zaf/rx/scheduler/scheduler.h>
+
+namespace zaf::rx::internal {
+
+/**
+An ObserveOn operator that buffers emissions in a bounded queue per subscription, and drains the 
+queue in batches on the scheduler.
+
+@details
+    At most one drain work is scheduled for a subscription at any time. A drain work emits all 
+    items that are queued when it starts, and schedules another drain work if more items are 
+    queued meanwhile.
+*/
+class BoundedObserveOnOperator : public ObservableCore {
+public:
+    BoundedObserveOnOperator(
+        std::shared_ptr<ObservableCore> source,
+        std::shared_ptr<Scheduler> scheduler,
+        std::size_t queue_capacity,
+        OverflowPolicy overflow_policy);
+
+    std::shared_ptr<Disposable> Subscribe(ObserverShim&& observer) override;
+
+private:
+    std::shared_ptr<ObservableCore> source_;
+    std::shared_ptr<Scheduler> scheduler_;
+    std::size_t queue_capacity_{};
+    OverflowPolicy overflow_policy_{};
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include <zaf/rx/internal/operator/buffer_operator.h>
+#include <algorithm>
+#include <mutex>
+#include <zaf/base/as.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/rx/internal/observer_core.h>
+#include <zaf/rx/internal/producer.h>
+
+namespace zaf::rx::internal {
+namespace {
+
+constexpr std::size_t MaxReservedCount = 1024;
+
+class BufferProducer : public Producer, public ObserverCore {
+public:
+    BufferProducer(
+        ObserverShim&& observer,
+        std::optional<std::size_t> count,
+        std::optional<std::chrono::steady_clock::duration> period,
+        std::shared_ptr<Scheduler> scheduler,
+        BufferPacker packer) noexcept
+        :
+        Producer(std::move(observer)),
+        count_(count),
+        period_(period),
+        scheduler_(std::move(scheduler)),
+        packer_(std::move(packer)),
+        timer_(Disposable::Empty()) {
+
+    }
+
+    ~BufferProducer() {
+        DoDisposal();
+    }
+
+    void Run(const std::shared_ptr<ObservableCore>& source) {
+
+        source_sub_ = source->Subscribe(
+            ObserverShim::FromShared(As<ObserverCore>(shared_from_this())));
+
+        if (!period_) {
+            return;
+        }
+
+        try {
+            StartNextPeriod();
+        }
+        catch (...) {
+            source_sub_->Dispose();
+            source_sub_.reset();
+            throw;
+        }
+    }
+
+    void OnNext(const std::any& value) override {
+
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        std::vector<std::any> full_buffer;
+        try {
+            if (count_ && buffer_.empty()) {
+                // Avoid reallocations while filling a new buffer.
+                buffer_.reserve((std::min)(*count_, MaxReservedCount));
+            }
+
+            buffer_.push_back(value);
+            if (count_ && buffer_.size() >= *count_) {
+                full_buffer.swap(buffer_);
+            }
+        }
+        catch (...) {
+            EmitOnError(std::current_exception());
+            return;
+        }
+
+        if (!full_buffer.empty()) {
+            EmitBuffer(std::move(full_buffer));
+        }
+    }
+
+    void OnError(const std::exception_ptr& error) override {
+        CancelTimer();
+
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        buffer_.clear();
+        EmitOnError(error);
+    }
+
+    void OnCompleted() override {
+        CancelTimer();
+
+        // The completion is emitted under the same lock as the last buffer, so that a period end
+        // that is emitting a buffer meanwhile finishes before the completion.
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        EmitPendingBuffer();
+        EmitOnCompleted();
+    }
+
+protected:
+    void OnDispose() noexcept override {
+        DoDisposal();
+    }
+
+private:
+    void StartNextPeriod() {
+
+        std::weak_ptr<BufferProducer> weak_this = As<BufferProducer>(shared_from_this());
+        auto new_timer = scheduler_->ScheduleDelayedWork(*period_, [weak_this]() {
+            if (auto shared_this = weak_this.lock()) {
+                shared_this->OnPeriodEnd();
+            }
+        });
+
+        auto expected = Disposable::Empty();
+        if (!timer_.compare_exchange_strong(expected, new_timer)) {
+            // The producer has been terminated or disposed.
+            new_timer->Dispose();
+        }
+    }
+
+    void OnPeriodEnd() {
+
+        auto previous_timer = timer_.exchange(Disposable::Empty());
+        if (!previous_timer) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(mutex_);
+            EmitPendingBuffer();
+        }
+
+        // Only one timer is started for each period, regardless of how many items are emitted.
+        try {
+            StartNextPeriod();
+        }
+        catch (...) {
+            EmitOnError(std::current_exception());
+        }
+    }
+
+    // Must be called with the lock held.
+    void EmitPendingBuffer() {
+
+        std::vector<std::any> pending_buffer;
+        pending_buffer.swap(buffer_);
+
+        if (!pending_buffer.empty()) {
+            EmitBuffer(std::move(pending_buffer));
+        }
+    }
+
+    void EmitBuffer(std::vector<std::any>&& buffer) {
+
+        std::any packed_buffer;
+        try {
+            packed_buffer = packer_(std::move(buffer));
+        }
+        catch (...) {
+            EmitOnError(std::current_exception());
+            return;
+        }
+
+        EmitOnNext(packed_buffer);
+    }
+
+    void CancelTimer() noexcept {
+        auto timer = timer_.exchange(nullptr);
+        if (timer) {
+            timer->Dispose();
+        }
+    }
+
+    void DoDisposal() noexcept {
+        CancelTimer();
+        if (source_sub_) {
+            source_sub_->Dispose();
+            source_sub_.reset();
+        }
+    }
+
+private:
+    std::optional<std::size_t> count_;
+    std::optional<std::chrono::steady_clock::duration> period_;
+    // Kept alive as long as the producer, since a period end may be starting the next period while
+    // the producer is being disposed.
+    const std::shared_ptr<Scheduler> scheduler_;
+    BufferPacker packer_;
+
+    std::shared_ptr<Disposable> source_sub_;
+    std::atomic<std::shared_ptr<Disposable>> timer_;
+
+    // Guards the buffer and serializes emissions, which come from both the source and the timer.
+    // It's recursive so that an observer can emit items to the source synchronously.
+    std::recursive_mutex mutex_;
+    std::vector<std::any> buffer_;
+};
+
+}
+
+BufferOperator::BufferOperator(
+    std::shared_ptr<ObservableCore> source,
+    std::optional<std::size_t> count,
+    std::optional<std::chrono::steady_clock::duration> period,
+    std::shared_ptr<Scheduler> scheduler,
+    BufferPacker packer)
+    :
+    source_(std::move(source)),
+    count_(count),
+    period_(period),
+    scheduler_(std::move(scheduler)),
+    packer_(std::move(packer)) {
+
+    ZAF_EXPECT(source_);
+    ZAF_EXPECT(count_ || period_);
+    ZAF_EXPECT(!count_ || *count_ > 0);
+    ZAF_EXPECT(!period_ || scheduler_);
+    ZAF_EXPECT(packer_);
+}
+
+
+std::shared_ptr<Disposable> BufferOperator::Subscribe(ObserverShim&& observer) {
+
+    auto producer = std::make_shared<BufferProducer>(
+        std::move(observer),
+        count_,
+        period_,
+        scheduler_,
+        packer_);
+
+    producer->Run(source_);
+    return producer;
+}
+
+}
\ No newline at end of file
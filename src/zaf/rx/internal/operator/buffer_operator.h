@@ -0,0 +1,34 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <zaf/rx/internal/observable/observable_core.h>
+#include <zaf/rx/internal/operator/buffer_packer.h>
+#include <zaf/rx/scheduler/scheduler.h>
+
+namespace zaf::rx::internal {
+
+/*
+Collects items into buffers and emits each buffer as a single item, either when the buffer is full
+or when a time period ends, whichever comes first.
+*/
+class BufferOperator : public ObservableCore {
+public:
+    BufferOperator(
+        std::shared_ptr<ObservableCore> source,
+        std::optional<std::size_t> count,
+        std::optional<std::chrono::steady_clock::duration> period,
+        std::shared_ptr<Scheduler> scheduler,
+        BufferPacker packer);
+
+    std::shared_ptr<Disposable> Subscribe(ObserverShim&& observer) override;
+
+private:
+    std::shared_ptr<ObservableCore> source_;
+    std::optional<std::size_t> count_;
+    std::optional<std::chrono::steady_clock::duration> period_;
+    std::shared_ptr<Scheduler> scheduler_;
+    BufferPacker packer_;
+};
+
+}
\ No newline at end of file
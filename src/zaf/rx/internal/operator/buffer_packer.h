@@ -0,0 +1,14 @@
+#pragma once
+
+#include <any>
+#include <functional>
+#include <vector>
+
+namespace zaf::rx::internal {
+
+/*
+Packs the buffered items into a single item of the typed buffer container.
+*/
+using BufferPacker = std::function<std::any(std::vector<std::any>&&)>;
+
+}
\ No newline at end of file
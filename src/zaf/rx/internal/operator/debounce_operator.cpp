@@ -32,42 +32,27 @@ public:
 
     void OnNext(const std::any& value) override {
 
-        std::size_t current_id{};
-        std::shared_ptr<Disposable> last_timer;
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            last_value_ = value;
-            last_id_++;
-            current_id = last_id_;
-            last_timer = timer_.exchange(Disposable::Empty());
-        }
-
-        // If last timer is null, it means the producer is disposed, so we should abort.
-        if (!last_timer) {
+        if (IsTerminated()) {
             return;
         }
-        last_timer->Dispose();
-
-        std::weak_ptr<DebounceProducer> weak_this = As<DebounceProducer>(shared_from_this());
-        auto new_timer = scheduler_->ScheduleDelayedWork(duration_, [weak_this, current_id]() {
-            if (auto shared_this = weak_this.lock()) {
-                shared_this->OnDelayedWork(current_id);
-            }
-        });
 
+        bool need_arm_timer{};
         {
             std::lock_guard<std::mutex> lock(mutex_);
-            if (current_id != last_id_) {
-                new_timer->Dispose();
-                return;
-            }
+            last_value_ = value;
+            deadline_ = scheduler_->Now() + duration_;
 
-            last_timer = timer_.exchange(new_timer);
-            if (!last_timer) {
-                // Check if the producer is disposed again, dispose the new one and abort if so.
-                new_timer->Dispose();
+            // If the timer is already armed, only the deadline is moved forward. The timer will 
+            // be re-armed with the remaining time when it fires before the deadline.
+            if (!is_timer_armed_) {
+                is_timer_armed_ = true;
+                need_arm_timer = true;
             }
         }
+
+        if (need_arm_timer) {
+            ArmTimer(duration_);
+        }
     }
 
     void OnError(const std::exception_ptr& error) override {
@@ -87,27 +72,73 @@ protected:
     }
 
 private:
-    void OnDelayedWork(std::size_t id) {
+    void ArmTimer(std::chrono::steady_clock::duration delay) {
+
+        std::shared_ptr<Disposable> new_timer;
+        try {
+            std::weak_ptr<DebounceProducer> weak_this = As<DebounceProducer>(shared_from_this());
+            new_timer = scheduler_->ScheduleDelayedWork(delay, [weak_this]() {
+                if (auto shared_this = weak_this.lock()) {
+                    shared_this->OnTimer();
+                }
+            });
+        }
+        catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                is_timer_armed_ = false;
+            }
+            EmitOnError(std::current_exception());
+            return;
+        }
+
+        auto previous_timer = timer_.load();
+        while (previous_timer) {
+            if (timer_.compare_exchange_weak(previous_timer, new_timer)) {
+                return;
+            }
+        }
+
+        // The producer is disposed, the new timer should be cancelled.
+        new_timer->Dispose();
+    }
+
+    void OnTimer() {
+
+        // The producer is disposed.
+        if (!timer_.load()) {
+            return;
+        }
 
         std::any value;
+        std::chrono::steady_clock::duration remaining_time{};
         {
             std::lock_guard<std::mutex> lock(mutex_);
-            // If the ID is not the last one, it means a new value has been emitted after this work
-            // was scheduled, so this work should be ignored.
-            if (id != last_id_) {
-                return;
+            auto now = scheduler_->Now();
+            if (now < deadline_) {
+                remaining_time = deadline_ - now;
             }
-            value = std::move(last_value_);
+            else {
+                value = std::move(last_value_);
+                last_value_.reset();
+                is_timer_armed_ = false;
+            }
+        }
+
+        if (remaining_time > std::chrono::steady_clock::duration::zero()) {
+            ArmTimer(remaining_time);
+        }
+        else if (value.has_value()) {
+            EmitOnNext(value);
         }
-        EmitOnNext(value);
     }
 
     void EmitLastValueOnCompleted() {
         std::any value;
         {
             std::lock_guard<std::mutex> lock(mutex_);
-            last_id_++;
             value = std::move(last_value_);
+            last_value_.reset();
         }
         if (value.has_value()) {
             EmitOnNext(value);
@@ -120,7 +151,6 @@ private:
             source_sub_->Dispose();
             source_sub_.reset();
         }
-        scheduler_.reset();
     }
 
     void CancelTimer() {
@@ -138,7 +168,8 @@ private:
 
     std::mutex mutex_;
     std::any last_value_;
-    std::size_t last_id_{};
+    std::chrono::steady_clock::time_point deadline_;
+    bool is_timer_armed_{};
     std::atomic<std::shared_ptr<Disposable>> timer_;
 };
 
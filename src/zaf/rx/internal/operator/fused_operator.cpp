@@ -0,0 +1,182 @@
+#include <zaf/rx/internal/operator/fused_operator.h>
+#include <zaf/base/as.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/rx/internal/observer_core.h>
+#include <zaf/rx/internal/producer.h>
+
+namespace zaf::rx::internal {
+namespace {
+
+class FusedProducer : public Producer, public ObserverCore {
+public:
+    FusedProducer(
+        ObserverShim&& next_observer,
+        std::shared_ptr<const FusedStageList> stages) 
+        :
+        Producer(std::move(next_observer)),
+        stages_(std::move(stages)) {
+
+    }
+
+    ~FusedProducer() {
+        DoDisposal();
+    }
+
+    void Run(const std::shared_ptr<ObservableCore>& source) {
+        source_subscription_ = source->Subscribe(
+            ObserverShim::FromWeak(As<ObserverCore>(shared_from_this())));
+    }
+
+    void OnNext(const std::any& value) override {
+
+        // Points to the value emitted by the source until the first Map stage, so that values 
+        // are not copied by Filter and Do stages.
+        const std::any* current_value = &value;
+        std::any mapped_value;
+
+        const auto& stages = *stages_;
+        for (std::size_t index = 0; index < stages.size(); ++index) {
+
+            // Exception thrown in a stage should be propagated to the OnError handlers of the 
+            // following stages, and then to the downstream OnError handler.
+            try {
+
+                const auto& stage = stages[index];
+                if (auto mapper = std::get_if<Mapper>(&stage)) {
+                    mapped_value = (*mapper)(*current_value);
+                    current_value = &mapped_value;
+                }
+                else if (auto predicate = std::get_if<FilterPredicate>(&stage)) {
+                    if (!(*predicate)(*current_value)) {
+                        return;
+                    }
+                }
+                else {
+                    std::get<std::shared_ptr<ObserverCore>>(stage)->OnNext(*current_value);
+                }
+            }
+            catch (...) {
+                RunOnError(index + 1, std::current_exception());
+                return;
+            }
+        }
+
+        EmitOnNext(*current_value);
+    }
+
+    void OnError(const std::exception_ptr& error) override {
+        RunOnError(0, error);
+    }
+
+    void OnCompleted() override {
+
+        const auto& stages = *stages_;
+        for (std::size_t index = 0; index < stages.size(); ++index) {
+
+            auto do_observer = std::get_if<std::shared_ptr<ObserverCore>>(&stages[index]);
+            if (!do_observer) {
+                continue;
+            }
+
+            try {
+                (*do_observer)->OnCompleted();
+            }
+            catch (...) {
+                // Exception thrown in the OnCompleted handler of a Do stage should be propagated 
+                // to the OnError handlers of the following stages.
+                RunOnError(index + 1, std::current_exception());
+                return;
+            }
+        }
+
+        EmitOnCompleted();
+    }
+
+protected:
+    void OnDispose() noexcept override {
+        DoDisposal();
+    }
+
+private:
+    void RunOnError(std::size_t begin_index, std::exception_ptr error) {
+
+        const auto& stages = *stages_;
+        for (std::size_t index = begin_index; index < stages.size(); ++index) {
+
+            auto do_observer = std::get_if<std::shared_ptr<ObserverCore>>(&stages[index]);
+            if (!do_observer) {
+                continue;
+            }
+
+            try {
+                (*do_observer)->OnError(error);
+            }
+            catch (...) {
+                // Exception thrown in the OnError handler of a Do stage replaces the original 
+                // error.
+                error = std::current_exception();
+            }
+        }
+
+        EmitOnError(error);
+    }
+
+    void DoDisposal() noexcept {
+        if (source_subscription_) {
+            source_subscription_->Dispose();
+            source_subscription_.reset();
+        }
+    }
+
+private:
+    std::shared_ptr<Disposable> source_subscription_;
+    std::shared_ptr<const FusedStageList> stages_;
+};
+
+}
+
+
+std::shared_ptr<FusedOperator> FusedOperator::Append(
+    std::shared_ptr<ObservableCore> source,
+    FusedStage stage) {
+
+    ZAF_EXPECT(source);
+
+    std::shared_ptr<FusedStageList> stages;
+
+    // Stages are copied rather than shared, because the source operator may be used to create 
+    // other chains.
+    auto fused_source = std::dynamic_pointer_cast<FusedOperator>(source);
+    if (fused_source) {
+        stages = std::make_shared<FusedStageList>(*fused_source->stages_);
+        source = fused_source->source_;
+    }
+    else {
+        stages = std::make_shared<FusedStageList>();
+    }
+
+    stages->push_back(std::move(stage));
+    return std::make_shared<FusedOperator>(std::move(source), std::move(stages));
+}
+
+
+FusedOperator::FusedOperator(
+    std::shared_ptr<ObservableCore> source,
+    std::shared_ptr<const FusedStageList> stages) 
+    :
+    source_(std::move(source)),
+    stages_(std::move(stages)) {
+
+    ZAF_EXPECT(source_);
+    ZAF_EXPECT(stages_);
+}
+
+
+std::shared_ptr<Disposable> FusedOperator::Subscribe(ObserverShim&& observer) {
+
+    auto producer = std::make_shared<FusedProducer>(std::move(observer), stages_);
+    producer->Run(source_);
+    return producer;
+}
+
+}
\ No newline at end of file
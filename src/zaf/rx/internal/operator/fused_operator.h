@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <variant>
+#include <vector>
+#include <zaf/rx/internal/observable/observable_core.h>
+#include <zaf/rx/internal/operator/filter_predicate.h>
+#include <zaf/rx/internal/operator/mapper.h>
+
+namespace zaf::rx::internal {
+
+/**
+A stateless synchronous stage that can be fused with adjacent stages. It is either a Map stage, a
+Filter stage, or a Do stage.
+*/
+using FusedStage = std::variant<Mapper, FilterPredicate, std::shared_ptr<ObserverCore>>;
+using FusedStageList = std::vector<FusedStage>;
+
+/**
+An operator that runs a chain of adjacent Map, Filter and Do stages within a single producer.
+
+@details
+    Appending a stage to a FusedOperator creates a new FusedOperator that shares the same source
+    and contains all existing stages plus the new one, rather than wrapping the existing operator.
+    So a chain of such stages costs one producer and one observer per subscription, and each item
+    is passed between stages by direct calls, instead of going through one producer per stage.
+*/
+class FusedOperator : public ObservableCore {
+public:
+    /**
+    Appends the specified stage to the specified source.
+
+    @return
+        If the source is a FusedOperator, a new FusedOperator that shares the source of it, with 
+        the stage appended to its stages; otherwise, a new FusedOperator that contains only the 
+        stage.
+    */
+    static std::shared_ptr<FusedOperator> Append(
+        std::shared_ptr<ObservableCore> source,
+        FusedStage stage);
+
+public:
+    FusedOperator(
+        std::shared_ptr<ObservableCore> source,
+        std::shared_ptr<const FusedStageList> stages);
+
+    std::shared_ptr<Disposable> Subscribe(ObserverShim&& observer) override;
+
+private:
+    std::shared_ptr<ObservableCore> source_;
+    std::shared_ptr<const FusedStageList> stages_;
+};
+
+}
\ No newline at end of file
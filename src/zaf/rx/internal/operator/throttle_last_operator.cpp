@@ -32,18 +32,23 @@ public:
     }
 
     void OnNext(const std::any& value) override {
-        try {
 
-            {
-                std::lock_guard<std::mutex> lock(mutex_);
-                last_value_ = value;
-            }
+        if (IsTerminated()) {
+            return;
+        }
 
-            auto empty_timer = Disposable::Empty();
-            if (timer_.load() != empty_timer) {
-                // There is already a timer running, or the producer is disposed.
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            last_value_ = value;
+
+            // There is already a timer armed for the current period, nothing else to do.
+            if (is_timer_armed_) {
                 return;
             }
+            is_timer_armed_ = true;
+        }
+
+        try {
 
             std::weak_ptr<ThrottleLastProducer> weak_this =
                 As<ThrottleLastProducer>(shared_from_this());
@@ -54,12 +59,17 @@ public:
                 }
             });
 
+            auto empty_timer = Disposable::Empty();
             if (!timer_.compare_exchange_strong(empty_timer, new_timer)) {
-                // Another thread has set a new timer or disposed the producer.
+                // The producer has been disposed.
                 new_timer->Dispose();
             }
         }
         catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                is_timer_armed_ = false;
+            }
             EmitOnError(std::current_exception());
         }
     }
@@ -98,6 +108,8 @@ private:
         {
             std::lock_guard<std::mutex> lock(mutex_);
             value = std::move(last_value_);
+            last_value_.reset();
+            is_timer_armed_ = false;
         }
 
         if (value.has_value()) {
@@ -130,6 +142,7 @@ private:
 
     std::mutex mutex_;
     std::any last_value_;
+    bool is_timer_armed_{};
 };
 
 } // namespace
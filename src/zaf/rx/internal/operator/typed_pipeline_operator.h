@@ -0,0 +1,265 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <zaf/base/as.h>
+#include <zaf/base/auto_reset.h>
+#include <zaf/rx/internal/observable/observable_core.h>
+#include <zaf/rx/internal/observer_core.h>
+#include <zaf/rx/internal/producer.h>
+
+namespace zaf::rx::internal {
+
+enum class TypedStageKind {
+    Map,
+    Filter,
+    Do,
+};
+
+/*
+Stages of a typed pipeline. Each stage holds the concrete type of its function, so that calls to
+the function can be resolved, and usually inlined, at compile time.
+*/
+template<typename F>
+class MapStage {
+public:
+    static constexpr TypedStageKind Kind = TypedStageKind::Map;
+
+    explicit MapStage(F function) : function(std::move(function)) { }
+
+    F function;
+};
+
+template<typename F>
+class FilterStage {
+public:
+    static constexpr TypedStageKind Kind = TypedStageKind::Filter;
+
+    explicit FilterStage(F function) : function(std::move(function)) { }
+
+    F function;
+};
+
+template<typename F>
+class DoStage {
+public:
+    static constexpr TypedStageKind Kind = TypedStageKind::Do;
+
+    explicit DoStage(F function) : function(std::move(function)) { }
+
+    F function;
+};
+
+
+/*
+A sink that emits the output values of a typed pipeline as type-erased values, so that the
+pipeline can be chained with other operators.
+*/
+class AnyEmitSink {
+public:
+    template<typename V>
+    void operator()(Producer& producer, V&& value) {
+        producer.EmitOnNext(std::any{ std::forward<V>(value) });
+    }
+};
+
+
+/*
+A sink that invokes a typed item handler directly, without type-erasing the output values.
+*/
+template<typename K>
+class TypedEmitSink {
+public:
+    explicit TypedEmitSink(std::function<void(const K&)> on_next) : on_next_(std::move(on_next)) {
+
+    }
+
+    template<typename V>
+    void operator()(Producer& producer, V&& value) {
+        if (on_next_ && !producer.IsTerminated()) {
+            on_next_(value);
+        }
+    }
+
+private:
+    std::function<void(const K&)> on_next_;
+};
+
+
+/*
+A producer that runs all stages of a typed pipeline within a single OnNext() call. The value
+emitted by the source is cast to T only once, and intermediate values are passed between stages
+with their static types.
+*/
+template<typename T, typename SINK, typename... STAGES>
+class TypedPipelineProducer : public Producer, public ObserverCore {
+public:
+    TypedPipelineProducer(
+        ObserverShim&& next_observer,
+        std::tuple<STAGES...> stages,
+        SINK sink)
+        :
+        Producer(std::move(next_observer)),
+        stages_(std::move(stages)),
+        sink_(std::move(sink)) {
+
+    }
+
+    ~TypedPipelineProducer() {
+        DoDisposal();
+    }
+
+    void Run(const std::shared_ptr<ObservableCore>& source) {
+        source_subscription_ = source->Subscribe(
+            ObserverShim::FromWeak(As<ObserverCore>(shared_from_this())));
+    }
+
+    void OnNext(const std::any& value) override {
+        if (IsTerminated()) {
+            return;
+        }
+
+        {
+            auto auto_reset = MakeAutoReset(is_running_stages_, true);
+            RunStage<0>(std::any_cast<const T&>(value));
+        }
+
+        if (has_pending_release_ && !is_running_stages_) {
+            ReleaseStages();
+        }
+    }
+
+    void OnError(const std::exception_ptr& error) override {
+        EmitOnError(error);
+    }
+
+    void OnCompleted() override {
+        EmitOnCompleted();
+    }
+
+protected:
+    void OnDispose() noexcept override {
+        DoDisposal();
+    }
+
+private:
+    template<std::size_t INDEX, typename V>
+    void RunStage(V&& value) {
+
+        if constexpr (INDEX == sizeof...(STAGES)) {
+            (*sink_)(*this, std::forward<V>(value));
+        }
+        else {
+            auto& stage = std::get<INDEX>(*stages_);
+            using StageType = std::decay_t<decltype(stage)>;
+
+            // Exceptions thrown in stage functions should be propagated to the downstream OnError
+            // handler, while exceptions thrown in downstream handlers are not caught here.
+            if constexpr (StageType::Kind == TypedStageKind::Map) {
+
+                using MappedType = std::decay_t<
+                    std::invoke_result_t<decltype(stage.function)&, const std::decay_t<V>&>>;
+
+                std::optional<MappedType> mapped_value;
+                try {
+                    mapped_value.emplace(std::invoke(stage.function, std::as_const(value)));
+                }
+                catch (...) {
+                    EmitOnError(std::current_exception());
+                    return;
+                }
+                RunStage<INDEX + 1>(std::move(*mapped_value));
+            }
+            else if constexpr (StageType::Kind == TypedStageKind::Filter) {
+
+                bool can_emit{};
+                try {
+                    can_emit = std::invoke(stage.function, std::as_const(value));
+                }
+                catch (...) {
+                    EmitOnError(std::current_exception());
+                    return;
+                }
+
+                if (can_emit) {
+                    RunStage<INDEX + 1>(std::forward<V>(value));
+                }
+            }
+            else {
+
+                try {
+                    std::invoke(stage.function, std::as_const(value));
+                }
+                catch (...) {
+                    EmitOnError(std::current_exception());
+                    return;
+                }
+                RunStage<INDEX + 1>(std::forward<V>(value));
+            }
+        }
+    }
+
+    void DoDisposal() noexcept {
+        if (source_subscription_) {
+            source_subscription_->Dispose();
+            source_subscription_.reset();
+        }
+
+        // Stages and the sink might hold resources captured by their functions, so they are 
+        // released once the producer is disposed or terminated. If it happens within a stage or 
+        // the sink, they are released after running, as they can't be destroyed while running.
+        if (is_running_stages_) {
+            has_pending_release_ = true;
+            return;
+        }
+        ReleaseStages();
+    }
+
+    void ReleaseStages() noexcept {
+        stages_.reset();
+        sink_.reset();
+        has_pending_release_ = false;
+    }
+
+private:
+    std::shared_ptr<Disposable> source_subscription_;
+    std::optional<std::tuple<STAGES...>> stages_;
+    std::optional<SINK> sink_;
+    bool is_running_stages_{};
+    bool has_pending_release_{};
+};
+
+
+/*
+An observable core that runs a typed pipeline over the values emitted by the source and emits the
+output values as type-erased values.
+*/
+template<typename T, typename... STAGES>
+class TypedPipelineOperator : public ObservableCore {
+public:
+    TypedPipelineOperator(std::shared_ptr<ObservableCore> source, std::tuple<STAGES...> stages) :
+        source_(std::move(source)),
+        stages_(std::move(stages)) {
+
+    }
+
+    std::shared_ptr<Disposable> Subscribe(ObserverShim&& observer) override {
+
+        auto producer = std::make_shared<TypedPipelineProducer<T, AnyEmitSink, STAGES...>>(
+            std::move(observer),
+            stages_,
+            AnyEmitSink{});
+
+        producer->Run(source_);
+        return producer;
+    }
+
+private:
+    std::shared_ptr<ObservableCore> source_;
+    std::tuple<STAGES...> stages_;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include <zaf/rx/internal/operator/window_operator.h>
+#include <mutex>
+#include <zaf/base/as.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/rx/internal/observer_core.h>
+#include <zaf/rx/internal/producer.h>
+#include <zaf/rx/internal/subject/subject_core.h>
+
+namespace zaf::rx::internal {
+namespace {
+
+class WindowProducer : public Producer, public ObserverCore {
+public:
+    WindowProducer(
+        ObserverShim&& observer,
+        std::optional<std::size_t> count,
+        std::optional<std::chrono::steady_clock::duration> period,
+        std::shared_ptr<Scheduler> scheduler,
+        WindowPacker packer) noexcept
+        :
+        Producer(std::move(observer)),
+        count_(count),
+        period_(period),
+        scheduler_(std::move(scheduler)),
+        packer_(std::move(packer)),
+        timer_(Disposable::Empty()) {
+
+    }
+
+    ~WindowProducer() {
+        DoDisposal();
+    }
+
+    void Run(const std::shared_ptr<ObservableCore>& source) {
+
+        source_sub_ = source->Subscribe(
+            ObserverShim::FromShared(As<ObserverCore>(shared_from_this())));
+
+        if (!period_) {
+            return;
+        }
+
+        try {
+            StartNextPeriod();
+        }
+        catch (...) {
+            source_sub_->Dispose();
+            source_sub_.reset();
+            throw;
+        }
+    }
+
+    void OnNext(const std::any& value) override {
+
+        // The item is emitted to the window under the lock, so that a period end can't complete
+        // the window in between.
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        std::shared_ptr<SubjectCore> window;
+        bool is_new_window{};
+        bool is_window_full{};
+        try {
+            // Windows are opened lazily, so that no empty window is emitted.
+            if (!current_window_) {
+                current_window_ = std::make_shared<SubjectCore>();
+                current_window_item_count_ = 0;
+                is_new_window = true;
+            }
+
+            window = current_window_;
+            ++current_window_item_count_;
+            if (count_ && current_window_item_count_ >= *count_) {
+                current_window_.reset();
+                is_window_full = true;
+            }
+        }
+        catch (...) {
+            EmitOnError(std::current_exception());
+            return;
+        }
+
+        if (is_new_window) {
+
+            std::any packed_window;
+            try {
+                packed_window = packer_(window);
+            }
+            catch (...) {
+                EmitOnError(std::current_exception());
+                return;
+            }
+
+            if (!EmitOnNext(packed_window)) {
+                return;
+            }
+        }
+
+        window->OnNext(value);
+
+        if (is_window_full) {
+            window->OnCompleted();
+        }
+    }
+
+    void OnError(const std::exception_ptr& error) override {
+        CancelTimer();
+
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (auto window = std::move(current_window_)) {
+            window->OnError(error);
+        }
+        EmitOnError(error);
+    }
+
+    void OnCompleted() override {
+        CancelTimer();
+
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (auto window = std::move(current_window_)) {
+            window->OnCompleted();
+        }
+        EmitOnCompleted();
+    }
+
+protected:
+    void OnDispose() noexcept override {
+        DoDisposal();
+    }
+
+private:
+    void StartNextPeriod() {
+
+        std::weak_ptr<WindowProducer> weak_this = As<WindowProducer>(shared_from_this());
+        auto new_timer = scheduler_->ScheduleDelayedWork(*period_, [weak_this]() {
+            if (auto shared_this = weak_this.lock()) {
+                shared_this->OnPeriodEnd();
+            }
+        });
+
+        auto expected = Disposable::Empty();
+        if (!timer_.compare_exchange_strong(expected, new_timer)) {
+            // The producer has been terminated or disposed.
+            new_timer->Dispose();
+        }
+    }
+
+    void OnPeriodEnd() {
+
+        auto previous_timer = timer_.exchange(Disposable::Empty());
+        if (!previous_timer) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(mutex_);
+            if (auto window = std::move(current_window_)) {
+                window->OnCompleted();
+            }
+        }
+
+        try {
+            StartNextPeriod();
+        }
+        catch (...) {
+            EmitOnError(std::current_exception());
+        }
+    }
+
+    void CancelTimer() noexcept {
+        auto timer = timer_.exchange(nullptr);
+        if (timer) {
+            timer->Dispose();
+        }
+    }
+
+    void DoDisposal() noexcept {
+        CancelTimer();
+        if (source_sub_) {
+            source_sub_->Dispose();
+            source_sub_.reset();
+        }
+    }
+
+private:
+    std::optional<std::size_t> count_;
+    std::optional<std::chrono::steady_clock::duration> period_;
+    // Kept alive as long as the producer, since a period end may be starting the next period while
+    // the producer is being disposed.
+    const std::shared_ptr<Scheduler> scheduler_;
+    WindowPacker packer_;
+
+    std::shared_ptr<Disposable> source_sub_;
+    std::atomic<std::shared_ptr<Disposable>> timer_;
+
+    // Guards the current window and serializes emissions, which come from both the source and the
+    // timer. It's recursive so that an observer can emit items to the source synchronously.
+    std::recursive_mutex mutex_;
+    std::shared_ptr<SubjectCore> current_window_;
+    std::size_t current_window_item_count_{};
+};
+
+}
+
+WindowOperator::WindowOperator(
+    std::shared_ptr<ObservableCore> source,
+    std::optional<std::size_t> count,
+    std::optional<std::chrono::steady_clock::duration> period,
+    std::shared_ptr<Scheduler> scheduler,
+    WindowPacker packer)
+    :
+    source_(std::move(source)),
+    count_(count),
+    period_(period),
+    scheduler_(std::move(scheduler)),
+    packer_(std::move(packer)) {
+
+    ZAF_EXPECT(source_);
+    ZAF_EXPECT(count_ || period_);
+    ZAF_EXPECT(!count_ || *count_ > 0);
+    ZAF_EXPECT(!period_ || scheduler_);
+    ZAF_EXPECT(packer_);
+}
+
+
+std::shared_ptr<Disposable> WindowOperator::Subscribe(ObserverShim&& observer) {
+
+    auto producer = std::make_shared<WindowProducer>(
+        std::move(observer),
+        count_,
+        period_,
+        scheduler_,
+        packer_);
+
+    producer->Run(source_);
+    return producer;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <zaf/rx/internal/observable/observable_core.h>
+#include <zaf/rx/internal/operator/window_packer.h>
+#include <zaf/rx/scheduler/scheduler.h>
+
+namespace zaf::rx::internal {
+
+/*
+Splits items into windows and emits each window as an observable, which is completed either when
+it has received enough items or when a time period ends, whichever comes first.
+*/
+class WindowOperator : public ObservableCore {
+public:
+    WindowOperator(
+        std::shared_ptr<ObservableCore> source,
+        std::optional<std::size_t> count,
+        std::optional<std::chrono::steady_clock::duration> period,
+        std::shared_ptr<Scheduler> scheduler,
+        WindowPacker packer);
+
+    std::shared_ptr<Disposable> Subscribe(ObserverShim&& observer) override;
+
+private:
+    std::shared_ptr<ObservableCore> source_;
+    std::optional<std::size_t> count_;
+    std::optional<std::chrono::steady_clock::duration> period_;
+    std::shared_ptr<Scheduler> scheduler_;
+    WindowPacker packer_;
+};
+
+}
\ No newline at end of file
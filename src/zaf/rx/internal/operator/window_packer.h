@@ -0,0 +1,16 @@
+#pragma once
+
+#include <any>
+#include <functional>
+#include <memory>
+
+namespace zaf::rx::internal {
+
+class ObservableCore;
+
+/*
+Wraps the core of a window into a single item of the typed observable.
+*/
+using WindowPacker = std::function<std::any(std::shared_ptr<ObservableCore>)>;
+
+}
\ No newline at end of file
@@ -53,6 +53,12 @@ public:
 
     bool IsDisposed() const noexcept override;
 
+    /**
+    Indicates whether the producer is terminated, either by emitting an error or a completion, or 
+    by being disposed.
+    */
+    bool IsTerminated() const noexcept;
+
 protected:
     bool EnsureDisposed() noexcept override final;
 
@@ -66,8 +72,6 @@ protected:
     virtual void OnDispose() noexcept { }
 
 private:
-    bool IsTerminated() const noexcept;
-
     /**
     Marks the producer as terminated.
 
@@ -40,7 +40,8 @@ private:
 MulticastObserver::~MulticastObserver() {
 
     //Dispose all producers.
-    for (const auto& each_producer : producers_) {
+    auto producers = producers_.load();
+    for (const auto& each_producer : *producers) {
         auto producer = each_producer.lock();
         if (producer) {
             producer->Dispose();
@@ -60,7 +61,9 @@ std::shared_ptr<Disposable> MulticastObserver::AddObserver(ObserverShim&& observ
                 std::move(observer), 
                 shared_from_this());
 
-            producers_.push_back(producer);
+            auto new_producers = std::make_shared<ProducerList>(*producers_.load());
+            new_producers->push_back(producer);
+            producers_.store(std::move(new_producers));
             return producer;
         }
         termination = termination_;
@@ -79,18 +82,16 @@ std::shared_ptr<Disposable> MulticastObserver::AddObserver(ObserverShim&& observ
 
 
 std::size_t MulticastObserver::ObserverCount() const noexcept {
-    std::lock_guard<std::mutex> lock(lock_);
-    return producers_.size();
+    return producers_.load()->size();
 }
 
 
 void MulticastObserver::OnNext(const std::any& value) {
-    std::vector<std::weak_ptr<IndividualProducer>> copied_producers;
-    {
-        std::lock_guard<std::mutex> lock(lock_);
-        copied_producers = producers_;
-    }
-    for (const auto& each_producer : copied_producers) {
+
+    //The loaded list is immutable, it remains valid even if producers are added or removed during
+    //the emission.
+    auto producers = producers_.load();
+    for (const auto& each_producer : *producers) {
         if (auto producer = each_producer.lock()) {
             producer->EmitOnNext(value);
         }
@@ -99,13 +100,13 @@ void MulticastObserver::OnNext(const std::any& value) {
 
 
 void MulticastObserver::OnError(const std::exception_ptr& error) {
-    std::vector<std::weak_ptr<IndividualProducer>> copied_producers;
+    std::shared_ptr<const ProducerList> producers;
     {
         std::lock_guard<std::mutex> lock(lock_);
-        copied_producers = producers_;
+        producers = producers_.load();
         termination_ = error;
     }
-    for (const auto& each_producer : copied_producers) {
+    for (const auto& each_producer : *producers) {
         if (auto producer = each_producer.lock()) {
             producer->EmitOnError(error);
         }
@@ -114,13 +115,13 @@ void MulticastObserver::OnError(const std::exception_ptr& error) {
 
 
 void MulticastObserver::OnCompleted() {
-    std::vector<std::weak_ptr<IndividualProducer>> copied_producers;
+    std::shared_ptr<const ProducerList> producers;
     {
         std::lock_guard<std::mutex> lock(lock_);
-        copied_producers = producers_;
+        producers = producers_.load();
         termination_ = None{};
     }
-    for (const auto& each_producer : copied_producers) {
+    for (const auto& each_producer : *producers) {
         if (auto producer = each_producer.lock()) {
             producer->EmitOnCompleted();
         }
@@ -129,11 +130,21 @@ void MulticastObserver::OnCompleted() {
 
 
 void MulticastObserver::RemoveProducer(IndividualProducer* producer) noexcept {
+
     std::lock_guard<std::mutex> lock(lock_);
-    EraseIf(producers_, [producer](const auto& each) {
-        auto each_shared = each.lock();
-        return !each_shared || each_shared.get() == producer;
-    });
+    try {
+
+        auto new_producers = std::make_shared<ProducerList>(*producers_.load());
+        EraseIf(*new_producers, [producer](const auto& each) {
+            auto each_shared = each.lock();
+            return !each_shared || each_shared.get() == producer;
+        });
+        producers_.store(std::move(new_producers));
+    }
+    catch (const std::bad_alloc&) {
+        //The producer is either disposed or destroyed, so it is fine to leave it in the list. It 
+        //will be removed along with the next removal.
+    }
 }
 
 }
\ No newline at end of file
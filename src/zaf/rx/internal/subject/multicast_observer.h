@@ -1,12 +1,24 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <variant>
+#include <vector>
 #include <zaf/base/none.h>
 #include <zaf/rx/internal/observer_core.h>
 #include <zaf/rx/internal/producer.h>
 
 namespace zaf::rx::internal {
 
+/**
+An observer that multicasts emissions to multiple producers.
+
+@details
+    Producers are kept in an immutable list, which is replaced atomically as a whole when a 
+    producer is added or removed. So emissions only need to load the current list, without copying
+    it or taking the lock, while adding and removing producers are serialized by the lock.
+*/
 class MulticastObserver : 
     public ObserverCore, 
     public std::enable_shared_from_this<MulticastObserver> {
@@ -24,13 +36,17 @@ public:
     
 private:
     class IndividualProducer;
+    using ProducerList = std::vector<std::weak_ptr<IndividualProducer>>;
 
 private:
     void RemoveProducer(IndividualProducer*) noexcept;
 
 private:
-    mutable std::mutex lock_;
-    std::vector<std::weak_ptr<IndividualProducer>> producers_;
+    //Guards modifications of producers_ and termination_.
+    std::mutex lock_;
+    std::atomic<std::shared_ptr<const ProducerList>> producers_{ 
+        std::make_shared<const ProducerList>() 
+    };
     //std::exception_ptr for error termination; None for normal termination.
     std::variant<std::monostate, std::exception_ptr, None> termination_;
 };
@@ -0,0 +1,74 @@
+#include <zaf/rx/internal/subject/replay_buffer.h>
+#include <algorithm>
+
+namespace zaf::rx::internal {
+namespace {
+
+constexpr std::size_t MinGrowingCapacity = 16;
+
+}
+
+ReplayBuffer::ReplayBuffer(std::optional<std::size_t> max_count) : max_count_(max_count) {
+
+}
+
+
+void ReplayBuffer::PushBack(std::any value, TimePoint time_point) {
+
+    if (max_count_ == 0) {
+        return;
+    }
+
+    if (count_ == entries_.size()) {
+        if (count_ == max_count_) {
+            PopFront();
+        }
+        else {
+            Grow();
+        }
+    }
+
+    auto& entry = entries_[(head_ + count_) % entries_.size()];
+    entry.value = std::move(value);
+    entry.time_point = time_point;
+    ++count_;
+}
+
+
+void ReplayBuffer::DropBefore(TimePoint time_point) noexcept {
+
+    while (count_ > 0 && (*this)[0].time_point < time_point) {
+        PopFront();
+    }
+}
+
+
+void ReplayBuffer::PopFront() noexcept {
+
+    // Release the value immediately rather than waiting for it to be overwritten.
+    entries_[head_].value.reset();
+    head_ = (head_ + 1) % entries_.size();
+    --count_;
+}
+
+
+void ReplayBuffer::Grow() {
+
+    auto new_capacity = std::max(entries_.size() * 2, MinGrowingCapacity);
+    if (max_count_) {
+        new_capacity = std::min(new_capacity, *max_count_);
+    }
+
+    std::vector<Entry> new_entries;
+    new_entries.resize(new_capacity);
+
+    for (std::size_t index = 0; index < count_; ++index) {
+        auto& entry = entries_[(head_ + index) % entries_.size()];
+        new_entries[index] = std::move(entry);
+    }
+
+    entries_ = std::move(new_entries);
+    head_ = 0;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <any>
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace zaf::rx::internal {
+
+/**
+A ring buffer that stores values to be replayed, along with the time points they were emitted.
+
+@details
+    The storage grows as needed. If the buffer has a max count, the storage never grows beyond it,
+    and the oldest value is overwritten once the buffer is full.
+
+    This class is not thread-safe.
+*/
+class ReplayBuffer {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    class Entry {
+    public:
+        std::any value;
+        TimePoint time_point;
+    };
+
+public:
+    explicit ReplayBuffer(std::optional<std::size_t> max_count);
+
+    std::size_t Count() const noexcept {
+        return count_;
+    }
+
+    std::size_t Capacity() const noexcept {
+        return entries_.size();
+    }
+
+    /**
+    Gets the entry at the specified index, where index 0 is the oldest entry.
+    */
+    const Entry& operator[](std::size_t index) const noexcept {
+        return entries_[(head_ + index) % entries_.size()];
+    }
+
+    /**
+    Appends a value to the buffer, dropping the oldest value if the buffer is full.
+    */
+    void PushBack(std::any value, TimePoint time_point);
+
+    /**
+    Drops values that were emitted before the specified time point.
+    */
+    void DropBefore(TimePoint time_point) noexcept;
+
+private:
+    void PopFront() noexcept;
+    void Grow();
+
+private:
+    std::optional<std::size_t> max_count_;
+    std::vector<Entry> entries_;
+    std::size_t head_{};
+    std::size_t count_{};
+};
+
+}
\ No newline at end of file
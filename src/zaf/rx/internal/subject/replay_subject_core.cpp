@@ -1,29 +1,44 @@
 #include <zaf/rx/internal/subject/replay_subject_core.h>
+#include <atomic>
 
 namespace zaf::rx::internal {
 
-ReplaySubjectCore::ReplaySubjectCore(std::optional<std::size_t> replay_size) noexcept :
-    replay_size_(replay_size) {
+ReplaySubjectCore::ReplaySubjectCore(
+    std::optional<std::size_t> replay_size,
+    std::optional<std::chrono::steady_clock::duration> replay_window)
+    :
+    replay_size_(replay_size),
+    replay_window_(replay_window),
+    replay_buffer_(std::make_shared<ReplayBuffer>(replay_size)) {
 
 }
 
 
 std::shared_ptr<Disposable> ReplaySubjectCore::Subscribe(ObserverShim&& observer) {
 
-    std::deque<std::any> copied_replay_values;
+    std::shared_ptr<const ReplayBuffer> replay_buffer;
     {
         std::lock_guard<std::mutex> lock(lock_);
-        copied_replay_values = replay_values_;
+        replay_buffer = replay_buffer_;
     }
 
     //This instance may be destroyed during the emissions.
     //Keep it alive here.
     auto shared_this = shared_from_this();
 
-    for (const auto& each_value : copied_replay_values) {
-        observer.OnNext(each_value);
+    auto expired_time_point = GetExpiredTimePoint(std::chrono::steady_clock::now());
+    for (std::size_t index = 0; index < replay_buffer->Count(); ++index) {
+
+        const auto& entry = (*replay_buffer)[index];
+        if (expired_time_point && entry.time_point < *expired_time_point) {
+            continue;
+        }
+        observer.OnNext(entry.value);
     }
 
+    //Release the buffer as soon as possible, so that following emissions don't need to copy it.
+    replay_buffer.reset();
+
     return __super::Subscribe(std::move(observer));
 }
 
@@ -38,11 +53,39 @@ void ReplaySubjectCore::OnNext(const std::any& value) {
         return;
     }
 
+    auto now = std::chrono::steady_clock::now();
+
     std::lock_guard<std::mutex> lock(lock_);
-    if (replay_values_.size() == replay_size_) {
-        replay_values_.pop_front();
+
+    if (replay_buffer_.use_count() > 1) {
+        replay_buffer_ = std::make_shared<ReplayBuffer>(*replay_buffer_);
+    }
+    else {
+        //Pairs with the release of the buffer by subscribers, so that their reads of the buffer 
+        //happen before the following modification.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    auto expired_time_point = GetExpiredTimePoint(now);
+    if (expired_time_point) {
+        replay_buffer_->DropBefore(*expired_time_point);
+    }
+    replay_buffer_->PushBack(value, now);
+}
+
+
+std::optional<ReplayBuffer::TimePoint> ReplaySubjectCore::GetExpiredTimePoint(
+    ReplayBuffer::TimePoint now) const noexcept {
+
+    if (!replay_window_) {
+        return std::nullopt;
+    }
+
+    //Avoid overflow for large windows.
+    if (*replay_window_ >= now.time_since_epoch()) {
+        return std::nullopt;
     }
-    replay_values_.push_back(value);
+    return now - *replay_window_;
 }
 
 }
\ No newline at end of file
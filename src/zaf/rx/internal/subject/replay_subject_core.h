@@ -1,22 +1,37 @@
 #pragma once
 
-#include <deque>
+#include <chrono>
 #include <mutex>
+#include <optional>
+#include <zaf/rx/internal/subject/replay_buffer.h>
 #include <zaf/rx/internal/subject/subject_core.h>
 
 namespace zaf::rx::internal {
 
 class ReplaySubjectCore : public SubjectCore {
 public:
-    explicit ReplaySubjectCore(std::optional<std::size_t> replay_size) noexcept;
+    ReplaySubjectCore(
+        std::optional<std::size_t> replay_size,
+        std::optional<std::chrono::steady_clock::duration> replay_window);
 
     std::shared_ptr<Disposable> Subscribe(ObserverShim&& observer) override;
 
     void OnNext(const std::any& value) override;
 
+private:
+    /**
+    Gets the time point before which values are expired, or std::nullopt if values never expire.
+    */
+    std::optional<ReplayBuffer::TimePoint> GetExpiredTimePoint(
+        ReplayBuffer::TimePoint now) const noexcept;
+
 private:
     const std::optional<std::size_t> replay_size_;
-    std::deque<std::any> replay_values_;
+    const std::optional<std::chrono::steady_clock::duration> replay_window_;
+
+    //The buffer is shared with subscribers while they are replaying values, so that they don't 
+    //need to copy it. It is copied before modifying if it is being shared.
+    std::shared_ptr<ReplayBuffer> replay_buffer_;
     std::mutex lock_;
 };
 
@@ -9,8 +9,11 @@ std::shared_ptr<SubjectCore> CreateSubjectCore() {
 }
 
 
-std::shared_ptr<SubjectCore> CreateReplaySubjectCore(std::optional<std::size_t> replay_size) {
-    return std::make_shared<zaf::rx::internal::ReplaySubjectCore>(replay_size);
+std::shared_ptr<SubjectCore> CreateReplaySubjectCore(
+    std::optional<std::size_t> replay_size,
+    std::optional<std::chrono::steady_clock::duration> replay_window) {
+
+    return std::make_shared<zaf::rx::internal::ReplaySubjectCore>(replay_size, replay_window);
 }
 
 
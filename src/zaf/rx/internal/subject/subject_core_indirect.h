@@ -1,6 +1,8 @@
 ﻿#pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
 /**
 Here are indirect access functions to SubjectCore, to avoid implicit dependencies to internal 
@@ -14,7 +16,9 @@ class ObserverCore;
 class SubjectCore;
 
 std::shared_ptr<SubjectCore> CreateSubjectCore();
-std::shared_ptr<SubjectCore> CreateReplaySubjectCore(std::optional<std::size_t> replay_size);
+std::shared_ptr<SubjectCore> CreateReplaySubjectCore(
+    std::optional<std::size_t> replay_size,
+    std::optional<std::chrono::steady_clock::duration> replay_window);
 
 std::shared_ptr<ObservableCore> AsObservableCore(const std::shared_ptr<SubjectCore>& core);
 std::shared_ptr<ObserverCore> AsObserverCore(const std::shared_ptr<SubjectCore>& core);
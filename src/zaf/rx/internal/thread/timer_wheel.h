@@ -0,0 +1,426 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <zaf/base/non_copyable.h>
+
+namespace zaf::rx::internal {
+
+/*
+A hierarchical timing wheel that stores values by their due time points.
+
+Time is divided into ticks starting from the origin. A value due at time point t belongs to tick
+ceil((t - origin) / tick_duration), so it is never taken before it is due. Each level has 64
+slots, and a slot in level L spans 64^L ticks. Values are placed into the lowest level whose slot
+range contains their tick, and are cascaded to lower levels when the wheel reaches their slot.
+Values beyond the top level are kept in an overflow list and are re-placed whenever the wheel
+crosses a top level boundary.
+
+Inserting and erasing are O(1). Taking due values is amortized O(1) per value, plus a sort within
+each due slot to keep values ordered by their time points, and by their inserting order for equal
+time points.
+
+This class is not thread-safe.
+*/
+template<typename T>
+class TimerWheel : NonCopyableNonMovable {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+    using Duration = std::chrono::steady_clock::duration;
+
+    class Entry {
+    public:
+        T value;
+        TimePoint time_point;
+
+    private:
+        friend class TimerWheel;
+
+        Entry(T value, TimePoint time_point, std::uint64_t tick, std::uint64_t sequence) :
+            value(std::move(value)),
+            time_point(time_point),
+            tick(tick),
+            sequence(sequence) {
+
+        }
+
+        std::uint64_t tick{};
+        std::uint64_t sequence{};
+        std::uint8_t level{};
+        std::uint8_t slot{};
+    };
+
+    using EntryList = std::list<Entry>;
+
+    /*
+    A handle to an inserted value, which can be used to erase the value. It remains valid until
+    the value is erased or taken.
+    */
+    using Handle = typename EntryList::iterator;
+
+public:
+    explicit TimerWheel(
+        TimePoint origin,
+        Duration tick_duration = std::chrono::milliseconds(1)) noexcept
+        :
+        origin_(origin),
+        tick_duration_(tick_duration) {
+
+    }
+
+    std::size_t Count() const noexcept {
+        return count_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return count_ == 0;
+    }
+
+    Handle Insert(TimePoint time_point, T value) {
+
+        auto tick = TickOfTimePoint(time_point);
+
+        EntryList new_entries;
+        new_entries.push_back(Entry{ std::move(value), time_point, tick, next_sequence_ });
+
+        auto handle = new_entries.begin();
+        Place(new_entries, handle);
+
+        next_sequence_++;
+        count_++;
+        return handle;
+    }
+
+    void Erase(Handle handle) noexcept {
+
+        auto level = handle->level;
+        auto slot = handle->slot;
+
+        auto& list = ListOfEntry(level, slot);
+        list.erase(handle);
+
+        if (level < LevelCount && list.empty()) {
+            levels_[level].occupancy &= ~(std::uint64_t(1) << slot);
+        }
+        count_--;
+    }
+
+    /*
+    Takes all values that are due at the specified time point, in the order of their time points.
+    Values with the same time point are taken in their inserting order.
+
+    The callback is called with each value as an rvalue reference.
+    */
+    template<typename C>
+    void TakeDueValues(TimePoint now, C&& callback) {
+
+        EntryList due_entries;
+
+        if (!pending_due_entries_.empty()) {
+            SortEntries(pending_due_entries_);
+            due_entries.splice(due_entries.end(), pending_due_entries_);
+        }
+
+        if (now >= origin_) {
+
+            std::uint64_t target_tick = (now - origin_) / tick_duration_;
+
+            while (true) {
+
+                auto event_tick = NextEventTick();
+                if (!event_tick || *event_tick > target_tick) {
+                    break;
+                }
+
+                ProcessTick(*event_tick, due_entries);
+            }
+
+            // No value is due between the current tick and the target tick, so it is safe to
+            // skip them.
+            if (current_tick_ <= target_tick) {
+                current_tick_ = target_tick + 1;
+            }
+        }
+
+        count_ -= due_entries.size();
+
+        for (auto& each_entry : due_entries) {
+            callback(std::move(each_entry.value));
+        }
+    }
+
+    /*
+    Gets a time point that is not later than the time point of the earliest value, at which
+    TakeDueValues() should be called again. Returns std::nullopt if there is no value.
+
+    The returned time point may be earlier than the actual one if the earliest value is in a
+    higher level, as the value has to be cascaded at that time point.
+    */
+    std::optional<TimePoint> NextTimePoint() const noexcept {
+
+        if (!pending_due_entries_.empty()) {
+
+            auto result = pending_due_entries_.front().time_point;
+            for (const auto& each_entry : pending_due_entries_) {
+                result = (std::min)(result, each_entry.time_point);
+            }
+            return result;
+        }
+
+        auto event_tick = NextEventTick();
+        if (!event_tick) {
+            return std::nullopt;
+        }
+        return origin_ + tick_duration_ * (*event_tick);
+    }
+
+    /*
+    Takes all values regardless of their time points, in no particular order.
+    */
+    template<typename C>
+    void TakeAllValues(C&& callback) {
+
+        EntryList all_entries;
+        all_entries.splice(all_entries.end(), pending_due_entries_);
+        all_entries.splice(all_entries.end(), overflow_entries_);
+
+        for (auto& each_level : levels_) {
+            for (auto& each_slot : each_level.slots) {
+                all_entries.splice(all_entries.end(), each_slot);
+            }
+            each_level.occupancy = 0;
+        }
+
+        count_ = 0;
+
+        for (auto& each_entry : all_entries) {
+            callback(std::move(each_entry.value));
+        }
+    }
+
+private:
+    static constexpr std::size_t SlotBits = 6;
+    static constexpr std::size_t SlotCount = 1 << SlotBits;
+    static constexpr std::uint8_t LevelCount = 4;
+    static constexpr std::uint8_t OverflowLevel = LevelCount;
+    static constexpr std::uint8_t PendingDueLevel = LevelCount + 1;
+
+    class Level {
+    public:
+        std::array<EntryList, SlotCount> slots;
+
+        // Each bit indicates whether the corresponding slot is not empty.
+        std::uint64_t occupancy{};
+    };
+
+private:
+    static constexpr std::size_t LevelShift(std::size_t level) noexcept {
+        return level * SlotBits;
+    }
+
+    static constexpr std::uint64_t LevelMask(std::size_t level) noexcept {
+        return (std::uint64_t(1) << LevelShift(level)) - 1;
+    }
+
+    static std::uint8_t SlotIndex(std::uint64_t tick, std::size_t level) noexcept {
+        return static_cast<std::uint8_t>((tick >> LevelShift(level)) & (SlotCount - 1));
+    }
+
+    std::uint64_t TickOfTimePoint(TimePoint time_point) const noexcept {
+
+        if (time_point <= origin_) {
+            return 0;
+        }
+
+        auto duration = time_point - origin_;
+        std::uint64_t tick = duration / tick_duration_;
+        if (duration % tick_duration_ != Duration::zero()) {
+            tick++;
+        }
+        return tick;
+    }
+
+    EntryList& ListOfEntry(std::uint8_t level, std::uint8_t slot) noexcept {
+
+        if (level < LevelCount) {
+            return levels_[level].slots[slot];
+        }
+        if (level == OverflowLevel) {
+            return overflow_entries_;
+        }
+        return pending_due_entries_;
+    }
+
+    // Moves the entry from the source list into the list it belongs to, relative to the current
+    // tick.
+    void Place(EntryList& source, Handle handle) noexcept {
+
+        auto& entry = *handle;
+
+        if (entry.tick < current_tick_) {
+            entry.level = PendingDueLevel;
+            pending_due_entries_.splice(pending_due_entries_.end(), source, handle);
+            return;
+        }
+
+        for (std::uint8_t level = 0; level < LevelCount; ++level) {
+
+            auto upper_shift = LevelShift(level + 1);
+            if ((entry.tick >> upper_shift) != (current_tick_ >> upper_shift)) {
+                continue;
+            }
+
+            entry.level = level;
+            entry.slot = SlotIndex(entry.tick, level);
+
+            auto& target_level = levels_[level];
+            target_level.slots[entry.slot].splice(
+                target_level.slots[entry.slot].end(),
+                source,
+                handle);
+            target_level.occupancy |= std::uint64_t(1) << entry.slot;
+            return;
+        }
+
+        entry.level = OverflowLevel;
+        overflow_entries_.splice(overflow_entries_.end(), source, handle);
+    }
+
+    // Gets the nearest tick, starting from the current tick, at which there are due values or
+    // values need to be cascaded.
+    std::optional<std::uint64_t> NextEventTick() const noexcept {
+
+        std::optional<std::uint64_t> result;
+        auto update_result = [&result](std::uint64_t tick) {
+            if (!result || tick < *result) {
+                result = tick;
+            }
+        };
+
+        for (std::size_t level = 0; level < LevelCount; ++level) {
+
+            auto occupancy = levels_[level].occupancy;
+            if (occupancy == 0) {
+                continue;
+            }
+
+            // Slots before the current slot are never occupied. The current slot of a higher level
+            // has been cascaded, unless the current tick is at its boundary and hasn't been
+            // processed yet.
+            auto current_slot = SlotIndex(current_tick_, level);
+            bool include_current_slot = (current_tick_ & LevelMask(level)) == 0;
+
+            std::uint64_t candidate_mask = ~std::uint64_t(0) << current_slot;
+            if (!include_current_slot) {
+                // Becomes 0 if the current slot is the last one.
+                candidate_mask <<= 1;
+            }
+
+            auto candidates = occupancy & candidate_mask;
+            if (candidates == 0) {
+                continue;
+            }
+
+            auto slot = static_cast<std::uint64_t>(std::countr_zero(candidates));
+            auto upper_shift = LevelShift(level + 1);
+            auto tick =
+                ((current_tick_ >> upper_shift) << upper_shift) | (slot << LevelShift(level));
+
+            update_result(tick);
+        }
+
+        if (!overflow_entries_.empty()) {
+
+            auto top_shift = LevelShift(LevelCount);
+            if ((current_tick_ & LevelMask(LevelCount)) == 0) {
+                update_result(current_tick_);
+            }
+            else {
+                update_result(((current_tick_ >> top_shift) + 1) << top_shift);
+            }
+        }
+
+        return result;
+    }
+
+    void ProcessTick(std::uint64_t tick, EntryList& due_entries) {
+
+        current_tick_ = tick;
+
+        // Cascade from the top to bottom. Cascaded values never go to a slot that is being
+        // cascaded, as they are placed relative to the current tick.
+        if ((tick & LevelMask(LevelCount)) == 0 && !overflow_entries_.empty()) {
+            CascadeList(overflow_entries_);
+        }
+
+        for (std::size_t level = LevelCount - 1; level > 0; --level) {
+
+            if ((tick & LevelMask(level)) != 0) {
+                continue;
+            }
+
+            auto slot = SlotIndex(tick, level);
+            auto& current_level = levels_[level];
+            if ((current_level.occupancy & (std::uint64_t(1) << slot)) == 0) {
+                continue;
+            }
+
+            current_level.occupancy &= ~(std::uint64_t(1) << slot);
+            CascadeList(current_level.slots[slot]);
+        }
+
+        auto slot = SlotIndex(tick, 0);
+        auto& bottom_level = levels_[0];
+        if ((bottom_level.occupancy & (std::uint64_t(1) << slot)) != 0) {
+
+            bottom_level.occupancy &= ~(std::uint64_t(1) << slot);
+
+            auto& slot_entries = bottom_level.slots[slot];
+            SortEntries(slot_entries);
+            due_entries.splice(due_entries.end(), slot_entries);
+        }
+
+        current_tick_ = tick + 1;
+    }
+
+    void CascadeList(EntryList& list) noexcept {
+
+        EntryList cascading_entries;
+        cascading_entries.splice(cascading_entries.end(), list);
+
+        while (!cascading_entries.empty()) {
+            Place(cascading_entries, cascading_entries.begin());
+        }
+    }
+
+    static void SortEntries(EntryList& entries) {
+        entries.sort([](const Entry& entry1, const Entry& entry2) {
+            if (entry1.time_point != entry2.time_point) {
+                return entry1.time_point < entry2.time_point;
+            }
+            return entry1.sequence < entry2.sequence;
+        });
+    }
+
+private:
+    TimePoint origin_;
+    Duration tick_duration_;
+
+    // The next tick to be processed. All ticks before it have been processed.
+    std::uint64_t current_tick_{};
+
+    std::array<Level, LevelCount> levels_;
+    EntryList overflow_entries_;
+
+    // Values inserted with a tick that has been processed.
+    EntryList pending_due_entries_;
+
+    std::size_t count_{};
+    std::uint64_t next_sequence_{};
+};
+
+}
\ No newline at end of file
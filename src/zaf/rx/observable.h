@@ -5,8 +5,11 @@
     Defines the `zaf::rx::Observable<>` and `zaf::rx::ConnectableObservable<>` class templates.
 */
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <ranges>
+#include <vector>
 #include <zaf/rx/internal/insider/insider.h>
 #include <zaf/rx/internal/insider/observer_insider.h>
 #include <zaf/rx/internal/observable/concat_observable.h>
@@ -535,6 +538,181 @@ public:
         return Observable<T>{ std::move(new_core) };
     }
 
+    /**
+    Creates a new observable that collects items emitted by the current observable into buffers of
+    a specified size, and emits each buffer as a single item.
+
+    @param count
+        The number of items in each buffer.
+
+    @pre
+        The count is greater than 0.
+
+    @return
+        An observable that emits buffers of items emitted by the current observable.
+
+    @throw zaf::PreconditionError
+    @throw std::bad_alloc
+
+    @details
+        A buffer is emitted once it has collected the specified number of items. When the current 
+        observable completes, the remaining items are emitted as a smaller buffer, if any, before 
+        the completion emission. When the current observable emits an error, the remaining items 
+        are discarded.
+    */
+    Observable<std::vector<T>> Buffer(std::size_t count) {
+        return Observable<std::vector<T>>{ BufferCore(count, std::nullopt, nullptr) };
+    }
+
+    /**
+    Creates a new observable that collects items emitted by the current observable during periodic
+    time intervals, and emits each collection as a single item.
+
+    @param period
+        The length of each time interval.
+
+    @param scheduler
+        The scheduler to use for the period timer. Buffers emitted at the end of periods are sent
+        on this scheduler.
+
+    @pre
+        The scheduler is not null.
+
+    @return
+        An observable that emits buffers of items emitted by the current observable. When 
+        subscribing to the returned observable, any exception may be thrown by the underlying 
+        scheduler implementation if it fails to start the initial period timer. Subsequent failure
+        of the scheduler to start a period timer will be emitted as an error by the returned 
+        observable.
+
+    @throw zaf::PreconditionError
+    @throw std::bad_alloc
+
+    @details
+        Only one timer is running for each subscription at a time, regardless of how many items 
+        are emitted by the current observable. A buffer is not emitted if no item is collected 
+        during the period.
+
+        When the current observable completes, the remaining items are emitted as a buffer, if 
+        any, before the completion emission. When the current observable emits an error, the 
+        remaining items are discarded.
+
+        Buffers emitted on the scheduler and those emitted by the current observable are
+        serialized, so the returned observable never emits concurrently.
+    */
+    Observable<std::vector<T>> Buffer(
+        std::chrono::steady_clock::duration period,
+        std::shared_ptr<Scheduler> scheduler) {
+
+        ZAF_EXPECT(scheduler);
+        return Observable<std::vector<T>>{ BufferCore(std::nullopt, period, std::move(scheduler)) };
+    }
+
+    /**
+    Creates a new observable that collects items emitted by the current observable into buffers,
+    and emits each buffer as a single item when it is full or when a time interval ends, whichever 
+    comes first.
+
+    @param count
+        The max number of items in each buffer.
+
+    @param period
+        The length of each time interval.
+
+    @param scheduler
+        The scheduler to use for the period timer. Buffers emitted at the end of periods are sent
+        on this scheduler.
+
+    @pre
+        - The count is greater than 0.
+        - The scheduler is not null.
+
+    @return
+        An observable that emits buffers of items emitted by the current observable.
+
+    @throw zaf::PreconditionError
+    @throw std::bad_alloc
+
+    @details
+        The time intervals are periodic, and are not restarted when a full buffer is emitted. See 
+        the other overloads for more details.
+    */
+    Observable<std::vector<T>> Buffer(
+        std::size_t count,
+        std::chrono::steady_clock::duration period,
+        std::shared_ptr<Scheduler> scheduler) {
+
+        ZAF_EXPECT(scheduler);
+        return Observable<std::vector<T>>{ BufferCore(count, period, std::move(scheduler)) };
+    }
+
+    /**
+    Creates a new observable that splits items emitted by the current observable into windows of a
+    specified size, and emits each window as an observable.
+
+    @param count
+        The number of items in each window.
+
+    @pre
+        The count is greater than 0.
+
+    @return
+        An observable that emits windows of items emitted by the current observable.
+
+    @throw zaf::PreconditionError
+    @throw std::bad_alloc
+
+    @details
+        A window is opened when an item is emitted by the current observable and there is no open
+        window. The window is emitted before the item is sent to it, and completes once it has 
+        received the specified number of items. Items are not replayed, so subscribers of a window 
+        should subscribe to it when it is emitted.
+
+        Unlike `Buffer()`, items are sent to the windows as soon as they are emitted by the current 
+        observable, without being collected first.
+
+        When the current observable terminates, the open window, if any, terminates with the same 
+        emission.
+    */
+    Observable<Observable<T>> Window(std::size_t count) {
+        return Observable<Observable<T>>{ WindowCore(count, std::nullopt, nullptr) };
+    }
+
+    /**
+    Creates a new observable that splits items emitted by the current observable into windows by
+    periodic time intervals, and emits each window as an observable.
+
+    @param period
+        The length of each time interval.
+
+    @param scheduler
+        The scheduler to use for the period timer. Completions of windows at the end of periods are
+        sent on this scheduler.
+
+    @pre
+        The scheduler is not null.
+
+    @return
+        An observable that emits windows of items emitted by the current observable.
+
+    @throw zaf::PreconditionError
+    @throw std::bad_alloc
+
+    @details
+        The open window, if any, completes at the end of each period. Like the count overload, a 
+        window is opened only when an item is emitted, so there are no empty windows.
+
+        Completions of windows on the scheduler and items sent by the current observable are
+        serialized, so an item is never lost when it arrives at the end of a period.
+    */
+    Observable<Observable<T>> Window(
+        std::chrono::steady_clock::duration period,
+        std::shared_ptr<Scheduler> scheduler) {
+
+        ZAF_EXPECT(scheduler);
+        return Observable<Observable<T>>{ WindowCore(std::nullopt, period, std::move(scheduler)) };
+    }
+
     /**
     Creates a new observable that emits only the items that satisfy the specified predicate.
 
@@ -597,12 +775,87 @@ public:
     */
     ConnectableObservable<T> Replay(std::size_t replay_size);
 
+    /**
+    Creates a connectable observable that shares a single subscription to the current observable
+    and replays the items emitted within a specified time window to new subscribers.
+
+    @param replay_window
+        The time window of items to replay. Items emitted earlier than this duration before a new
+        subscriber subscribes are not replayed to it.
+
+    @return
+        A connectable observable to the current observable, replays the items emitted within the 
+        specified time window to new subscribers.
+
+    @throw std::bad_alloc
+    */
+    ConnectableObservable<T> Replay(std::chrono::steady_clock::duration replay_window);
+
+    /**
+    Creates a connectable observable that shares a single subscription to the current observable
+    and replays at most a specified number of the most recent items emitted within a specified 
+    time window to new subscribers.
+
+    @param replay_size
+        The max number of the most recent emitted items to replay to new subscribers.
+
+    @param replay_window
+        The time window of items to replay. Items emitted earlier than this duration before a new
+        subscriber subscribes are not replayed to it.
+
+    @return
+        A connectable observable to the current observable, replays at most the specified number
+        of items emitted within the specified time window to new subscribers.
+
+    @throw std::bad_alloc
+    */
+    ConnectableObservable<T> Replay(
+        std::size_t replay_size, 
+        std::chrono::steady_clock::duration replay_window);
+
 protected:
     explicit Observable(std::shared_ptr<rx::internal::ObservableCore> core) noexcept :
         Base(std::move(core)) {
     }
 
 private:
+    std::shared_ptr<internal::ObservableCore> BufferCore(
+        std::optional<std::size_t> count,
+        std::optional<std::chrono::steady_clock::duration> period,
+        std::shared_ptr<Scheduler> scheduler) {
+
+        return this->Core()->Buffer(
+            count,
+            period,
+            std::move(scheduler),
+            [](std::vector<std::any>&& items) {
+                std::vector<T> buffer;
+                buffer.reserve(items.size());
+                for (auto& each_item : items) {
+                    buffer.push_back(std::any_cast<T>(std::move(each_item)));
+                }
+                return std::any{ std::move(buffer) };
+            });
+    }
+
+    std::shared_ptr<internal::ObservableCore> WindowCore(
+        std::optional<std::size_t> count,
+        std::optional<std::chrono::steady_clock::duration> period,
+        std::shared_ptr<Scheduler> scheduler) {
+
+        return this->Core()->Window(
+            count,
+            period,
+            std::move(scheduler),
+            [](std::shared_ptr<internal::ObservableCore> window_core) {
+                return std::any{ Observable<T>{ std::move(window_core) } };
+            });
+    }
+
+private:
+    template<typename>
+    friend class Observable;
+
     friend Base;
     friend class ConnectableObservable<T>;
     friend class rx::internal::ObservableInsider;
@@ -679,13 +932,30 @@ ConnectableObservable<T> Observable<T>::Publish() {
 
 template<typename T>
 ConnectableObservable<T> Observable<T>::Replay() {
-    auto core = this->Core()->Replay(std::nullopt);
+    auto core = this->Core()->Replay(std::nullopt, std::nullopt);
     return ConnectableObservable<T>{ std::move(core) };
 }
 
 template<typename T>
 ConnectableObservable<T> Observable<T>::Replay(std::size_t replay_size) {
-    auto core = this->Core()->Replay(replay_size);
+    auto core = this->Core()->Replay(replay_size, std::nullopt);
+    return ConnectableObservable<T>{ std::move(core) };
+}
+
+template<typename T>
+ConnectableObservable<T> Observable<T>::Replay(
+    std::chrono::steady_clock::duration replay_window) {
+
+    auto core = this->Core()->Replay(std::nullopt, replay_window);
+    return ConnectableObservable<T>{ std::move(core) };
+}
+
+template<typename T>
+ConnectableObservable<T> Observable<T>::Replay(
+    std::size_t replay_size,
+    std::chrono::steady_clock::duration replay_window) {
+
+    auto core = this->Core()->Replay(replay_size, replay_window);
     return ConnectableObservable<T>{ std::move(core) };
 }
 
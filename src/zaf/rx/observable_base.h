@@ -12,6 +12,7 @@
 #include <zaf/rx/internal/observable/observable_core.h>
 #include <zaf/rx/internal/observable/throw_observable.h>
 #include <zaf/rx/observer_functions.h>
+#include <zaf/rx/overflow_policy.h>
 
 namespace zaf::rx {
 
@@ -265,6 +266,50 @@ public:
         return OBSERVABLE<T>{ core_->ObserveOn(std::move(scheduler)) };
     }
 
+    /**
+    Creates a new observable that emits items on the specified scheduler, buffering pending items
+    in a bounded queue.
+
+    @param scheduler
+        The scheduler on which to emit items.
+
+    @param queue_capacity
+        The maximum number of pending items in the queue.
+
+    @param overflow_policy
+        Specifies what to do when an item is emitted by the current observable while the queue is 
+        full.
+
+    @pre
+        - The scheduler is not null.
+        - The queue capacity is greater than 0.
+
+    @return
+        An observable that emits items on the specified scheduler.
+
+    @throw zaf::PreconditionError
+    @throw std::bad_alloc
+
+    @details
+        Unlike the overload without a queue capacity, which schedules one work for each emission, 
+        this overload schedules at most one work at a time for each subscription, and the work 
+        emits all pending items in a batch. Error and completion emissions are sent after all 
+        pending items are emitted.
+
+        If the overflow policy is `zaf::rx::OverflowPolicy::Error`, the observable stops observing 
+        the current observable on overflow, and emits a `zaf::rx::QueueOverflowError` after the 
+        pending items.
+    */
+    OBSERVABLE<T> ObserveOn(
+        std::shared_ptr<Scheduler> scheduler,
+        std::size_t queue_capacity,
+        OverflowPolicy overflow_policy) {
+
+        return OBSERVABLE<T>{
+            core_->ObserveOn(std::move(scheduler), queue_capacity, overflow_policy)
+        };
+    }
+
     /**
     Creates a new observable that invokes the specified observer for all emissions by the current
     observable.
@@ -489,7 +534,7 @@ public:
     OBSERVABLE<K> Map(std::function<K(const T&)> mapper) {
         ZAF_EXPECT(mapper);
         auto new_core = core_->Map([mapper = std::move(mapper)](const std::any& value) {
-            return mapper(std::any_cast<T>(value));
+            return mapper(std::any_cast<const T&>(value));
         });
         return OBSERVABLE<K>{ std::move(new_core) };
     }
@@ -528,7 +573,7 @@ public:
         ZAF_EXPECT(mapper);
         const auto& core = static_cast<const OBSERVABLE<T>*>(this)->Core();
         auto new_core = core->FlatMap([mapper = std::move(mapper)](const std::any& value) {
-            return mapper(std::any_cast<T>(value)).Core();
+            return mapper(std::any_cast<const T&>(value)).Core();
         });
         return OBSERVABLE<K>{ std::move(new_core) };
     }
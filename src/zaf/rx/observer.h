@@ -135,7 +135,7 @@ public:
 
         auto bridged_on_next = [on_next](const std::any& value) {
             if (on_next) {
-                on_next(std::any_cast<T>(value));
+                on_next(std::any_cast<const T&>(value));
             }
         };
 
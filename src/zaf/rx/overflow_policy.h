@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+@file
+    Defines the `zaf::rx::OverflowPolicy` enum.
+*/
+
+namespace zaf::rx {
+
+/**
+Specifies what to do when an item arrives at a bounded queue that is full.
+*/
+enum class OverflowPolicy {
+
+    /**
+    Blocks the emitting thread until there is room in the queue.
+
+    @details
+        This policy must not be used if the items are emitted on the same thread that drains the 
+        queue, otherwise the thread will be blocked forever.
+    */
+    Block,
+
+    /**
+    Drops the oldest item in the queue to make room for the new item.
+    */
+    DropOldest,
+
+    /**
+    Drops the new item, keeping the items in the queue.
+    */
+    DropNewest,
+
+    /**
+    Terminates the observable with a `zaf::rx::QueueOverflowError`, after the items in the queue 
+    are emitted.
+    */
+    Error,
+};
+
+}
\ No newline at end of file
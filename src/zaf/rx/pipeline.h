@@ -0,0 +1,288 @@
+#pragma once
+
+/**
+@file
+    Defines the `zaf::rx::Pipeline<>` class template and the `zaf::rx::Pipe()` function.
+*/
+
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/rx/internal/insider/observable_insider.h>
+#include <zaf/rx/internal/observer_shim.h>
+#include <zaf/rx/internal/operator/typed_pipeline_operator.h>
+#include <zaf/rx/observable.h>
+#include <zaf/rx/observer_functions.h>
+
+namespace zaf::rx {
+
+/**
+Represents a chain of synchronous `Map`, `Filter` and `Do` operators applied to an observable,
+whose types are known at compile time.
+
+@tparam T
+    The type of items emitted by the source observable.
+
+@tparam K
+    The type of items emitted by the pipeline.
+
+@tparam STAGES
+    The types of the stages in the pipeline. They are implementation details and should not be
+    specified explicitly.
+
+@details
+    Unlike the operators of `zaf::rx::Observable<>`, which type-erase each item and create one
+    producer for each operator, all stages of a pipeline are fused into one observer when
+    subscribing. The item emitted by the source observable is type-erased only once, and is passed
+    between stages with its static type, without any extra allocation or virtual call.
+
+    A pipeline is created by `zaf::rx::Pipe()`, and can be either subscribed directly, or converted
+    to an ordinary observable by `AsObservable()` to be chained with other operators.
+
+    Handlers in the stages are invoked in the same way as the corresponding operators of
+    `zaf::rx::Observable<>`: if a handler throws an exception, the pipeline will terminate with the
+    thrown exception as an error.
+*/
+template<typename T, typename K, typename... STAGES>
+class Pipeline {
+public:
+    /**
+    Creates a new pipeline that applies a mapping function to each item emitted by the current
+    pipeline.
+
+    @tparam F
+        The type of the mapping function. It has the following signature:
+        @code{.cpp}
+        R(const K& value);
+        @endcode
+
+    @param mapper
+        The mapping function to apply to each item.
+
+    @pre
+        The mapping function is not null, if it can be tested as a boolean.
+
+    @return
+        A pipeline that emits items of the decayed type of the mapping function's result.
+
+    @throw zaf::PreconditionError
+    */
+    template<typename F>
+    auto Map(F mapper) const {
+
+        ExpectFunction(mapper);
+
+        using MappedType = std::decay_t<std::invoke_result_t<F&, const K&>>;
+        return Pipeline<T, MappedType, STAGES..., internal::MapStage<F>>{
+            source_,
+            std::tuple_cat(stages_, std::make_tuple(internal::MapStage<F>{ std::move(mapper) })),
+        };
+    }
+
+    /**
+    Creates a new pipeline that emits only the items that satisfy the specified predicate.
+
+    @tparam F
+        The type of the predicate function. It has the following signature:
+        @code{.cpp}
+        bool(const K& value);
+        @endcode
+
+    @param predicate
+        The predicate function to test each item.
+
+    @pre
+        The predicate function is not null, if it can be tested as a boolean.
+
+    @return
+        A pipeline that emits only the items that satisfy the specified predicate.
+
+    @throw zaf::PreconditionError
+    */
+    template<typename F>
+    Pipeline<T, K, STAGES..., internal::FilterStage<F>> Filter(F predicate) const {
+
+        ExpectFunction(predicate);
+
+        return Pipeline<T, K, STAGES..., internal::FilterStage<F>>{
+            source_,
+            std::tuple_cat(
+                stages_,
+                std::make_tuple(internal::FilterStage<F>{ std::move(predicate) })),
+        };
+    }
+
+    /**
+    Creates a new pipeline that invokes the specified handler for each item emitted by the current
+    pipeline.
+
+    @tparam F
+        The type of the handler. It has the following signature:
+        @code{.cpp}
+        void(const K& value);
+        @endcode
+
+    @param on_next
+        The handler to be invoked when an item is emitted. It is invoked before the item is sent to
+        the next stage.
+
+    @pre
+        The handler is not null, if it can be tested as a boolean.
+
+    @return
+        A pipeline that invokes the specified handler for each item.
+
+    @throw zaf::PreconditionError
+    */
+    template<typename F>
+    Pipeline<T, K, STAGES..., internal::DoStage<F>> Do(F on_next) const {
+
+        ExpectFunction(on_next);
+
+        return Pipeline<T, K, STAGES..., internal::DoStage<F>>{
+            source_,
+            std::tuple_cat(stages_, std::make_tuple(internal::DoStage<F>{ std::move(on_next) })),
+        };
+    }
+
+    /**
+    Converts the current pipeline to an ordinary observable.
+
+    @return
+        An observable that emits the items emitted by the current pipeline.
+
+    @throw std::bad_alloc
+
+    @details
+        Items are type-erased once when they leave the pipeline.
+    */
+    Observable<K> AsObservable() const {
+        auto core = std::make_shared<internal::TypedPipelineOperator<T, STAGES...>>(
+            source_,
+            stages_);
+        return internal::ObservableInsider::Create<K>(std::move(core));
+    }
+
+    /**
+    Subscribes to the current pipeline with the specified item handler, ignoring the error and
+    completion emissions.
+
+    @param on_next
+        The handler to be invoked when an item is emitted.
+
+    @pre
+        The handler is not null.
+
+    @return
+        A disposable object that can be used to unsubscribe from the pipeline. Callers should
+        retain the returned object so that the subscription remains active.
+
+    @post
+        The return object is not null.
+
+    @throw zaf::PreconditionError
+    @throw std::bad_alloc
+    @throw ...
+        Any exception thrown by the source observable when subscribing.
+    */
+    [[nodiscard]]
+    std::shared_ptr<Disposable> Subscribe(OnNext<K> on_next) const {
+        ZAF_EXPECT(on_next);
+        return Subscribe(std::move(on_next), nullptr, nullptr);
+    }
+
+    /**
+    Subscribes to the current pipeline with the specified item handler, error handler, and
+    completion handler.
+
+    @param on_next
+        The handler to be invoked when an item is emitted.
+
+    @param on_error
+        The handler to be invoked when an error is emitted.
+
+    @param on_completed
+        The handler to be invoked when the pipeline completes.
+
+    @return
+        A disposable object that can be used to unsubscribe from the pipeline. Callers should
+        retain the returned object so that the subscription remains active.
+
+    @post
+        The return object is not null.
+
+    @throw std::bad_alloc
+    @throw ...
+        Any exception thrown by the source observable when subscribing.
+
+    @details
+        All handlers can be null, in which case the emission will be ignored. Items are passed to
+        the item handler directly, without being type-erased.
+    */
+    [[nodiscard]]
+    std::shared_ptr<Disposable> Subscribe(
+        OnNext<K> on_next,
+        OnError on_error,
+        OnCompleted on_completed) const {
+
+        using ProducerType = internal::TypedPipelineProducer<
+            T,
+            internal::TypedEmitSink<K>,
+            STAGES...
+        >;
+
+        auto producer = std::make_shared<ProducerType>(
+            internal::ObserverShim::MakeShared(
+                nullptr,
+                std::move(on_error),
+                std::move(on_completed)),
+            stages_,
+            internal::TypedEmitSink<K>{ std::move(on_next) });
+
+        producer->Run(source_);
+        return producer;
+    }
+
+private:
+    template<typename, typename, typename...>
+    friend class Pipeline;
+
+    template<typename S>
+    friend Pipeline<S, S> Pipe(const Observable<S>& observable);
+
+    Pipeline(std::shared_ptr<internal::ObservableCore> source, std::tuple<STAGES...> stages) :
+        source_(std::move(source)),
+        stages_(std::move(stages)) {
+
+    }
+
+    template<typename F>
+    static void ExpectFunction(const F& function) {
+        if constexpr (std::is_constructible_v<bool, const F&>) {
+            ZAF_EXPECT(static_cast<bool>(function));
+        }
+    }
+
+private:
+    std::shared_ptr<internal::ObservableCore> source_;
+    std::tuple<STAGES...> stages_;
+};
+
+
+/**
+Creates an empty pipeline for the specified observable.
+
+@param observable
+    The source observable of the pipeline.
+
+@return
+    A pipeline that emits the items emitted by the specified observable, to which `Map`, `Filter`
+    and `Do` stages can be appended.
+*/
+template<typename T>
+Pipeline<T, T> Pipe(const Observable<T>& observable) {
+    return Pipeline<T, T>{ internal::ObservableInsider::GetCore(observable), std::tuple<>{} };
+}
+
+}
\ No newline at end of file
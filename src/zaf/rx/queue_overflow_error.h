@@ -0,0 +1,20 @@
+#pragma once
+
+/**
+@file
+    Defines the `zaf::rx::QueueOverflowError` class.
+*/
+
+#include <zaf/base/error/runtime_error_base.h>
+
+namespace zaf::rx {
+
+/**
+Represents an error that an item arrives at a bounded queue that is full.
+*/
+class QueueOverflowError : public RuntimeErrorBase {
+public:
+    using RuntimeErrorBase::RuntimeErrorBase;
+};
+
+}
\ No newline at end of file
@@ -82,6 +82,22 @@ public:
     virtual std::shared_ptr<Disposable> ScheduleDelayedWork(
         std::chrono::steady_clock::duration delay, 
         Closure work) = 0;
+
+    /**
+    Gets the current time of the scheduler, against which delays of works are measured.
+
+    @return
+        The current time point.
+
+    @details
+        The default implementation returns `std::chrono::steady_clock::now()`. Operators that keep
+        a deadline, such as `Debounce`, use this method to check whether the deadline has passed 
+        when a delayed work is executed, so derived classes that measure delays with a different 
+        clock should override this method accordingly.
+    */
+    virtual std::chrono::steady_clock::time_point Now() const noexcept {
+        return std::chrono::steady_clock::now();
+    }
 };
 
 }
\ No newline at end of file
@@ -16,13 +16,22 @@ ThreadPoolScheduler::ThreadPoolScheduler() {
     if (max_thread_count == 0) {
         max_thread_count = 4;
     }
-    Initialize(max_thread_count);
+    Initialize(max_thread_count, ThreadPoolQueueMode::SingleQueue);
 }
 
 
-ThreadPoolScheduler::ThreadPoolScheduler(std::size_t max_thread_count) {
+ThreadPoolScheduler::ThreadPoolScheduler(std::size_t max_thread_count) :
+    ThreadPoolScheduler(max_thread_count, ThreadPoolQueueMode::SingleQueue) {
+
+}
+
+
+ThreadPoolScheduler::ThreadPoolScheduler(
+    std::size_t max_thread_count, 
+    ThreadPoolQueueMode queue_mode) {
+
     ZAF_EXPECT(max_thread_count > 0);
-    Initialize(max_thread_count);
+    Initialize(max_thread_count, queue_mode);
 }
 
 
@@ -43,9 +52,18 @@ ThreadPoolScheduler::~ThreadPoolScheduler() {
 }
 
 
-void ThreadPoolScheduler::Initialize(std::size_t max_thread_count) {
+void ThreadPoolScheduler::Initialize(
+    std::size_t max_thread_count, 
+    ThreadPoolQueueMode queue_mode) {
+
     state_ = std::make_shared<SharedState>();
     state_->max_thread_count = max_thread_count;
+    state_->queue_mode = queue_mode;
+
+    if (queue_mode == ThreadPoolQueueMode::WorkStealing) {
+        // Only pointers are reserved here, workers are created along with threads.
+        state_->workers.reserve(max_thread_count);
+    }
 }
 
 
@@ -83,6 +101,14 @@ std::shared_ptr<Disposable> ThreadPoolScheduler::ScheduleWork(Closure work) {
 
     auto work_item = std::make_shared<WorkItem>(std::move(work));
 
+    // Works scheduled from a thread in the pool go to the thread's local queue in work-stealing 
+    // mode, so that the shared queue is not touched.
+    auto current_worker = GetCurrentThreadWorker();
+    if (current_worker) {
+        QueueToLocalQueue(*current_worker, work_item);
+        return work_item;
+    }
+
     bool need_create_thread{};
     {
         std::lock_guard lock(state_->hybrid_queue_mutex);
@@ -90,13 +116,11 @@ std::shared_ptr<Disposable> ThreadPoolScheduler::ScheduleWork(Closure work) {
             throw ExecutionStoppedError(ZAF_SOURCE_LOCATION());
         }
 
-        auto insert_position = state_->hybrid_queue.begin() + state_->immediate_work_count;
-        state_->hybrid_queue.insert(insert_position, work_item);
-        state_->immediate_work_count++;
+        state_->immediate_queue.push_back(work_item);
 
         // If the immediate work items are more than 1, it is considered that there is no free 
         // thread. So we need to create a new thread if possible.
-        need_create_thread = state_->immediate_work_count > 1;
+        need_create_thread = state_->immediate_queue.size() > 1;
     }
     state_->hybrid_queue_cv.notify_one();
 
@@ -121,19 +145,15 @@ std::shared_ptr<Disposable> ThreadPoolScheduler::ScheduleDelayedWork(
     
     auto work_item = std::make_shared<DelayedWorkItem>(std::move(work), state_);
 
-    // Insert the delayed work item into the hybrid queue.
+    // Insert the delayed work item into the delayed queue.
     {
         std::lock_guard lock(state_->hybrid_queue_mutex);
         if (state_->is_stopped) {
             throw ExecutionStoppedError(ZAF_SOURCE_LOCATION());
         }
 
-        auto insert_position = std::lower_bound(
-            state_->hybrid_queue.begin() + state_->immediate_work_count,
-            state_->hybrid_queue.end(),
-            work_item);
-
-        state_->hybrid_queue.insert(insert_position, work_item);
+        state_->delayed_queue.push_back(work_item);
+        work_item->QueuePosition() = std::prev(state_->delayed_queue.end());
     }
 
     auto delay_disposable = state_->timer_thread->PostDelayedWork(
@@ -145,39 +165,83 @@ std::shared_ptr<Disposable> ThreadPoolScheduler::ScheduleDelayedWork(
 }
 
 
+ThreadPoolScheduler::Worker* ThreadPoolScheduler::GetCurrentThreadWorker() const noexcept {
+
+    if (state_->queue_mode != ThreadPoolQueueMode::WorkStealing) {
+        return nullptr;
+    }
+
+    // The current thread may be a thread of another thread pool.
+    auto worker = CurrentThreadWorker();
+    if (worker && worker->owner == state_.get()) {
+        return worker;
+    }
+    return nullptr;
+}
+
+
+void ThreadPoolScheduler::QueueToLocalQueue(
+    Worker& worker, 
+    const std::shared_ptr<WorkItem>& work_item) {
+
+    // The current thread is one of the threads in the pool, which means the scheduler is not 
+    // destructed yet. If the scheduler is being destructed, the current thread will execute the 
+    // work item in its local queue before exiting, so checking the flag without locking is fine.
+    if (state_->is_stopped) {
+        throw ExecutionStoppedError(ZAF_SOURCE_LOCATION());
+    }
+
+    {
+        std::lock_guard lock(worker.local_queue_mutex);
+        worker.local_queue.push_back(work_item);
+        // The count is increased in the lock, so that it is never decreased by a stealing thread 
+        // before being increased.
+        state_->local_work_count++;
+    }
+
+    // If there is no waiting thread, all threads are considered busy, so we try to create a new 
+    // thread to steal the work item.
+    if (state_->waiting_thread_count == 0) {
+        TryCreateNewThread(state_);
+        return;
+    }
+
+    // Lock and unlock the mutex to ensure that the waiting thread either sees the increased 
+    // local_work_count before waiting, or receives the notification after waiting.
+    {
+        std::lock_guard lock(state_->hybrid_queue_mutex);
+    }
+    state_->hybrid_queue_cv.notify_one();
+}
+
+
 void ThreadPoolScheduler::OnDelayedWorkItemReady(
     const std::weak_ptr<SharedState>& weak_state,
-    const std::shared_ptr<WorkItem>& work_item) noexcept {
+    const std::shared_ptr<DelayedWorkItem>& work_item) noexcept {
 
     auto state = weak_state.lock();
     if (!state) {
         return;
     }
 
-    // Move the due delayed work item to the immediate work items in the hybrid queue.
+    // Move the due delayed work item to the immediate queue.
     bool need_create_thread{};
     {
         std::lock_guard lock(state->hybrid_queue_mutex);
 
-        auto iterator = std::lower_bound(
-            state->hybrid_queue.begin() + state->immediate_work_count,
-            state->hybrid_queue.end(),
-            work_item);
-
-        if (iterator == state->hybrid_queue.end() || (*iterator) != work_item) {
+        auto& queue_position = work_item->QueuePosition();
+        if (!queue_position) {
             // The work item is not in the queue, probably disposed.
             return;
         }
 
-        std::rotate(
-            state->hybrid_queue.begin() + state->immediate_work_count,
-            iterator,
-            iterator + 1);
+        state->delayed_queue.erase(*queue_position);
+        queue_position.reset();
 
-        state->immediate_work_count++;
+        state->immediate_queue.push_back(work_item);
 
         // Same as ScheduleWork.
-        need_create_thread = state->immediate_work_count > 1;
+        need_create_thread = state->immediate_queue.size() > 1;
     }
 
     state->hybrid_queue_cv.notify_one();
@@ -214,6 +278,32 @@ void ThreadPoolScheduler::CreateThreadInLock(const std::shared_ptr<SharedState>&
     // We don't reserve(max_thread_count) as it may be a large number.
     shared_state->threads.reserve(shared_state->threads.size() + 1);
 
+    if (shared_state->queue_mode == ThreadPoolQueueMode::WorkStealing) {
+
+        // The worker is registered before the thread starts, so that the thread is able to find 
+        // its worker among all workers. If starting the thread of a registered worker failed 
+        // before, the worker is reused as its local queue is always empty.
+        std::size_t worker_index = shared_state->total_thread_count;
+        if (shared_state->workers.size() == worker_index) {
+
+            auto worker = std::make_unique<Worker>(shared_state.get(), worker_index);
+
+            // The workers vector has been reserved, so it won't throw nor reallocate.
+            shared_state->workers.push_back(std::move(worker));
+            shared_state->worker_count++;
+        }
+
+        auto thread = std::make_unique<DefaultRunLoopThread>();
+        thread->PostWork(std::bind(
+            &ThreadPoolScheduler::WorkStealingThreadProcedure, 
+            shared_state, 
+            shared_state->workers[worker_index].get()));
+
+        shared_state->threads.push_back(std::move(thread));
+        shared_state->total_thread_count++;
+        return;
+    }
+
     auto thread = std::make_unique<DefaultRunLoopThread>();
     thread->PostWork(std::bind(&ThreadPoolScheduler::ThreadProcedure, shared_state));
 
@@ -229,9 +319,9 @@ void ThreadPoolScheduler::ThreadProcedure(const std::shared_ptr<SharedState>& st
 
         lock.lock();
 
-        if (state->immediate_work_count == 0) {
+        if (state->immediate_queue.empty()) {
             state->hybrid_queue_cv.wait(lock, [&state]() {
-                return (state->immediate_work_count > 0) || state->is_stopped;
+                return !state->immediate_queue.empty() || state->is_stopped;
             });
             // Exit only when there is no work.
             if (state->is_stopped) {
@@ -239,9 +329,8 @@ void ThreadPoolScheduler::ThreadProcedure(const std::shared_ptr<SharedState>& st
             }
         }
 
-        auto work_item = std::move(state->hybrid_queue.front());
-        state->hybrid_queue.pop_front();
-        state->immediate_work_count--;
+        auto work_item = std::move(state->immediate_queue.front());
+        state->immediate_queue.pop_front();
 
         lock.unlock();
 
@@ -252,9 +341,132 @@ void ThreadPoolScheduler::ThreadProcedure(const std::shared_ptr<SharedState>& st
 }
 
 
+void ThreadPoolScheduler::WorkStealingThreadProcedure(
+    const std::shared_ptr<SharedState>& state,
+    Worker* worker) {
+
+    CurrentThreadWorker() = worker;
+
+    while (true) {
+
+        auto work_item = TakeWorkItem(*state, *worker);
+        if (work_item) {
+            work_item->RunWork();
+            continue;
+        }
+
+        if (!WaitForWorkItems(*state)) {
+            break;
+        }
+    }
+
+    CurrentThreadWorker() = nullptr;
+}
+
+
+std::shared_ptr<ThreadPoolScheduler::WorkItem> ThreadPoolScheduler::TakeWorkItem(
+    SharedState& state,
+    Worker& worker) noexcept {
+
+    auto work_item = TakeLocalWorkItem(state, worker);
+    if (work_item) {
+        return work_item;
+    }
+
+    {
+        std::lock_guard lock(state.hybrid_queue_mutex);
+        if (!state.immediate_queue.empty()) {
+            work_item = std::move(state.immediate_queue.front());
+            state.immediate_queue.pop_front();
+            return work_item;
+        }
+    }
+
+    return StealWorkItem(state, worker);
+}
+
+
+std::shared_ptr<ThreadPoolScheduler::WorkItem> ThreadPoolScheduler::TakeLocalWorkItem(
+    SharedState& state,
+    Worker& worker) noexcept {
+
+    std::lock_guard lock(worker.local_queue_mutex);
+    if (worker.local_queue.empty()) {
+        return nullptr;
+    }
+
+    auto work_item = std::move(worker.local_queue.front());
+    worker.local_queue.pop_front();
+    state.local_work_count--;
+    return work_item;
+}
+
+
+std::shared_ptr<ThreadPoolScheduler::WorkItem> ThreadPoolScheduler::StealWorkItem(
+    SharedState& state,
+    Worker& thief) noexcept {
+
+    if (state.local_work_count == 0) {
+        return nullptr;
+    }
+
+    // Try each of other workers once, starting from the next victim of the thief, so that 
+    // victims are spread among workers.
+    std::size_t worker_count = state.worker_count;
+    for (std::size_t attempt = 0; attempt < worker_count; ++attempt) {
+
+        auto victim_index = thief.next_victim_index++ % worker_count;
+        if (victim_index == thief.index) {
+            continue;
+        }
+
+        auto& victim = *state.workers[victim_index];
+
+        std::lock_guard lock(victim.local_queue_mutex);
+        if (victim.local_queue.empty()) {
+            continue;
+        }
+
+        auto work_item = std::move(victim.local_queue.back());
+        victim.local_queue.pop_back();
+        state.local_work_count--;
+        return work_item;
+    }
+
+    return nullptr;
+}
+
+
+bool ThreadPoolScheduler::WaitForWorkItems(SharedState& state) {
+
+    std::unique_lock lock(state.hybrid_queue_mutex);
+
+    auto has_work_items = [&state]() {
+        return !state.immediate_queue.empty() || (state.local_work_count > 0);
+    };
+
+    // waiting_thread_count is increased before checking the condition, see QueueToLocalQueue() 
+    // for the counterpart.
+    state.waiting_thread_count++;
+    state.hybrid_queue_cv.wait(lock, [&]() {
+        return has_work_items() || state.is_stopped;
+    });
+    state.waiting_thread_count--;
+
+    // Exit only when there is no work.
+    return has_work_items() || !state.is_stopped;
+}
+
+
+ThreadPoolScheduler::Worker*& ThreadPoolScheduler::CurrentThreadWorker() noexcept {
+    thread_local Worker* worker{};
+    return worker;
+}
+
+
 std::size_t ThreadPoolScheduler::HybridQueueSize() const noexcept {
     std::lock_guard<std::mutex> lock(state_->hybrid_queue_mutex);
-    return state_->hybrid_queue.size();
+    return state_->immediate_queue.size() + state_->delayed_queue.size();
 }
 
 
@@ -314,20 +526,12 @@ void ThreadPoolScheduler::DelayedWorkItem::RemoveFromQueue() noexcept {
     }
 
     std::lock_guard<std::mutex> lock(state->hybrid_queue_mutex);
-
-    auto iterator = std::lower_bound(
-        state->hybrid_queue.begin() + state->immediate_work_count,
-        state->hybrid_queue.end(),
-        this,
-        [](const std::shared_ptr<WorkItem>& existing, DelayedWorkItem* current) {
-            return existing.get() < current;
-        });
-
-    if (iterator == state->hybrid_queue.end() || (*iterator).get() != this) {
+    if (!queue_position_) {
         return;
     }
 
-    state->hybrid_queue.erase(iterator);
+    state->delayed_queue.erase(*queue_position_);
+    queue_position_.reset();
 }
 
 }
\ No newline at end of file
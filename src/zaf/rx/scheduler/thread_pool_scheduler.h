@@ -5,8 +5,11 @@
     Defines the `zaf::rx::ThreadPoolScheduler` class.
 */
 
+#include <atomic>
 #include <deque>
+#include <list>
 #include <mutex>
+#include <optional>
 #include <vector>
 #include <zaf/rx/internal/thread/thread_work_item_base.h>
 #include <zaf/rx/scheduler/scheduler.h>
@@ -18,6 +21,35 @@ class ThreadPoolSchedulerTest;
 
 namespace zaf::rx {
 
+/**
+Specifies how a `zaf::rx::ThreadPoolScheduler` distributes work items to its threads.
+*/
+enum class ThreadPoolQueueMode {
+
+    /**
+    All threads in the pool take work items from one shared queue.
+
+    @details
+        Work items are taken in their scheduling order. This is the default mode.
+    */
+    SingleQueue,
+
+    /**
+    Each thread in the pool owns a local queue, and idle threads steal work items from the local 
+    queues of other threads.
+
+    @details
+        Work items scheduled from a thread in the pool are queued to the local queue of that 
+        thread, without touching the queue shared by all threads. Work items scheduled from other 
+        threads, as well as due delayed work items, are still queued to the shared queue.
+
+        This mode reduces lock contention when a large amount of small works are scheduled from 
+        the pool itself, at the cost of not preserving the scheduling order among threads.
+    */
+    WorkStealing,
+};
+
+
 /**
 Represents a scheduler that uses a pool of threads to execute work items.
 
@@ -27,6 +59,9 @@ Represents a scheduler that uses a pool of threads to execute work items.
 
     An individual timer thread is used to handle delayed work items. Delayed work items are queued
     to the thread pool only when their delay time is reached.
+
+    By default, all threads share a single queue. Use `zaf::rx::ThreadPoolQueueMode::WorkStealing`
+    to give each thread a local queue if works are mostly scheduled from the pool itself.
 */
 class ThreadPoolScheduler : public Scheduler {
 public:
@@ -73,6 +108,23 @@ public:
     */
     explicit ThreadPoolScheduler(std::size_t max_thread_count);
 
+    /**
+    Constructs the instance with the specified maximum thread count and queue mode.
+
+    @param max_thread_count
+        The maximum number of threads that can be created in the thread pool.
+
+    @param queue_mode
+        The mode that specifies how work items are distributed to threads.
+
+    @pre
+        `max_thread_count` must be greater than 0.
+
+    @throw zaf::PreconditionError
+    @throw std::bad_alloc
+    */
+    ThreadPoolScheduler(std::size_t max_thread_count, ThreadPoolQueueMode queue_mode);
+
     /**
     Destructs the instance, stopping all threads in the thread pool.
 
@@ -95,6 +147,13 @@ public:
         return state_->max_thread_count;
     }
 
+    /**
+    Gets the queue mode of the thread pool.
+    */
+    ThreadPoolQueueMode QueueMode() const noexcept {
+        return state_->queue_mode;
+    }
+
     /**
     @copydoc zaf::rx::Scheduler::ScheduleWork()
 
@@ -139,25 +198,66 @@ public:
 
 private:
     class WorkItem;
+    class SharedState;
+
+    using DelayedWorkItemList = std::list<std::shared_ptr<WorkItem>>;
+
+    // The local queue owned by a thread in work-stealing mode.
+    class Worker {
+    public:
+        Worker(const SharedState* owner, std::size_t index) noexcept :
+            owner(owner),
+            index(index),
+            next_victim_index(index + 1) {
+
+        }
+
+        const SharedState* const owner;
+
+        // The index in SharedState::workers.
+        const std::size_t index;
+
+        // The index of the worker to steal from next time. Victims are chosen in a round-robin 
+        // manner. It is accessed only by the owner thread.
+        std::size_t next_victim_index{};
+
+        // The owner thread takes work items from the front, while other threads steal work items 
+        // from the back.
+        std::deque<std::shared_ptr<WorkItem>> local_queue;
+        std::mutex local_queue_mutex;
+    };
 
     class SharedState {
     public:
         std::size_t max_thread_count{};
+        ThreadPoolQueueMode queue_mode{ ThreadPoolQueueMode::SingleQueue };
 
-        // A queue that contains both immediate work items and delayed work items.
-        // Immediate work items are always in the front of the queue, ordered by their scheduling 
-        // order. Delayed work items are always in the back of the queue, ordered by their pointer
-        // value.
-        std::deque<std::shared_ptr<WorkItem>> hybrid_queue;
+        // The hybrid queue consists of immediate work items and delayed work items.
+        // Immediate work items are ordered by their scheduling order.
+        std::deque<std::shared_ptr<WorkItem>> immediate_queue;
 
-        // Count of immediate work items in the hybrid queue.
-        std::size_t immediate_work_count{};
+        // Delayed work items that are not due yet. Each delayed work item keeps its position in 
+        // the list, so that it can be removed in O(1) when it is due or disposed.
+        DelayedWorkItemList delayed_queue;
 
         std::mutex hybrid_queue_mutex;
         std::condition_variable hybrid_queue_cv;
         
-        // This variables should be accessed only when holding hybrid_queue_mutex.
-        bool is_stopped{ false };
+        // This variable should be modified only when holding hybrid_queue_mutex. It is atomic so 
+        // that threads in work-stealing mode can check it without locking.
+        std::atomic<bool> is_stopped{ false };
+
+        // Workers of threads, used in work-stealing mode only. The vector is reserved to 
+        // max_thread_count in advance and is never reallocated, so that workers can be read by 
+        // stealing threads without locking, as long as the index is less than worker_count.
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::atomic<std::size_t> worker_count{};
+
+        // Total count of work items in all local queues.
+        std::atomic<std::size_t> local_work_count{};
+
+        // Count of threads waiting on hybrid_queue_cv in work-stealing mode.
+        std::atomic<std::size_t> waiting_thread_count{};
 
         std::vector<std::unique_ptr<RunLoopThread>> threads;
         std::mutex threads_mutex;
@@ -187,6 +287,12 @@ private:
 
         void SetDelayDisposable(const std::shared_ptr<Disposable>& disposable) noexcept;
 
+        // The position in the delayed queue, which should be accessed only when holding 
+        // hybrid_queue_mutex. It is reset once the work item is removed from the delayed queue.
+        std::optional<DelayedWorkItemList::iterator>& QueuePosition() noexcept {
+            return queue_position_;
+        }
+
         ~DelayedWorkItem();
 
     protected:
@@ -199,21 +305,37 @@ private:
     private:
         std::weak_ptr<SharedState> state_;
         std::atomic<std::shared_ptr<Disposable>> delay_disposable_;
+        std::optional<DelayedWorkItemList::iterator> queue_position_;
     };
 
 private:
-    void Initialize(std::size_t max_thread_count);
+    void Initialize(std::size_t max_thread_count, ThreadPoolQueueMode queue_mode);
     void CreateFirstThreadIfNeeded();
     void CreateTimerThreadIfNeeded();
 
+    Worker* GetCurrentThreadWorker() const noexcept;
+    void QueueToLocalQueue(Worker& worker, const std::shared_ptr<WorkItem>& work_item);
+
     static void OnDelayedWorkItemReady(
         const std::weak_ptr<SharedState>& weak_state,
-        const std::shared_ptr<WorkItem>& work_item) noexcept;
+        const std::shared_ptr<DelayedWorkItem>& work_item) noexcept;
 
     static void TryCreateNewThread(const std::shared_ptr<SharedState>& state) noexcept;
     static void CreateThreadInLock(const std::shared_ptr<SharedState>& state);
 
     static void ThreadProcedure(const std::shared_ptr<SharedState>& state);
+    static void WorkStealingThreadProcedure(
+        const std::shared_ptr<SharedState>& state, 
+        Worker* worker);
+
+    static std::shared_ptr<WorkItem> TakeWorkItem(SharedState& state, Worker& worker) noexcept;
+    static std::shared_ptr<WorkItem> TakeLocalWorkItem(
+        SharedState& state, 
+        Worker& worker) noexcept;
+    static std::shared_ptr<WorkItem> StealWorkItem(SharedState& state, Worker& thief) noexcept;
+    static bool WaitForWorkItems(SharedState& state);
+
+    static Worker*& CurrentThreadWorker() noexcept;
 
     std::size_t HybridQueueSize() const noexcept;
 
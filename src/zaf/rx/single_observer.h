@@ -81,7 +81,7 @@ public:
 
         auto on_success_bridge = [inner = std::move(on_success)](const std::any& value) {
             if (inner) {
-                inner(std::any_cast<T>(value));
+                inner(std::any_cast<const T&>(value));
             }
         };
 
@@ -7,12 +7,31 @@ namespace zaf::rx {
 template<typename T>
 class ReplaySubject : public SubjectBase<T> {
 public:
-    ReplaySubject() : SubjectBase<T>(internal::CreateReplaySubjectCore(std::nullopt)) {
+    ReplaySubject() : 
+        SubjectBase<T>(internal::CreateReplaySubjectCore(std::nullopt, std::nullopt)) {
 
     }
 
     explicit ReplaySubject(std::size_t replay_size) : 
-        SubjectBase<T>(internal::CreateReplaySubjectCore(replay_size)) {
+        SubjectBase<T>(internal::CreateReplaySubjectCore(replay_size, std::nullopt)) {
+
+    }
+
+    /**
+    Constructs a replay subject that replays the values emitted within the specified time window 
+    to new subscribers.
+    */
+    explicit ReplaySubject(std::chrono::steady_clock::duration replay_window) :
+        SubjectBase<T>(internal::CreateReplaySubjectCore(std::nullopt, replay_window)) {
+
+    }
+
+    /**
+    Constructs a replay subject that replays at most the specified number of the most recent 
+    values emitted within the specified time window to new subscribers.
+    */
+    ReplaySubject(std::size_t replay_size, std::chrono::steady_clock::duration replay_window) :
+        SubjectBase<T>(internal::CreateReplaySubjectCore(replay_size, replay_window)) {
 
     }
 };
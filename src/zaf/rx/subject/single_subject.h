@@ -11,7 +11,7 @@ namespace zaf::rx {
 template<typename T>
 class SingleSubject : public SubjectBase<T> {
 public:
-    SingleSubject() : SubjectBase<T>(internal::CreateReplaySubjectCore(1)) {
+    SingleSubject() : SubjectBase<T>(internal::CreateReplaySubjectCore(1, std::nullopt)) {
 
     }
 
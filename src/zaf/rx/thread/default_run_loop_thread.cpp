@@ -40,10 +40,7 @@ std::shared_ptr<Disposable> DefaultRunLoopThread::PostWork(Closure work) {
         }
 
         work_item = std::make_shared<WorkItem>(std::move(work));
-
-        auto insert_position = state_->hybrid_queue.begin() + state_->immediate_work_count;
-        state_->hybrid_queue.insert(insert_position, work_item);
-        state_->immediate_work_count++;
+        state_->work_queue.push_back(work_item);
     }
 
     state_->work_event.notify_one();
@@ -76,25 +73,10 @@ std::shared_ptr<Disposable> DefaultRunLoopThread::PostWorkAt(
             throw ExecutionStoppedError(ZAF_SOURCE_LOCATION());
         }
 
-        auto iterator = std::lower_bound(
-            state_->hybrid_queue.begin() + state_->immediate_work_count,
-            state_->hybrid_queue.end(),
-            work_item,
-            [](const std::shared_ptr<WorkItem>& existing,
-               const std::shared_ptr<DelayedWorkItem>& new_time) {
-                return existing->ExecuteTimePoint() < new_time->ExecuteTimePoint();
-            });
-
-        // The new work item should be inserted after the item which has the same execute time 
-        // point. 
-        if ((iterator != state_->hybrid_queue.end()) &&
-            ((*iterator)->ExecuteTimePoint() == work_item->ExecuteTimePoint())) {
-
-            state_->hybrid_queue.insert(iterator + 1, work_item);
-        }
-        else {
-            state_->hybrid_queue.insert(iterator, work_item);
-        }
+        // The wheel keeps works with the same execute time point in their posting order.
+        work_item->wheel_handle = state_->delayed_work_wheel.Insert(
+            execute_time_point, 
+            work_item);
     }
 
     state_->work_event.notify_one();
@@ -114,7 +96,7 @@ void DefaultRunLoopThread::ThreadProcedure(const std::shared_ptr<State>& state)
 
         auto wait_duration = ProcessDueDelayedWorkItems(state);
 
-        if (state->immediate_work_count == 0) {
+        if (state->work_queue.empty()) {
             if (wait_duration) {
                 state->work_event.wait_for(lock, *wait_duration);
             }
@@ -125,11 +107,10 @@ void DefaultRunLoopThread::ThreadProcedure(const std::shared_ptr<State>& state)
 
         // Execute one immediate work per run loop iteration.
         std::shared_ptr<WorkItem> work_item;
-        if (state->immediate_work_count > 0) {
+        if (!state->work_queue.empty()) {
 
-            work_item = std::move(state->hybrid_queue.front());
-            state->hybrid_queue.pop_front();
-            state->immediate_work_count--;
+            work_item = std::move(state->work_queue.front());
+            state->work_queue.pop_front();
         }
         lock.unlock();
 
@@ -141,22 +122,28 @@ void DefaultRunLoopThread::ThreadProcedure(const std::shared_ptr<State>& state)
     // All queued works should be executed before the thread exits.
     // The lock is already held here, so no need to lock again.
     ProcessDueDelayedWorkItems(state);
-    auto remain_work_items = std::move(state->hybrid_queue);
-    auto immediate_work_count = state->immediate_work_count;
+    auto remain_work_items = std::move(state->work_queue);
+
+    // Delayed works that are not due won't be executed. Take them out of the wheel to destroy 
+    // them outside the lock.
+    std::vector<std::shared_ptr<DelayedWorkItem>> abandoned_work_items;
+    state->delayed_work_wheel.TakeAllValues(
+        [&abandoned_work_items](std::shared_ptr<DelayedWorkItem>&& work_item) {
+            work_item->wheel_handle.reset();
+            abandoned_work_items.push_back(std::move(work_item));
+        });
     lock.unlock();
 
-    auto end_iterator = remain_work_items.begin() + immediate_work_count;
-    for (auto iterator = remain_work_items.begin(); iterator != end_iterator; ++iterator) {
-        (*iterator)->RunWork();
+    for (const auto& each_item : remain_work_items) {
+        each_item->RunWork();
     }
 }
 
 
 std::optional<std::chrono::steady_clock::duration> 
-    DefaultRunLoopThread::ProcessDueDelayedWorkItems(
-        const std::shared_ptr<State>& state) noexcept {
+    DefaultRunLoopThread::ProcessDueDelayedWorkItems(const std::shared_ptr<State>& state) {
 
-    if (state->hybrid_queue.empty()) {
+    if (state->delayed_work_wheel.IsEmpty()) {
         return std::nullopt;
     }
 
@@ -164,19 +151,18 @@ std::optional<std::chrono::steady_clock::duration>
     // starvation.
     auto now = std::chrono::steady_clock::now();
 
-    for (auto iterator = state->hybrid_queue.begin() + state->immediate_work_count;
-         iterator != state->hybrid_queue.end();
-         ++iterator) {
+    state->delayed_work_wheel.TakeDueValues(
+        now, 
+        [&state](std::shared_ptr<DelayedWorkItem>&& work_item) {
+            work_item->wheel_handle.reset();
+            state->work_queue.push_back(std::move(work_item));
+        });
 
-        if ((*iterator)->ExecuteTimePoint() <= now) {
-            state->immediate_work_count++;
-        }
-        else {
-            return (*iterator)->ExecuteTimePoint() - now;
-        }
+    auto next_time_point = state->delayed_work_wheel.NextTimePoint();
+    if (!next_time_point) {
+        return std::nullopt;
     }
-
-    return std::nullopt;
+    return *next_time_point - now;
 }
 
 
@@ -208,38 +194,12 @@ void DefaultRunLoopThread::DelayedWorkItem::OnDispose() noexcept {
         return;
     }
 
-    bool need_notify{};
-    {
-        std::lock_guard<std::mutex> lock(state->lock);
-
-        auto delayed_begin = state->hybrid_queue.begin() + state->immediate_work_count;
-        auto iterator = std::lower_bound(
-            delayed_begin,
-            state->hybrid_queue.end(),
-            this,
-            [](const std::shared_ptr<WorkItem>& existing,
-               DelayedWorkItem* current_item) {
-                return existing->ExecuteTimePoint() < current_item->ExecuteTimePoint();
-            });
-
-        for (; iterator != state->hybrid_queue.end(); ++iterator) {
-
-            if ((*iterator)->ExecuteTimePoint() != this->ExecuteTimePoint()) {
-                break;
-            }
-
-            if ((*iterator).get() == this) {
-                if (iterator == delayed_begin) {
-                    need_notify = true;
-                }
-                state->hybrid_queue.erase(iterator);
-                break;
-            }
-        }
-    }
-
-    if (need_notify) {
-        state->work_event.notify_one();
+    // There is no need to wake up the thread, it will find nothing due when the cancelled work
+    // was due.
+    std::lock_guard<std::mutex> lock(state->lock);
+    if (wheel_handle) {
+        state->delayed_work_wheel.Erase(*wheel_handle);
+        wheel_handle.reset();
     }
 }
 
@@ -11,6 +11,7 @@
 #include <thread>
 #include <vector>
 #include <zaf/rx/internal/thread/thread_work_item_base.h>
+#include <zaf/rx/internal/thread/timer_wheel.h>
 #include <zaf/rx/thread/run_loop_thread.h>
 
 namespace zaf::testing {
@@ -77,17 +78,18 @@ private:
 
     class State {
     public:
+        using DelayedWorkWheel = internal::TimerWheel<std::shared_ptr<DelayedWorkItem>>;
+
         std::mutex lock;
         std::atomic<bool> is_stopped{};
         std::condition_variable work_event;
 
-        // A hybrid queue that contains both immediate works and delayed works.
-        // Immediate works are always in the front of the queue, sorting by their posting order.
-        // Delayed works are always in the back of the queue, sorting by their execute time point.
-        std::deque<std::shared_ptr<WorkItem>> hybrid_queue;
+        // Immediate works, sorting by their posting order. Due delayed works are moved to the 
+        // back of the queue.
+        std::deque<std::shared_ptr<WorkItem>> work_queue;
 
-        // Count of immediate works in the hybrid queue.
-        std::size_t immediate_work_count{};
+        // Delayed works that are not due yet.
+        DelayedWorkWheel delayed_work_wheel{ std::chrono::steady_clock::now() };
     };
 
     class WorkItem : public internal::ThreadWorkItemBase {
@@ -125,6 +127,11 @@ private:
             Closure work,
             std::weak_ptr<State> state) noexcept;
 
+    public:
+        // The handle in the delayed work wheel, which is reset once the work is moved out of the
+        // wheel. It should be accessed only when holding the lock of the state.
+        std::optional<State::DelayedWorkWheel::Handle> wheel_handle;
+
     protected:
         void OnDispose() noexcept override;
 
@@ -138,7 +145,7 @@ private:
 private:
     static void ThreadProcedure(const std::shared_ptr<State>& state);
     static std::optional<std::chrono::steady_clock::duration> ProcessDueDelayedWorkItems(
-        const std::shared_ptr<State>& state) noexcept;
+        const std::shared_ptr<State>& state);
 
 private:
     friend class zaf::testing::DefaultRunLoopThreadTest;
@@ -252,7 +252,7 @@ void WindowMouseFacet::ChangeControlMouseOverState(
 
         //Parents at the route path should update their styles to reflect the change of mouse 
         //over state. For example, parents may use ContainsMouse to update their styles.
-        sender->NeedUpdateStyle();
+        sender->NeedUpdateStyle(StyleInput::IsMouseOver);
 
         if (is_mouse_over) {
             sender->OnMouseEnter(MouseEnterInfo{ event_info_state, sender });
@@ -29,15 +29,7 @@ void WindowRenderFacet::HandleWMPAINT() {
     auto auto_reset = MakeAutoReset(handle_state_data.is_painting, true);
 
     auto handle = window_.Handle();
-
-    zaf::Rect dirty_rect;
-    RECT win32_rect{};
-    if (GetUpdateRect(handle, &win32_rect, TRUE)) {
-        dirty_rect = ToDIPs(Rect::FromRECT(win32_rect), window_.DPI());
-    }
-    else {
-        dirty_rect = window_.RootControl()->Rect();
-    }
+    auto dirty_region = GetDirtyRegion();
 
     //The update rect must be validated before painting.
     //Because some controls may call NeedRepaint while it is painting,
@@ -47,7 +39,11 @@ void WindowRenderFacet::HandleWMPAINT() {
     auto& renderer = handle_state_data.renderer;
     renderer.BeginDraw();
     Canvas canvas(renderer);
-    {
+
+    //Rects in the dirty region are painted one by one, so that the area between them is not
+    //repainted.
+    for (const auto& dirty_rect : dirty_region.Rects()) {
+
         auto layer_guard = canvas.PushRegion(window_.RootControl()->Rect(), dirty_rect);
 
         //Paint window background color first.
@@ -73,6 +69,37 @@ void WindowRenderFacet::HandleWMPAINT() {
 }
 
 
+DirtyRegion WindowRenderFacet::GetDirtyRegion() const {
+
+    DirtyRegion result;
+
+    //Get rects of the update region rather than its bounding rect, so that separated dirty areas,
+    //such as carets at opposite corners, are not repainted as a whole.
+    HRGN update_region = CreateRectRgn(0, 0, 0, 0);
+    int region_type = GetUpdateRgn(window_.Handle(), update_region, TRUE);
+    if (region_type == SIMPLEREGION || region_type == COMPLEXREGION) {
+
+        DWORD data_size = GetRegionData(update_region, 0, nullptr);
+        std::vector<std::byte> buffer(data_size);
+        auto region_data = reinterpret_cast<RGNDATA*>(buffer.data());
+
+        if (data_size > 0 && GetRegionData(update_region, data_size, region_data)) {
+
+            auto rects = reinterpret_cast<const RECT*>(region_data->Buffer);
+            for (DWORD index = 0; index < region_data->rdh.nCount; ++index) {
+                result.Add(ToDIPs(Rect::FromRECT(rects[index]), window_.DPI()));
+            }
+        }
+    }
+    DeleteObject(update_region);
+
+    if (result.IsEmpty()) {
+        result.Add(window_.RootControl()->Rect());
+    }
+    return result;
+}
+
+
 void WindowRenderFacet::RecreateRenderer() {
 
     window_.RootControl()->ReleaseRendererResources();
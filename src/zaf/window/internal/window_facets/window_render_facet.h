@@ -2,6 +2,7 @@
 
 #include <zaf/base/non_copyable.h>
 #include <zaf/graphic/rect.h>
+#include <zaf/internal/graphic/dirty_region.h>
 
 namespace zaf {
 class Window;
@@ -22,6 +23,7 @@ public:
 
 private:
     void RecreateRenderer();
+    DirtyRegion GetDirtyRegion() const;
     
 private:
     Window& window_;
@@ -0,0 +1,706 @@
+#include <zaf/xml/internal/xml_pull_parser.h>
+#include <algorithm>
+#include <zaf/xml/xml_error.h>
+
+namespace zaf::internal {
+namespace {
+
+bool IsWhitespace(wchar_t ch) noexcept {
+    return ch == L' ' || ch == L'\t' || ch == L'\n' || ch == L'\r';
+}
+
+
+bool IsNameStartChar(wchar_t ch) noexcept {
+    return
+        (ch >= L'a' && ch <= L'z') ||
+        (ch >= L'A' && ch <= L'Z') ||
+        ch == L'_' ||
+        ch == L':' ||
+        ch >= 0x80;
+}
+
+
+bool IsNameChar(wchar_t ch) noexcept {
+    return IsNameStartChar(ch) || (ch >= L'0' && ch <= L'9') || ch == L'-' || ch == L'.';
+}
+
+
+std::wstring_view GetLocalName(std::wstring_view qualified_name) noexcept {
+
+    auto colon_index = qualified_name.find(L':');
+    if (colon_index == std::wstring_view::npos) {
+        return qualified_name;
+    }
+    return qualified_name.substr(colon_index + 1);
+}
+
+
+bool IsValidCodePoint(char32_t code_point) noexcept {
+    return code_point <= 0x10FFFF && (code_point < 0xD800 || code_point > 0xDFFF);
+}
+
+
+void AppendCodePoint(char32_t code_point, std::wstring& string) {
+
+    if constexpr (sizeof(wchar_t) == 2) {
+
+        if (code_point >= 0x10000) {
+            code_point -= 0x10000;
+            string.append(1, static_cast<wchar_t>(0xD800 + (code_point >> 10)));
+            string.append(1, static_cast<wchar_t>(0xDC00 + (code_point & 0x3FF)));
+            return;
+        }
+    }
+
+    string.append(1, static_cast<wchar_t>(code_point));
+}
+
+
+std::wstring DecodeUTF8(std::string_view text) {
+
+    if (text.starts_with("\xEF\xBB\xBF")) {
+        text.remove_prefix(3);
+    }
+
+    //The decoded text has at most as many characters as the bytes of the UTF-8 text.
+    std::wstring result(text.length(), L'\0');
+    auto output = result.data();
+
+    std::size_t index{};
+    while (index < text.length()) {
+
+        auto lead_byte = static_cast<unsigned char>(text[index]);
+        if (lead_byte < 0x80) {
+            *output++ = static_cast<wchar_t>(lead_byte);
+            ++index;
+            continue;
+        }
+
+        std::size_t trail_count{};
+        char32_t code_point{};
+        if ((lead_byte & 0xE0) == 0xC0) {
+            trail_count = 1;
+            code_point = lead_byte & 0x1F;
+        }
+        else if ((lead_byte & 0xF0) == 0xE0) {
+            trail_count = 2;
+            code_point = lead_byte & 0x0F;
+        }
+        else if ((lead_byte & 0xF8) == 0xF0) {
+            trail_count = 3;
+            code_point = lead_byte & 0x07;
+        }
+        else {
+            throw XMLError{ ZAF_SOURCE_LOCATION() };
+        }
+
+        if (text.length() - index <= trail_count) {
+            throw XMLError{ ZAF_SOURCE_LOCATION() };
+        }
+
+        for (std::size_t trail_index = 1; trail_index <= trail_count; ++trail_index) {
+
+            auto trail_byte = static_cast<unsigned char>(text[index + trail_index]);
+            if ((trail_byte & 0xC0) != 0x80) {
+                throw XMLError{ ZAF_SOURCE_LOCATION() };
+            }
+            code_point = (code_point << 6) | (trail_byte & 0x3F);
+        }
+
+        //Overlong encodings are invalid.
+        constexpr char32_t min_code_points[] = { 0, 0x80, 0x800, 0x10000 };
+        if (code_point < min_code_points[trail_count] || !IsValidCodePoint(code_point)) {
+            throw XMLError{ ZAF_SOURCE_LOCATION() };
+        }
+
+        //A supplementary character takes two UTF-16 code units, which is fewer than its 4 bytes.
+        if (sizeof(wchar_t) == 2 && code_point >= 0x10000) {
+            code_point -= 0x10000;
+            *output++ = static_cast<wchar_t>(0xD800 + (code_point >> 10));
+            *output++ = static_cast<wchar_t>(0xDC00 + (code_point & 0x3FF));
+        }
+        else {
+            *output++ = static_cast<wchar_t>(code_point);
+        }
+
+        index += trail_count + 1;
+    }
+
+    result.resize(output - result.data());
+    return result;
+}
+
+
+bool AppendEntity(std::wstring_view entity, std::wstring& string) {
+
+    if (entity == L"lt") {
+        string.append(1, L'<');
+    }
+    else if (entity == L"gt") {
+        string.append(1, L'>');
+    }
+    else if (entity == L"amp") {
+        string.append(1, L'&');
+    }
+    else if (entity == L"quot") {
+        string.append(1, L'"');
+    }
+    else if (entity == L"apos") {
+        string.append(1, L'\'');
+    }
+    else if (entity.starts_with(L'#')) {
+
+        bool is_hex = entity.starts_with(L"#x");
+        auto digits = entity.substr(is_hex ? 2 : 1);
+        if (digits.empty()) {
+            return false;
+        }
+
+        char32_t code_point{};
+        for (auto each_char : digits) {
+
+            char32_t digit{};
+            if (each_char >= L'0' && each_char <= L'9') {
+                digit = each_char - L'0';
+            }
+            else if (is_hex && each_char >= L'a' && each_char <= L'f') {
+                digit = each_char - L'a' + 10;
+            }
+            else if (is_hex && each_char >= L'A' && each_char <= L'F') {
+                digit = each_char - L'A' + 10;
+            }
+            else {
+                return false;
+            }
+
+            code_point = code_point * (is_hex ? 16 : 10) + digit;
+            if (code_point > 0x10FFFF) {
+                return false;
+            }
+        }
+
+        if (code_point == 0 || !IsValidCodePoint(code_point)) {
+            return false;
+        }
+
+        AppendCodePoint(code_point, string);
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+}
+
+XMLPullParser::XMLPullParser(std::wstring text) :
+    owned_text_(std::move(text)),
+    text_(owned_text_) {
+
+    if (text_.starts_with(static_cast<wchar_t>(0xFEFF))) {
+        position_ = 1;
+    }
+}
+
+
+XMLPullParser::XMLPullParser(std::wstring_view text) : text_(text) {
+
+    if (text_.starts_with(static_cast<wchar_t>(0xFEFF))) {
+        position_ = 1;
+    }
+}
+
+
+XMLPullParser::XMLPullParser(std::string_view utf8_text) :
+    owned_text_(DecodeUTF8(utf8_text)),
+    text_(owned_text_) {
+
+}
+
+
+bool XMLPullParser::Read() {
+
+    name_ = {};
+    value_ = {};
+    is_empty_element_ = false;
+    attributes_.clear();
+    current_attribute_index_.reset();
+    decoded_values_.clear();
+
+    if (position_ >= text_.length()) {
+
+        //The document must have exactly one root element, which is closed.
+        if (!has_root_element_ || !open_elements_.empty()) {
+            ThrowError();
+        }
+
+        node_type_ = XMLNodeType::None;
+        return false;
+    }
+
+    if (text_[position_] == L'<') {
+        ReadMarkup();
+    }
+    else {
+        ReadCharacterData();
+    }
+    return true;
+}
+
+
+void XMLPullParser::ReadMarkup() {
+
+    if (SkipIfStartsWith(L"<?")) {
+        ReadXMLDeclarationOrProcessingInstruction();
+    }
+    else if (SkipIfStartsWith(L"<!--")) {
+        ReadComment();
+    }
+    else if (SkipIfStartsWith(L"<![CDATA[")) {
+        ReadCDATA();
+    }
+    else if (SkipIfStartsWith(L"<!DOCTYPE")) {
+        ReadDocumentType();
+    }
+    else if (SkipIfStartsWith(L"</")) {
+        ReadElementEnd();
+    }
+    else {
+        ++position_;
+        ReadElementStart();
+    }
+}
+
+
+void XMLPullParser::ReadXMLDeclarationOrProcessingInstruction() {
+
+    auto markup_position = position_ - 2;
+    auto target = ReadName();
+
+    if (target == L"xml") {
+
+        //The XML declaration is allowed only at the beginning of the document.
+        std::size_t document_start = text_.starts_with(static_cast<wchar_t>(0xFEFF)) ? 1 : 0;
+        if (markup_position != document_start) {
+            ThrowError();
+        }
+
+        node_type_ = XMLNodeType::XMLDeclaration;
+        name_ = target;
+
+        if (ReadAttributes() != L"?>") {
+            ThrowError();
+        }
+        return;
+    }
+
+    node_type_ = XMLNodeType::ProcessingInstruction;
+    name_ = target;
+
+    SkipWhitespace();
+    value_ = NormalizeLineBreaks(ReadUntil(L"?>"));
+}
+
+
+void XMLPullParser::ReadComment() {
+
+    node_type_ = XMLNodeType::Comment;
+    value_ = NormalizeLineBreaks(ReadUntil(L"-->"));
+}
+
+
+void XMLPullParser::ReadCDATA() {
+
+    if (open_elements_.empty()) {
+        ThrowError();
+    }
+
+    node_type_ = XMLNodeType::CDATA;
+    value_ = NormalizeLineBreaks(ReadUntil(L"]]>"));
+}
+
+
+void XMLPullParser::ReadDocumentType() {
+
+    if (has_root_element_ || !SkipWhitespace()) {
+        ThrowError();
+    }
+
+    node_type_ = XMLNodeType::DocumentType;
+    name_ = ReadName();
+
+    //Skip the external ID and the internal subset.
+    std::size_t bracket_depth{};
+    while (position_ < text_.length()) {
+
+        auto ch = text_[position_];
+        ++position_;
+
+        if (ch == L'"' || ch == L'\'') {
+
+            auto quote_end = text_.find(ch, position_);
+            if (quote_end == std::wstring_view::npos) {
+                break;
+            }
+            position_ = quote_end + 1;
+        }
+        else if (ch == L'[') {
+            ++bracket_depth;
+        }
+        else if (ch == L']') {
+
+            if (bracket_depth == 0) {
+                break;
+            }
+            --bracket_depth;
+        }
+        else if (ch == L'>' && bracket_depth == 0) {
+            return;
+        }
+    }
+
+    ThrowError();
+}
+
+
+void XMLPullParser::ReadElementStart() {
+
+    //Only one root element is allowed.
+    if (has_root_element_ && open_elements_.empty()) {
+        ThrowError();
+    }
+
+    auto qualified_name = ReadName();
+
+    node_type_ = XMLNodeType::ElementStart;
+    name_ = GetLocalName(qualified_name);
+
+    auto end_mark = ReadAttributes();
+    if (end_mark == L"/>") {
+        is_empty_element_ = true;
+    }
+    else if (end_mark == L">") {
+        open_elements_.push_back(qualified_name);
+    }
+    else {
+        ThrowError();
+    }
+
+    has_root_element_ = true;
+}
+
+
+void XMLPullParser::ReadElementEnd() {
+
+    auto qualified_name = ReadName();
+    SkipWhitespace();
+    Expect(L'>');
+
+    if (open_elements_.empty() || open_elements_.back() != qualified_name) {
+        ThrowError();
+    }
+    open_elements_.pop_back();
+
+    node_type_ = XMLNodeType::ElementEnd;
+    name_ = GetLocalName(qualified_name);
+}
+
+
+std::wstring_view XMLPullParser::ReadAttributes() {
+
+    while (true) {
+
+        bool has_whitespace = SkipWhitespace();
+
+        for (std::wstring_view end_mark : { L">", L"/>", L"?>" }) {
+            if (SkipIfStartsWith(end_mark)) {
+                return end_mark;
+            }
+        }
+
+        //Attributes must be separated by whitespace.
+        if (!has_whitespace) {
+            ThrowError();
+        }
+
+        auto name = ReadName();
+        SkipWhitespace();
+        Expect(L'=');
+        SkipWhitespace();
+
+        if (position_ >= text_.length()) {
+            ThrowError();
+        }
+
+        auto quote = text_[position_];
+        if (quote != L'"' && quote != L'\'') {
+            ThrowError();
+        }
+        ++position_;
+
+        auto quote_end = text_.find(quote, position_);
+        if (quote_end == std::wstring_view::npos) {
+            ThrowError();
+        }
+
+        auto raw_value = text_.substr(position_, quote_end - position_);
+        if (raw_value.find(L'<') != std::wstring_view::npos) {
+            ThrowError();
+        }
+        position_ = quote_end + 1;
+
+        for (const auto& each_attribute : attributes_) {
+            if (each_attribute.name == name) {
+                ThrowError();
+            }
+        }
+
+        attributes_.push_back(Attribute{ name, DecodeText(raw_value, true) });
+    }
+}
+
+
+void XMLPullParser::ReadCharacterData() {
+
+    auto end = text_.find(L'<', position_);
+    if (end == std::wstring_view::npos) {
+        end = text_.length();
+    }
+
+    auto raw_value = text_.substr(position_, end - position_);
+    position_ = end;
+
+    if (std::all_of(raw_value.begin(), raw_value.end(), IsWhitespace)) {
+        node_type_ = XMLNodeType::Whitespace;
+        value_ = NormalizeLineBreaks(raw_value);
+        return;
+    }
+
+    //Text is not allowed outside the root element.
+    if (open_elements_.empty()) {
+        ThrowError();
+    }
+
+    node_type_ = XMLNodeType::Text;
+    value_ = DecodeText(raw_value, false);
+}
+
+
+std::wstring_view XMLPullParser::ReadName() {
+
+    auto start = position_;
+    if (position_ >= text_.length() || !IsNameStartChar(text_[position_])) {
+        ThrowError();
+    }
+
+    ++position_;
+    while (position_ < text_.length() && IsNameChar(text_[position_])) {
+        ++position_;
+    }
+
+    return text_.substr(start, position_ - start);
+}
+
+
+std::wstring_view XMLPullParser::ReadUntil(std::wstring_view end_mark) {
+
+    auto end = text_.find(end_mark, position_);
+    if (end == std::wstring_view::npos) {
+        ThrowError();
+    }
+
+    auto result = text_.substr(position_, end - position_);
+    position_ = end + end_mark.length();
+    return result;
+}
+
+
+bool XMLPullParser::SkipWhitespace() noexcept {
+
+    auto start = position_;
+    while (position_ < text_.length() && IsWhitespace(text_[position_])) {
+        ++position_;
+    }
+    return position_ != start;
+}
+
+
+bool XMLPullParser::SkipIfStartsWith(std::wstring_view string) noexcept {
+
+    if (text_.substr(position_).starts_with(string)) {
+        position_ += string.length();
+        return true;
+    }
+    return false;
+}
+
+
+void XMLPullParser::Expect(wchar_t ch) {
+
+    if (position_ >= text_.length() || text_[position_] != ch) {
+        ThrowError();
+    }
+    ++position_;
+}
+
+
+std::wstring_view XMLPullParser::DecodeText(std::wstring_view text, bool is_attribute_value) {
+
+    auto need_decode = [is_attribute_value](wchar_t ch) {
+        return
+            ch == L'&' ||
+            ch == L'\r' ||
+            (is_attribute_value && (ch == L'\t' || ch == L'\n'));
+    };
+
+    auto first_iterator = std::find_if(text.begin(), text.end(), need_decode);
+    if (first_iterator == text.end()) {
+        return text;
+    }
+
+    auto& result = decoded_values_.emplace_back(text.begin(), first_iterator);
+    result.reserve(text.length());
+
+    std::size_t index = first_iterator - text.begin();
+    while (index < text.length()) {
+
+        auto ch = text[index];
+        if (ch == L'&') {
+
+            auto entity_end = text.find(L';', index + 1);
+            if (entity_end == std::wstring_view::npos) {
+                ThrowError();
+            }
+
+            if (!AppendEntity(text.substr(index + 1, entity_end - index - 1), result)) {
+                ThrowError();
+            }
+            index = entity_end + 1;
+        }
+        else if (ch == L'\r') {
+
+            //CRLF and CR are normalized to LF, and line breaks in attribute values are further
+            //normalized to spaces.
+            result.append(1, is_attribute_value ? L' ' : L'\n');
+            bool is_crlf = index + 1 < text.length() && text[index + 1] == L'\n';
+            index += is_crlf ? 2 : 1;
+        }
+        else if (is_attribute_value && (ch == L'\t' || ch == L'\n')) {
+            result.append(1, L' ');
+            ++index;
+        }
+        else {
+            result.append(1, ch);
+            ++index;
+        }
+    }
+
+    return result;
+}
+
+
+std::wstring_view XMLPullParser::NormalizeLineBreaks(std::wstring_view text) {
+
+    auto cr_index = text.find(L'\r');
+    if (cr_index == std::wstring_view::npos) {
+        return text;
+    }
+
+    auto& result = decoded_values_.emplace_back(text.substr(0, cr_index));
+    result.reserve(text.length());
+
+    for (auto index = cr_index; index < text.length(); ++index) {
+
+        if (text[index] != L'\r') {
+            result.append(1, text[index]);
+            continue;
+        }
+
+        result.append(1, L'\n');
+        if (index + 1 < text.length() && text[index + 1] == L'\n') {
+            ++index;
+        }
+    }
+
+    return result;
+}
+
+
+void XMLPullParser::ThrowError() const {
+    throw XMLError{ ZAF_SOURCE_LOCATION() };
+}
+
+
+XMLNodeType XMLPullParser::GetNodeType() const noexcept {
+    return current_attribute_index_ ? XMLNodeType::Attribute : node_type_;
+}
+
+
+std::wstring_view XMLPullParser::GetName() const noexcept {
+
+    if (current_attribute_index_) {
+        return GetLocalName(attributes_[*current_attribute_index_].name);
+    }
+    return name_;
+}
+
+
+std::wstring_view XMLPullParser::GetValue() const noexcept {
+
+    if (current_attribute_index_) {
+        return attributes_[*current_attribute_index_].value;
+    }
+    return value_;
+}
+
+
+bool XMLPullParser::IsEmptyElement() const noexcept {
+    return is_empty_element_;
+}
+
+
+bool XMLPullParser::MoveToFirstAttribute() noexcept {
+
+    if (attributes_.empty()) {
+        return false;
+    }
+
+    current_attribute_index_ = 0;
+    return true;
+}
+
+
+bool XMLPullParser::MoveToNextAttribute() noexcept {
+
+    //Like XmlLite, moving to the next attribute from the element moves to the first attribute.
+    if (!current_attribute_index_) {
+        return MoveToFirstAttribute();
+    }
+
+    if (*current_attribute_index_ + 1 >= attributes_.size()) {
+        return false;
+    }
+
+    ++*current_attribute_index_;
+    return true;
+}
+
+
+bool XMLPullParser::MoveToAttributeByName(std::wstring_view name) noexcept {
+
+    for (std::size_t index = 0; index < attributes_.size(); ++index) {
+
+        if (GetLocalName(attributes_[index].name) == name) {
+            current_attribute_index_ = index;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void XMLPullParser::MoveToElement() noexcept {
+    current_attribute_index_.reset();
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <zaf/base/non_copyable.h>
+#include <zaf/xml/xml_node_type.h>
+
+namespace zaf::internal {
+
+/**
+A portable pull parser of XML, which has the same node model as XmlLite.
+
+@details
+    The parser works on one UTF-16 buffer of the whole document, which is either referred to
+    without copying or owned by the parser, depending on the constructor. Names and values of nodes
+    refer to the buffer directly. A value is decoded to a separate string only if it contains
+    entity references or characters that have to be normalized, and it is valid until the next
+    call to Read().
+
+    Namespaces are not resolved; names are local names with prefixes removed. DTDs are skipped
+    without validation, and only predefined entities and character references are supported.
+
+    Malformed documents cause zaf::XMLError to be thrown.
+*/
+class XMLPullParser : NonCopyableNonMovable {
+public:
+    /**
+    Constructs a parser that reads the specified UTF-16 text, which is owned by the parser.
+    */
+    explicit XMLPullParser(std::wstring text);
+
+    /**
+    Constructs a parser that reads the specified UTF-16 text without copying it. The text must
+    outlive the parser.
+    */
+    explicit XMLPullParser(std::wstring_view text);
+
+    /**
+    Constructs a parser that reads the specified UTF-8 text, which is decoded to a UTF-16 buffer
+    owned by the parser at once.
+    */
+    explicit XMLPullParser(std::string_view utf8_text);
+
+    bool Read();
+
+    XMLNodeType GetNodeType() const noexcept;
+    std::wstring_view GetName() const noexcept;
+    std::wstring_view GetValue() const noexcept;
+    bool IsEmptyElement() const noexcept;
+
+    bool MoveToFirstAttribute() noexcept;
+    bool MoveToNextAttribute() noexcept;
+    bool MoveToAttributeByName(std::wstring_view name) noexcept;
+    void MoveToElement() noexcept;
+
+private:
+    class Attribute {
+    public:
+        std::wstring_view name;
+        std::wstring_view value;
+    };
+
+private:
+    void ReadMarkup();
+    void ReadXMLDeclarationOrProcessingInstruction();
+    void ReadComment();
+    void ReadCDATA();
+    void ReadDocumentType();
+    void ReadElementStart();
+    void ReadElementEnd();
+    //Returns the mark that ends the attribute list, which is one of ">", "/>" and "?>".
+    std::wstring_view ReadAttributes();
+    void ReadCharacterData();
+
+    std::wstring_view ReadName();
+    std::wstring_view ReadUntil(std::wstring_view end_mark);
+    bool SkipWhitespace() noexcept;
+    bool SkipIfStartsWith(std::wstring_view string) noexcept;
+    void Expect(wchar_t ch);
+
+    std::wstring_view DecodeText(std::wstring_view text, bool is_attribute_value);
+    std::wstring_view NormalizeLineBreaks(std::wstring_view text);
+
+    [[noreturn]]
+    void ThrowError() const;
+
+private:
+    //Empty if the parser refers to a text owned by others.
+    std::wstring owned_text_;
+    std::wstring_view text_;
+    std::size_t position_{};
+
+    XMLNodeType node_type_{ XMLNodeType::None };
+    std::wstring_view name_;
+    std::wstring_view value_;
+    bool is_empty_element_{};
+
+    std::vector<Attribute> attributes_;
+    std::optional<std::size_t> current_attribute_index_;
+
+    //Qualified names of elements which are not closed yet.
+    std::vector<std::wstring_view> open_elements_;
+    bool has_root_element_{};
+
+    //Values that are different from the text in the document. They are released on each read.
+    std::deque<std::wstring> decoded_values_;
+};
+
+}
\ No newline at end of file
@@ -4,8 +4,27 @@
 
 namespace zaf {
 
+/**
+Parsers that XMLReader can use.
+*/
+enum class XMLParserType {
+
+    /**
+    The XmlLite parser of Windows.
+    */
+    XmlLite,
+
+    /**
+    The built-in pull parser, which reads the whole stream at once. UTF-16 content in a memory
+    stream is referred to without copying, while UTF-8 content is decoded to UTF-16 once. It
+    supports UTF-8 and little-endian UTF-16 only, and doesn't process DTDs.
+    */
+    Native,
+};
+
 struct XMLInputOptions {
     CodePage code_page{ CodePage::UTF8 };
+    XMLParserType parser_type{ XMLParserType::XmlLite };
 };
 
 }
\ No newline at end of file
@@ -1,21 +1,20 @@
 #pragma once
 
-#include <xmllite.h>
-
 namespace zaf {
 
+//Values are the same as XmlNodeType of XmlLite.
 enum class XMLNodeType {
-    None = XmlNodeType_None,
-    ElementStart = XmlNodeType_Element,
-    Attribute = XmlNodeType_Attribute,
-    Text = XmlNodeType_Text,
-    CDATA = XmlNodeType_CDATA,
-    ProcessingInstruction = XmlNodeType_ProcessingInstruction,
-    Comment = XmlNodeType_Comment,
-    DocumentType = XmlNodeType_DocumentType,
-    Whitespace = XmlNodeType_Whitespace,
-    ElementEnd = XmlNodeType_EndElement,
-    XMLDeclaration = XmlNodeType_XmlDeclaration,
+    None = 0,
+    ElementStart = 1,
+    Attribute = 2,
+    Text = 3,
+    CDATA = 4,
+    ProcessingInstruction = 7,
+    Comment = 8,
+    DocumentType = 10,
+    Whitespace = 13,
+    ElementEnd = 15,
+    XMLDeclaration = 17,
 };
 
 }
\ No newline at end of file
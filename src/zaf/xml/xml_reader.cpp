@@ -1,12 +1,27 @@
 #include <zaf/xml/xml_reader.h>
+#include <cstdint>
+#include <cstring>
 #include <zaf/base/error/com_error.h>
 #include <zaf/base/error/precondition_error.h>
-
+#include <zaf/xml/internal/xml_pull_parser.h>
 #include <zaf/xml/xml_error.h>
 
 namespace zaf {
 namespace {
 
+static_assert(static_cast<int>(XMLNodeType::None) == XmlNodeType_None);
+static_assert(static_cast<int>(XMLNodeType::ElementStart) == XmlNodeType_Element);
+static_assert(static_cast<int>(XMLNodeType::Attribute) == XmlNodeType_Attribute);
+static_assert(static_cast<int>(XMLNodeType::Text) == XmlNodeType_Text);
+static_assert(static_cast<int>(XMLNodeType::CDATA) == XmlNodeType_CDATA);
+static_assert(
+    static_cast<int>(XMLNodeType::ProcessingInstruction) == XmlNodeType_ProcessingInstruction);
+static_assert(static_cast<int>(XMLNodeType::Comment) == XmlNodeType_Comment);
+static_assert(static_cast<int>(XMLNodeType::DocumentType) == XmlNodeType_DocumentType);
+static_assert(static_cast<int>(XMLNodeType::Whitespace) == XmlNodeType_Whitespace);
+static_assert(static_cast<int>(XMLNodeType::ElementEnd) == XmlNodeType_EndElement);
+static_assert(static_cast<int>(XMLNodeType::XMLDeclaration) == XmlNodeType_XmlDeclaration);
+
 COMPtr<IXmlReader> CreateIXmlReader() {
     COMPtr<IXmlReader> reader;
     HRESULT hresult = CreateXmlReader(__uuidof(IXmlReader), reader.ResetAsVoid(), nullptr);
@@ -15,6 +30,87 @@ COMPtr<IXmlReader> CreateIXmlReader() {
 }
 
 
+std::unique_ptr<internal::XMLPullParser> CreateNativeParser(
+    Stream& stream,
+    CodePage code_page) {
+
+    //Read all remaining content of the stream. Memory streams are accessed directly without
+    //copying.
+    std::string_view content;
+    std::string buffer;
+
+    auto remaining_size = static_cast<std::size_t>(stream.Size() - stream.Position());
+    auto underlying_buffer = stream.UnderlyingBuffer();
+    if (underlying_buffer) {
+        content = std::string_view{
+            reinterpret_cast<const char*>(underlying_buffer) + stream.Position(),
+            remaining_size
+        };
+        stream.Seek(SeekOrigin::Current, static_cast<std::int64_t>(remaining_size));
+    }
+    else {
+        buffer.resize(remaining_size);
+        std::size_t total_read_size{};
+        while (total_read_size < buffer.size()) {
+
+            auto read_size = stream.Read(
+                buffer.size() - total_read_size,
+                buffer.data() + total_read_size);
+
+            if (read_size == 0) {
+                break;
+            }
+            total_read_size += read_size;
+        }
+        buffer.resize(total_read_size);
+        content = buffer;
+    }
+
+    //The byte order mark takes precedence over the code page.
+    if (content.starts_with("\xFF\xFE")) {
+        code_page = CodePage::UTF16;
+        content.remove_prefix(2);
+    }
+    else if (content.starts_with("\xEF\xBB\xBF")) {
+        code_page = CodePage::UTF8;
+        content.remove_prefix(3);
+    }
+    else if (content.starts_with("\xFE\xFF")) {
+        //Big-endian UTF-16 is not supported.
+        throw XMLError{ ZAF_SOURCE_LOCATION() };
+    }
+
+    if (code_page == CodePage::UTF8) {
+        //The node model is UTF-16, so UTF-8 content is decoded to a buffer owned by the parser.
+        return std::make_unique<internal::XMLPullParser>(content);
+    }
+
+    //Code pages other than UTF-8 and UTF-16 are not supported.
+    if (code_page != CodePage::UTF16) {
+        throw XMLError{ ZAF_SOURCE_LOCATION() };
+    }
+
+    //The content is truncated in the middle of a code unit.
+    if (content.length() % sizeof(wchar_t) != 0) {
+        throw XMLError{ ZAF_SOURCE_LOCATION() };
+    }
+
+    //UTF-16 content in a memory stream is referred to without copying, as long as it's aligned.
+    auto text_length = content.length() / sizeof(wchar_t);
+    bool is_aligned = reinterpret_cast<std::uintptr_t>(content.data()) % alignof(wchar_t) == 0;
+    if (underlying_buffer && is_aligned) {
+        return std::make_unique<internal::XMLPullParser>(std::wstring_view{
+            reinterpret_cast<const wchar_t*>(content.data()),
+            text_length
+        });
+    }
+
+    std::wstring text(text_length, L'\0');
+    std::memcpy(text.data(), content.data(), text_length * sizeof(wchar_t));
+    return std::make_unique<internal::XMLPullParser>(std::move(text));
+}
+
+
 bool IsContentNodeType(XMLNodeType node_type) {
     return
         node_type == XMLNodeType::XMLDeclaration ||
@@ -42,6 +138,12 @@ XMLReader::XMLReader(Stream stream, const XMLInputOptions& options) {
 
     ZAF_EXPECT(stream);
 
+    if (options.parser_type == XMLParserType::Native) {
+        native_stream_ = stream;
+        native_parser_ = CreateNativeParser(native_stream_, options.code_page);
+        return;
+    }
+
     COMPtr<IXmlReaderInput> input;
     HRESULT hresult = CreateXmlReaderInputWithEncodingCodePage(
         stream.Ptr().Inner(),
@@ -60,8 +162,19 @@ XMLReader::XMLReader(Stream stream, const XMLInputOptions& options) {
 }
 
 
+XMLReader::~XMLReader() = default;
+
+XMLReader::XMLReader(XMLReader&&) = default;
+
+XMLReader& XMLReader::operator=(XMLReader&&) = default;
+
+
 bool XMLReader::Read() {
 
+    if (native_parser_) {
+        return native_parser_->Read();
+    }
+
     HRESULT hresult = inner_->Read(nullptr);
     ZAF_THROW_IF_COM_ERROR(hresult);
 
@@ -71,6 +184,10 @@ bool XMLReader::Read() {
 
 XMLNodeType XMLReader::GetNodeType() const {
 
+    if (native_parser_) {
+        return native_parser_->GetNodeType();
+    }
+
     XmlNodeType node_type{};
     HRESULT hresult = inner_->GetNodeType(&node_type);
     return static_cast<XMLNodeType>(node_type);
@@ -79,6 +196,10 @@ XMLNodeType XMLReader::GetNodeType() const {
 
 std::wstring_view XMLReader::GetName() const {
 
+    if (native_parser_) {
+        return native_parser_->GetName();
+    }
+
     const wchar_t* name{};
     UINT length{};
     HRESULT hresult = inner_->GetLocalName(&name, &length);
@@ -90,6 +211,10 @@ std::wstring_view XMLReader::GetName() const {
 
 std::wstring_view XMLReader::GetValue() const {
 
+    if (native_parser_) {
+        return native_parser_->GetValue();
+    }
+
     const wchar_t* value{};
     UINT length{};
     HRESULT hresult = inner_->GetValue(&value, &length);
@@ -100,12 +225,20 @@ std::wstring_view XMLReader::GetValue() const {
 
 
 bool XMLReader::IsEmptyElement() const noexcept {
+
+    if (native_parser_) {
+        return native_parser_->IsEmptyElement();
+    }
     return !!inner_->IsEmptyElement();
 }
 
 
 bool XMLReader::MoveToFirstAttribute() {
 
+    if (native_parser_) {
+        return native_parser_->MoveToFirstAttribute();
+    }
+
     HRESULT hresult = inner_->MoveToFirstAttribute();
     ZAF_THROW_IF_COM_ERROR(hresult);
 
@@ -115,6 +248,10 @@ bool XMLReader::MoveToFirstAttribute() {
 
 bool XMLReader::MoveToNextAttribute() {
 
+    if (native_parser_) {
+        return native_parser_->MoveToNextAttribute();
+    }
+
     HRESULT hresult = inner_->MoveToNextAttribute();
     ZAF_THROW_IF_COM_ERROR(hresult);
 
@@ -124,6 +261,11 @@ bool XMLReader::MoveToNextAttribute() {
 
 void XMLReader::MoveToElement() {
 
+    if (native_parser_) {
+        native_parser_->MoveToElement();
+        return;
+    }
+
     HRESULT hresult = inner_->MoveToElement();
     ZAF_THROW_IF_COM_ERROR(hresult);
 }
@@ -192,6 +334,16 @@ void XMLReader::ReadUntilNotEmptyElement(std::wstring_view element_name) {
 
 std::wstring XMLReader::GetAttributeValue(const std::wstring& attribute_name) const {
 
+    if (native_parser_) {
+
+        std::wstring value;
+        if (native_parser_->MoveToAttributeByName(attribute_name)) {
+            value = native_parser_->GetValue();
+        }
+        native_parser_->MoveToElement();
+        return value;
+    }
+
     HRESULT hresult = inner_->MoveToAttributeByName(attribute_name.c_str(), nullptr);
     ZAF_THROW_IF_COM_ERROR(hresult);
 
@@ -219,7 +371,7 @@ void XMLReader::ReadElementAttributes(
         MoveToElement();
     }
 
-    BOOL is_empty_element = inner_->IsEmptyElement();
+    bool is_empty_element = IsEmptyElement();
     Read();
     if (!is_empty_element) {
         ReadElementEnd();
@@ -2,6 +2,7 @@
 
 #include <xmllite.h>
 #include <functional>
+#include <memory>
 #include <zaf/base/com_ptr.h>
 #include <zaf/base/non_copyable.h>
 #include <zaf/io/stream/stream.h>
@@ -10,6 +11,9 @@
 #include <zaf/xml/xml_node_type.h>
 
 namespace zaf {
+namespace internal {
+class XMLPullParser;
+}
 
 class XMLAttributeReader;
 
@@ -22,6 +26,10 @@ public:
 public:
     explicit XMLReader(Stream stream);
     XMLReader(Stream stream, const XMLInputOptions& options);
+    ~XMLReader();
+
+    XMLReader(XMLReader&&);
+    XMLReader& operator=(XMLReader&&);
 
     bool Read();
 
@@ -66,6 +74,13 @@ private:
 
 private:
     COMPtr<IXmlReader> inner_;
+
+    //Not null if the native parser is used, in which case inner_ is null.
+    std::unique_ptr<internal::XMLPullParser> native_parser_;
+
+    //The stream read by the native parser, which is kept alive as the parser may refer to its
+    //buffer.
+    Stream native_stream_;
 };
 
 
@@ -85,7 +100,7 @@ public:
 
     template<typename T>
     T GetNumber() const {
-        return ToNumeric<T>(GetString().data());
+        return ToNumeric<T>(std::wstring{ GetString() });
     }
 
 private:
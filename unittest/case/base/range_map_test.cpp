@@ -197,6 +197,24 @@ TEST(RangeMapTest, AddRangeWithSameValue) {
         { Range(5, 8), "1" },
         { Range(15, 6), "3" },
     }));
+
+    //Add a range that intersects with the tail of an existing range, and the head of a range
+    //with different value.
+    ASSERT_TRUE(test(Range::FromIndexPair(11, 16), "1", {
+        { Range(0, 2), "0" },
+        { Range(5, 1), "1" },
+        { Range(10, 6), "1" },
+        { Range(16, 5), "3" },
+    }));
+
+    //Add a range that is right after an existing range, and intersects with the head of a range
+    //with different value.
+    ASSERT_TRUE(test(Range::FromIndexPair(13, 16), "1", {
+        { Range(0, 2), "0" },
+        { Range(5, 1), "1" },
+        { Range(10, 6), "1" },
+        { Range(16, 5), "3" },
+    }));
 }
 
 
@@ -0,0 +1,282 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <gtest/gtest.h>
+#include <zaf/base/range_map.h>
+#include <zaf/base/tree_range_map.h>
+
+using namespace zaf;
+
+namespace {
+
+template<typename M1, typename M2>
+bool IsSameItems(const M1& items1, const M2& items2) {
+
+    auto iterator1 = items1.begin();
+    auto iterator2 = items2.begin();
+    while (iterator1 != items1.end() && iterator2 != items2.end()) {
+
+        if (iterator1->Range() != iterator2->Range()) {
+            return false;
+        }
+
+        if (iterator1->Value() != iterator2->Value()) {
+            return false;
+        }
+
+        ++iterator1;
+        ++iterator2;
+    }
+
+    return iterator1 == items1.end() && iterator2 == items2.end();
+}
+
+}
+
+TEST(TreeRangeMapTest, AddAndRemoveRange) {
+
+    TreeRangeMap<std::string> map;
+    map.AddRange(Range{ 0, 2 }, "0");
+    map.AddRange(Range{ 5, 1 }, "1");
+    map.AddRange(Range{ 10, 3 }, "1");
+    map.AddRange(Range{ 15, 6 }, "3");
+    map.AddRange(Range::FromIndexPair(12, 18), "A");
+
+    RangeMap<std::string>::ItemList expected{
+        { Range(0, 2), "0" },
+        { Range(5, 1), "1" },
+        { Range(10, 2), "1" },
+        { Range(12, 6), "A" },
+        { Range(18, 3), "3" },
+    };
+    ASSERT_TRUE(IsSameItems(map, expected));
+
+    map.RemoveRange(Range{ 1, 10 });
+    expected = {
+        { Range(0, 1), "0" },
+        { Range(11, 1), "1" },
+        { Range(12, 6), "A" },
+        { Range(18, 3), "3" },
+    };
+    ASSERT_TRUE(IsSameItems(map, expected));
+}
+
+
+TEST(TreeRangeMapTest, ReplaceSpan) {
+
+    TreeRangeMap<std::string> map;
+    map.AddRange(Range{ 0, 2 }, "0");
+    map.AddRange(Range{ 5, 5 }, "1");
+    map.AddRange(Range{ 10, 3 }, "2");
+
+    //Insert a span inside an item.
+    map.InsertSpan(Range{ 7, 2 });
+    RangeMap<std::string>::ItemList expected{
+        { Range(0, 2), "0" },
+        { Range(5, 2), "1" },
+        { Range(9, 3), "1" },
+        { Range(12, 3), "2" },
+    };
+    ASSERT_TRUE(IsSameItems(map, expected));
+
+    //Erase a span crossing items.
+    map.EraseSpan(Range{ 1, 5 });
+    expected = {
+        { Range(0, 1), "0" },
+        { Range(1, 1), "1" },
+        { Range(4, 3), "1" },
+        { Range(7, 3), "2" },
+    };
+    ASSERT_TRUE(IsSameItems(map, expected));
+
+    //Replace a span with a longer one.
+    map.ReplaceSpan(Range{ 4, 3 }, 10);
+    expected = {
+        { Range(0, 1), "0" },
+        { Range(1, 1), "1" },
+        { Range(14, 3), "2" },
+    };
+    ASSERT_TRUE(IsSameItems(map, expected));
+}
+
+
+TEST(TreeRangeMapTest, Find) {
+
+    TreeRangeMap<std::string> map;
+    map.AddRange(Range{ 0, 2 }, "0");
+    map.AddRange(Range{ 5, 5 }, "1");
+    map.AddRange(Range{ 10, 3 }, "2");
+    map.InsertSpan(Range{ 0, 100 });
+
+    auto iterator = map.FindItemAtIndex(107);
+    ASSERT_NE(iterator, map.end());
+    ASSERT_EQ(iterator->Range(), Range(105, 5));
+    ASSERT_EQ(map.FindItemAtIndex(102), map.end());
+
+    const auto& const_map = map;
+    auto const_iterator = const_map.FindFirstItemIntersectsWithRange(Range{ 103, 3 });
+    ASSERT_NE(const_iterator, const_map.end());
+    ASSERT_EQ(const_iterator->Value(), "1");
+    ASSERT_EQ(const_map.FindFirstItemIntersectsWithRange(Range{ 102, 3 }), const_map.end());
+
+    //Iterate from the found item.
+    ++iterator;
+    ASSERT_EQ(iterator->Range(), Range(110, 3));
+    --iterator;
+    --iterator;
+    ASSERT_EQ(iterator->Range(), Range(100, 2));
+}
+
+
+TEST(TreeRangeMapTest, Iterate) {
+
+    TreeRangeMap<int> map;
+    for (int index = 0; index < 100; ++index) {
+        map.AddRange(Range(index * 2, 1), index);
+    }
+    map.InsertSpan(Range{ 50, 10 });
+
+    int expected_value = 0;
+    for (const auto& each_item : map) {
+        ASSERT_EQ(each_item.Value(), expected_value);
+        auto expected_index = static_cast<std::size_t>(expected_value * 2);
+        if (expected_index >= 50) {
+            expected_index += 10;
+        }
+        ASSERT_EQ(each_item.Range(), Range(expected_index, 1));
+        ++expected_value;
+    }
+    ASSERT_EQ(expected_value, 100);
+
+    //Iterate backward from the end.
+    auto iterator = map.end();
+    --iterator;
+    ASSERT_EQ(iterator->Value(), 99);
+
+    //Modify values through iterators.
+    map.begin()->Value() = 1000;
+    ASSERT_EQ(map.FindItemAtIndex(0)->Value(), 1000);
+}
+
+
+TEST(TreeRangeMapTest, CopyAndMove) {
+
+    TreeRangeMap<std::string> map;
+    map.AddRange(Range{ 0, 2 }, "0");
+    map.AddRange(Range{ 5, 5 }, "1");
+    map.InsertSpan(Range{ 3, 1 });
+
+    auto copied = map;
+    ASSERT_TRUE(IsSameItems(map, copied));
+
+    copied.EraseSpan(Range{ 0, 1 });
+    ASSERT_EQ(map.begin()->Range(), Range(0, 2));
+
+    auto moved = std::move(copied);
+    ASSERT_EQ(moved.Count(), 2);
+    ASSERT_TRUE(copied.IsEmpty());
+
+    moved = map;
+    ASSERT_TRUE(IsSameItems(map, moved));
+}
+
+
+//Apply the same random operations to both RangeMap and TreeRangeMap, the results should be the
+//same.
+TEST(TreeRangeMapTest, SameBehaviorAsRangeMap) {
+
+    std::mt19937 random_engine{ 19 };
+    auto random = [&](std::size_t max) {
+        return std::uniform_int_distribution<std::size_t>{ 0, max }(random_engine);
+    };
+
+    for (int round = 0; round < 50; ++round) {
+
+        RangeMap<int> map;
+        TreeRangeMap<int> tree_map;
+
+        for (int operation = 0; operation < 200; ++operation) {
+
+            Range range{ random(100), random(10) };
+            switch (random(4)) {
+            case 0:
+            case 1: {
+                //Use few values so that ranges are likely to be merged.
+                int value = static_cast<int>(random(2));
+                map.AddRange(range, value);
+                tree_map.AddRange(range, value);
+                break;
+            }
+            case 2:
+                map.RemoveRange(range);
+                tree_map.RemoveRange(range);
+                break;
+            case 3:
+                map.InsertSpan(range);
+                tree_map.InsertSpan(range);
+                break;
+            default: {
+                auto new_length = random(10);
+                map.ReplaceSpan(range, new_length);
+                tree_map.ReplaceSpan(range, new_length);
+                break;
+            }
+            }
+
+            ASSERT_EQ(map.Count(), tree_map.Count());
+            ASSERT_TRUE(IsSameItems(map, tree_map));
+
+            auto index = random(120);
+            auto iterator = map.FindItemAtIndex(index);
+            auto tree_iterator = tree_map.FindItemAtIndex(index);
+            ASSERT_EQ(iterator == map.end(), tree_iterator == tree_map.end());
+            if (iterator != map.end()) {
+                ASSERT_EQ(iterator->Range(), tree_iterator->Range());
+            }
+
+            Range find_range{ random(120), random(10) };
+            auto iterator2 = map.FindFirstItemIntersectsWithRange(find_range);
+            auto tree_iterator2 = tree_map.FindFirstItemIntersectsWithRange(find_range);
+            ASSERT_EQ(iterator2 == map.end(), tree_iterator2 == tree_map.end());
+            if (iterator2 != map.end()) {
+                ASSERT_EQ(iterator2->Range(), tree_iterator2->Range());
+            }
+        }
+    }
+}
+
+
+TEST(TreeRangeMapTest, DISABLED_Benchmark_EditWith100000Ranges) {
+
+    constexpr std::size_t range_count = 100'000;
+    constexpr std::size_t edit_count = 10'000;
+
+    auto measure = [](auto& map) {
+
+        for (std::size_t index = 0; index < range_count; ++index) {
+            map.AddRange(Range{ index * 2, 1 }, static_cast<int>(index % 3));
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        for (std::size_t count = 0; count < edit_count; ++count) {
+            //Simulate typing at the head of a large text, followed by a lookup.
+            map.InsertSpan(Range{ count % 100, 1 });
+            map.EraseSpan(Range{ count % 100, 1 });
+            map.FindItemAtIndex(range_count);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+            std::chrono::steady_clock::now() - begin);
+        return elapsed.count() / edit_count;
+    };
+
+    RangeMap<int> map;
+    TreeRangeMap<int> tree_map;
+    auto map_cost = measure(map);
+    auto tree_map_cost = measure(tree_map);
+
+    std::printf(
+        "RangeMap: %.2f us/edit\nTreeRangeMap: %.2f us/edit\n",
+        map_cost,
+        tree_map_cost);
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
+#include <chrono>
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <zaf/base/as.h>
 #include <zaf/control/button.h>
+#include <zaf/control/internal/style_dependency_tracker.h>
 #include <zaf/creation.h>
 #include "utility/test_window.h"
 
@@ -167,7 +170,8 @@ TEST_F(ControlStyleTest, UpdateOnIsSelectedChange) {
 
     ASSERT_EQ(RootUpdateCount(), 0);
     ASSERT_EQ(StemUpdateCount(), 1);
-    ASSERT_EQ(Leaf1UpdateCount(), 1);
+    // Leaf1 won't update as its style doesn't read the selected state of ancestors.
+    ASSERT_EQ(Leaf1UpdateCount(), 0);
     // Leaf2 won't update as it is outside the visible area.
     ASSERT_EQ(Leaf2UpdateCount(), 0); 
 }
@@ -187,7 +191,8 @@ TEST_F(ControlStyleTest, UpdateOnIsVisibleChange) {
     RepaintWindow();
     ASSERT_EQ(RootUpdateCount(), 0);
     ASSERT_EQ(StemUpdateCount(), 1);
-    ASSERT_EQ(Leaf1UpdateCount(), 1);
+    // Leaf1 won't update as its style doesn't read the visible state of ancestors.
+    ASSERT_EQ(Leaf1UpdateCount(), 0);
     // Leaf2 won't update as it is outside the visible area.
     ASSERT_EQ(Leaf2UpdateCount(), 0);
 }
@@ -200,7 +205,8 @@ TEST_F(ControlStyleTest, UpdateOnIsFocusedChange) {
 
     ASSERT_EQ(RootUpdateCount(), 1);
     ASSERT_EQ(StemUpdateCount(), 1);
-    ASSERT_EQ(Leaf1UpdateCount(), 1);
+    // Leaf1 won't update as its style doesn't read the focused state of ancestors.
+    ASSERT_EQ(Leaf1UpdateCount(), 0);
     // Leaf2 won't update as it is outside the visible area.
     ASSERT_EQ(Leaf2UpdateCount(), 0);
 }
@@ -237,6 +243,11 @@ TEST_F(ControlStyleTest, UpdateOnIsPressedChange) {
 
 TEST_F(ControlStyleTest, UpdateOnPositionChange) {
 
+    //Make leaf2 read the enabled state of ancestors, like leaf1 does.
+    Leaf2()->SetBackgroundColorPicker(ColorPicker([](const Control& control) {
+        return control.IsEnabledInContext() ? Color::White() : Color::Gray();
+    }));
+
     //At first, the control is outside the visible area, it won't update style.
     //Once it becomes visible, it should update style.
     Stem()->SetIsEnabled(false);
@@ -281,4 +292,121 @@ TEST_F(ControlStyleTest, NoExtraPaintWhenUpdatingStyle) {
 
     BOOL has_update_rect = GetUpdateRect(TestWindow()->Handle(), nullptr, FALSE);
     ASSERT_FALSE(has_update_rect);
+}
+
+
+TEST_F(ControlStyleTest, UpdateOnlyDependentChildren) {
+
+    auto new_control = Create<Control>();
+    new_control->SetRect(Rect{ 0, 0, 50, 50 });
+    new_control->SetBackgroundColorPicker(ColorPicker([](const Control& control) {
+        return control.IsSelectedInContext() ? Color::Blue() : Color::White();
+    }));
+
+    int new_control_update_count{};
+    Disposables() += new_control->StyleUpdateEvent().Subscribe(std::bind([&]() {
+        ++new_control_update_count;
+    }));
+
+    Stem()->AddChild(new_control);
+    RepaintWindow();
+    ASSERT_EQ(new_control_update_count, 1);
+
+    auto& statistics = internal::StyleDependencyTracker::Statistics();
+    auto old_skipped_count = statistics.skipped_count;
+
+    Stem()->SetIsSelected(true);
+    RepaintWindow();
+
+    ASSERT_EQ(StemUpdateCount(), 1);
+    ASSERT_EQ(new_control_update_count, 2);
+    ASSERT_EQ(new_control->BackgroundColor(), Color::Blue());
+
+    //Neither leaf1 nor leaf2 reads the selected state of ancestors.
+    ASSERT_EQ(Leaf1UpdateCount(), 0);
+    ASSERT_EQ(Leaf2UpdateCount(), 0);
+    ASSERT_EQ(statistics.skipped_count - old_skipped_count, 2);
+}
+
+
+TEST_F(ControlStyleTest, PassChangedInputsThroughUnaffectedChildren) {
+
+    auto grandchild = Create<Control>();
+    grandchild->SetRect(Rect{ 0, 0, 20, 20 });
+    grandchild->SetBackgroundColorPicker(ColorPicker([](const Control& control) {
+        return control.IsSelectedInContext() ? Color::Blue() : Color::White();
+    }));
+
+    //The child's style doesn't read any state of ancestors.
+    auto child = Create<Control>();
+    child->SetRect(Rect{ 0, 0, 50, 50 });
+    child->AddChild(grandchild);
+
+    int child_update_count{};
+    Disposables() += child->StyleUpdateEvent().Subscribe(std::bind([&]() {
+        ++child_update_count;
+    }));
+
+    int grandchild_update_count{};
+    Disposables() += grandchild->StyleUpdateEvent().Subscribe(std::bind([&]() {
+        ++grandchild_update_count;
+    }));
+
+    Stem()->AddChild(child);
+    RepaintWindow();
+    ASSERT_EQ(child_update_count, 1);
+    ASSERT_EQ(grandchild_update_count, 1);
+
+    Stem()->SetIsSelected(true);
+    RepaintWindow();
+    ASSERT_EQ(child_update_count, 1);
+    ASSERT_EQ(grandchild_update_count, 2);
+    ASSERT_EQ(grandchild->BackgroundColor(), Color::Blue());
+}
+
+
+TEST_F(ControlStyleTest, UpdateAllChildrenOnExplicitRequirement) {
+
+    Stem()->NeedUpdateStyle();
+    Stem()->NeedRepaint();
+    RepaintWindow();
+
+    ASSERT_EQ(RootUpdateCount(), 0);
+    ASSERT_EQ(StemUpdateCount(), 1);
+    ASSERT_EQ(Leaf1UpdateCount(), 1);
+    // Leaf2 won't update as it is outside the visible area.
+    ASSERT_EQ(Leaf2UpdateCount(), 0);
+}
+
+
+TEST_F(ControlStyleTest, DISABLED_Benchmark_SelectParentOf1000Buttons) {
+
+    std::vector<std::shared_ptr<Control>> buttons;
+    for (int index = 0; index < 1000; ++index) {
+        auto button = Create<Button>();
+        button->SetRect(Rect{ index % 10 * 10.f, index / 10 * 1.f, 10, 1 });
+        buttons.push_back(button);
+    }
+    Stem()->AddChildren(buttons);
+    RepaintWindow();
+
+    constexpr int repaint_count = 100;
+
+    auto& statistics = internal::StyleDependencyTracker::Statistics();
+    auto old_statistics = statistics;
+
+    auto begin_time = std::chrono::steady_clock::now();
+    for (int index = 0; index < repaint_count; ++index) {
+        Stem()->SetIsSelected(!Stem()->IsSelected());
+        RepaintWindow();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - begin_time;
+
+    std::printf(
+        "Toggle selection of parent %d times: %.3f ms, "
+        "style updates evaluated: %zu, skipped: %zu\n",
+        repaint_count,
+        std::chrono::duration<double, std::milli>(elapsed).count(),
+        statistics.evaluated_count - old_statistics.evaluated_count,
+        statistics.skipped_count - old_statistics.skipped_count);
 }
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <chrono>
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <zaf/application.h>
 #include <zaf/base/as.h>
@@ -775,4 +777,122 @@ TEST(ControlTest, BorderColor) {
 
     auto control = zaf::Create<zaf::Control>();
     ASSERT_EQ(control->BorderColor(), zaf::Color::Black());
+}
+
+
+TEST(ControlTest, FindChildAtPositionWithSpatialIndex) {
+
+    auto parent = zaf::Create<zaf::Control>();
+    parent->SetRect(zaf::Rect{ 0, 0, 200, 200 });
+    parent->SetPadding(zaf::Frame{ 5 });
+
+    for (int row = 0; row < 10; ++row) {
+        for (int column = 0; column < 10; ++column) {
+            auto child = zaf::Create<zaf::Control>();
+            child->SetRect(zaf::Rect{ column * 15.f, row * 15.f, 20, 20 });
+            parent->AddChild(child);
+        }
+    }
+
+    auto hidden_child = zaf::Create<zaf::Control>();
+    hidden_child->SetRect(zaf::Rect{ 0, 0, 200, 200 });
+    hidden_child->SetIsVisible(false);
+    parent->AddChild(hidden_child);
+
+    auto find_all_children = [&]() {
+        std::vector<std::shared_ptr<zaf::Control>> result;
+        for (float y = 0; y < 200; y += 2.5f) {
+            for (float x = 0; x < 200; x += 2.5f) {
+                result.push_back(parent->FindChildAtPosition(zaf::Point{ x, y }));
+            }
+        }
+        return result;
+    };
+
+    auto expected = find_all_children();
+
+    parent->SetIsSpatialIndexEnabled(true);
+    ASSERT_TRUE(parent->IsSpatialIndexEnabled());
+    ASSERT_EQ(find_all_children(), expected);
+
+    //Changing rects of children is applied to the index.
+    parent->Children()[0]->SetRect(zaf::Rect{ 100, 100, 50, 50 });
+    parent->Children()[99]->SetPosition(zaf::Point{ 0, 0 });
+    parent->SetIsSpatialIndexEnabled(false);
+    expected = find_all_children();
+    parent->SetIsSpatialIndexEnabled(true);
+    ASSERT_EQ(find_all_children(), expected);
+
+    parent->Children()[55]->SetRect(zaf::Rect{ 20, 30, 40, 50 });
+    auto indexed_result = find_all_children();
+    parent->SetIsSpatialIndexEnabled(false);
+    ASSERT_EQ(indexed_result, find_all_children());
+    parent->SetIsSpatialIndexEnabled(true);
+
+    //Adding and removing children are applied to the index.
+    auto top_child = zaf::Create<zaf::Control>();
+    top_child->SetRect(zaf::Rect{ 50, 50, 30, 30 });
+    parent->AddChild(top_child);
+    ASSERT_EQ(parent->FindChildAtPosition(zaf::Point{ 60, 60 }), top_child);
+
+    parent->RemoveChild(top_child);
+    ASSERT_NE(parent->FindChildAtPosition(zaf::Point{ 60, 60 }), top_child);
+    ASSERT_NE(parent->FindChildAtPosition(zaf::Point{ 60, 60 }), nullptr);
+
+    parent->RemoveAllChildren();
+    ASSERT_EQ(parent->FindChildAtPosition(zaf::Point{ 60, 60 }), nullptr);
+}
+
+
+TEST(ControlTest, DISABLED_Benchmark_FindChildAtPositionIn10000Children) {
+
+    auto parent = zaf::Create<zaf::Control>();
+    parent->SetRect(zaf::Rect{ 0, 0, 2000, 2000 });
+
+    for (int row = 0; row < 100; ++row) {
+        for (int column = 0; column < 100; ++column) {
+            auto child = zaf::Create<zaf::Control>();
+            child->SetRect(zaf::Rect{ column * 20.f, row * 20.f, 20, 20 });
+            parent->AddChild(child);
+        }
+    }
+
+    constexpr int find_count = 100'000;
+
+    for (bool is_spatial_index_enabled : { false, true }) {
+
+        parent->SetIsSpatialIndexEnabled(is_spatial_index_enabled);
+
+        //Build the index before timing.
+        parent->FindChildAtPosition(zaf::Point{});
+
+        std::size_t found_count{};
+        auto begin_time = std::chrono::steady_clock::now();
+        for (int index = 0; index < find_count; ++index) {
+            zaf::Point position{ (index * 7 % 2000) + 0.5f, (index * 13 % 2000) + 0.5f };
+            if (parent->FindChildAtPosition(position)) {
+                ++found_count;
+            }
+        }
+        auto elapsed = std::chrono::steady_clock::now() - begin_time;
+        ASSERT_EQ(found_count, find_count);
+
+        std::printf(
+            "Find child at position %d times, spatial index %s: %.3f ms\n",
+            find_count,
+            is_spatial_index_enabled ? "enabled" : "disabled",
+            std::chrono::duration<double, std::milli>(elapsed).count());
+    }
+
+    //Moving children one by one, as a layout pass does.
+    auto begin_time = std::chrono::steady_clock::now();
+    for (const auto& each_child : parent->Children()) {
+        auto position = each_child->Position();
+        each_child->SetPosition(zaf::Point{ position.x + 1, position.y + 1 });
+    }
+    auto elapsed = std::chrono::steady_clock::now() - begin_time;
+
+    std::printf(
+        "Move 10000 children with spatial index enabled: %.3f ms\n",
+        std::chrono::duration<double, std::milli>(elapsed).count());
 }
\ No newline at end of file
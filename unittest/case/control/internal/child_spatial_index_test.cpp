@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <zaf/control/control.h>
+#include <zaf/control/internal/child_spatial_index.h>
+#include <zaf/creation.h>
+
+using namespace zaf;
+using namespace zaf::internal;
+
+namespace {
+
+std::vector<std::shared_ptr<Control>> CreateTiles(std::size_t column_count, std::size_t row_count) {
+
+    std::vector<std::shared_ptr<Control>> result;
+    for (std::size_t row = 0; row < row_count; ++row) {
+        for (std::size_t column = 0; column < column_count; ++column) {
+
+            auto tile = Create<Control>();
+            tile->SetRect(Rect{ column * 10.f, row * 10.f, 10, 10 });
+            result.push_back(tile);
+        }
+    }
+    return result;
+}
+
+
+bool ContainsIndex(const std::vector<std::size_t>& indexes, std::size_t index) {
+    return std::find(indexes.begin(), indexes.end(), index) != indexes.end();
+}
+
+}
+
+TEST(ChildSpatialIndexTest, Rebuild) {
+
+    ChildSpatialIndex index;
+    ASSERT_FALSE(index.IsValid());
+
+    auto children = CreateTiles(10, 10);
+    index.Rebuild(children);
+    ASSERT_TRUE(index.IsValid());
+
+    index.Invalidate();
+    ASSERT_FALSE(index.IsValid());
+}
+
+
+TEST(ChildSpatialIndexTest, FindChildrenAtPosition) {
+
+    auto children = CreateTiles(10, 10);
+
+    ChildSpatialIndex index;
+    index.Rebuild(children);
+
+    for (float y = 0.5f; y < 100; y += 3) {
+        for (float x = 0.5f; x < 100; x += 3) {
+
+            auto candidates = index.FindChildrenAtPosition(Point{ x, y });
+            ASSERT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+            ASSERT_LT(candidates.size(), children.size());
+
+            for (std::size_t child_index = 0; child_index < children.size(); ++child_index) {
+                if (children[child_index]->Rect().Contains(Point{ x, y })) {
+                    ASSERT_TRUE(ContainsIndex(candidates, child_index));
+                }
+            }
+        }
+    }
+
+    //No child is at a position far away.
+    auto candidates = index.FindChildrenAtPosition(Point{ 10000, 10000 });
+    ASSERT_TRUE(candidates.empty());
+}
+
+
+TEST(ChildSpatialIndexTest, FindChildrenInRect) {
+
+    auto children = CreateTiles(10, 10);
+
+    ChildSpatialIndex index;
+    index.Rebuild(children);
+
+    Rect rect{ 25, 35, 20, 10 };
+    auto candidates = index.FindChildrenInRect(rect);
+    ASSERT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+    ASSERT_LT(candidates.size(), children.size());
+
+    for (std::size_t child_index = 0; child_index < children.size(); ++child_index) {
+        if (children[child_index]->Rect().HasIntersection(rect)) {
+            ASSERT_TRUE(ContainsIndex(candidates, child_index));
+        }
+    }
+
+    //All children are returned if the rect covers all of them.
+    candidates = index.FindChildrenInRect(Rect{ -100, -100, 1000, 1000 });
+    ASSERT_EQ(candidates.size(), children.size());
+}
+
+
+TEST(ChildSpatialIndexTest, UpdateChild) {
+
+    auto children = CreateTiles(10, 10);
+
+    ChildSpatialIndex index;
+    index.Rebuild(children);
+
+    //Move the first child to the bottom right corner.
+    children[0]->SetRect(Rect{ 500, 500, 10, 10 });
+    index.UpdateChild(*children[0]);
+
+    auto candidates = index.FindChildrenAtPosition(Point{ 505, 505 });
+    ASSERT_EQ(candidates, std::vector<std::size_t>{ 0 });
+
+    candidates = index.FindChildrenAtPosition(Point{ 5, 5 });
+    ASSERT_FALSE(ContainsIndex(candidates, 0));
+
+    //A child that is too large to be put into cells is always a candidate.
+    children[1]->SetRect(Rect{ 0, 0, 10000, 10000 });
+    index.UpdateChild(*children[1]);
+
+    candidates = index.FindChildrenAtPosition(Point{ 505, 505 });
+    ASSERT_EQ(candidates, (std::vector<std::size_t>{ 0, 1 }));
+
+    children[1]->SetRect(Rect{ 10, 0, 10, 10 });
+    index.UpdateChild(*children[1]);
+
+    candidates = index.FindChildrenAtPosition(Point{ 505, 505 });
+    ASSERT_EQ(candidates, std::vector<std::size_t>{ 0 });
+}
\ No newline at end of file
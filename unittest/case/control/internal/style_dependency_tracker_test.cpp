@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <zaf/control/control.h>
+#include <zaf/control/internal/style_dependency_tracker.h>
+#include <zaf/creation.h>
+
+using namespace zaf;
+using namespace zaf::internal;
+
+TEST(StyleDependencyTrackerTest, RecordReadsOfOtherControls) {
+
+    auto parent = Create<Control>();
+    auto child = Create<Control>();
+    parent->AddChild(child);
+
+    StyleDependencyTracker tracker{ *child };
+    ASSERT_EQ(tracker.Dependencies(), StyleInput::None);
+
+    //Reads of the tracked control's own states are ignored.
+    child->IsSelected();
+    child->IsMouseOver();
+    ASSERT_EQ(tracker.Dependencies(), StyleInput::None);
+
+    //Reading states in context reads states of the parent.
+    child->IsEnabledInContext();
+    ASSERT_EQ(tracker.Dependencies(), StyleInput::IsEnabled);
+
+    child->IsSelectedInContext();
+    ASSERT_EQ(tracker.Dependencies(), StyleInput::IsEnabled | StyleInput::IsSelected);
+
+    parent->IsFocused();
+    ASSERT_EQ(
+        tracker.Dependencies(),
+        StyleInput::IsEnabled | StyleInput::IsSelected | StyleInput::IsFocused);
+}
+
+
+TEST(StyleDependencyTrackerTest, IgnoreReadsOutsideTracker) {
+
+    auto parent = Create<Control>();
+    auto child = Create<Control>();
+    parent->AddChild(child);
+
+    parent->IsEnabled();
+
+    StyleDependencyTracker tracker{ *child };
+    ASSERT_EQ(tracker.Dependencies(), StyleInput::None);
+}
+
+
+TEST(StyleDependencyTrackerTest, NestedTrackers) {
+
+    auto control1 = Create<Control>();
+    auto control2 = Create<Control>();
+
+    StyleDependencyTracker tracker1{ *control1 };
+    {
+        StyleDependencyTracker tracker2{ *control2 };
+        control1->IsVisible();
+        ASSERT_EQ(tracker2.Dependencies(), StyleInput::IsVisible);
+    }
+
+    //Reads are recorded to the outer tracker once the inner one is destroyed.
+    ASSERT_EQ(tracker1.Dependencies(), StyleInput::None);
+    control2->IsMouseOver();
+    ASSERT_EQ(tracker1.Dependencies(), StyleInput::IsMouseOver);
+}
\ No newline at end of file
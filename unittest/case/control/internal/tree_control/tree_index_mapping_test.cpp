@@ -1,9 +1,134 @@
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
 #include <gtest/gtest.h>
 #include <zaf/base/range.h>
 #include <zaf/internal/tree/tree_index_mapping.h>
 
 using namespace zaf::internal;
 
+namespace {
+
+void AssignNodes(
+    TreeIndexMapping& mapping,
+    const std::vector<std::pair<zaf::IndexPath, std::size_t>>& node_child_count_pairs) {
+
+    //Nodes are in pre-order, so parent of each node has been added before it.
+    mapping.Clear();
+    for (const auto& each_pair : node_child_count_pairs) {
+        mapping.AddChildren(each_pair.first, 0, each_pair.second);
+    }
+}
+
+
+//A naive tree used to verify TreeIndexMapping, a null child is a collapsed node.
+class ModelNode {
+public:
+    std::vector<std::unique_ptr<ModelNode>> children;
+};
+
+
+ModelNode* FindModelNode(ModelNode& root, const zaf::IndexPath& path) {
+
+    auto node = &root;
+    for (auto each_index : path) {
+        node = node->children[each_index].get();
+    }
+    return node;
+}
+
+
+std::size_t GetModelVisibleCount(const ModelNode& node) {
+
+    std::size_t result = node.children.size();
+    for (const auto& each_child : node.children) {
+        if (each_child) {
+            result += GetModelVisibleCount(*each_child);
+        }
+    }
+    return result;
+}
+
+
+void GetModelVisiblePaths(
+    const ModelNode& node,
+    zaf::IndexPath& path,
+    std::vector<zaf::IndexPath>& result) {
+
+    for (auto index : zaf::Range(0, node.children.size())) {
+
+        path.push_back(index);
+        result.push_back(path);
+        if (node.children[index]) {
+            GetModelVisiblePaths(*node.children[index], path, result);
+        }
+        path.pop_back();
+    }
+}
+
+
+void GetModelNodeChildCountPairs(
+    const ModelNode& node,
+    zaf::IndexPath& path,
+    std::vector<std::pair<zaf::IndexPath, std::size_t>>& result) {
+
+    result.emplace_back(path, node.children.size());
+
+    for (auto index : zaf::Range(0, node.children.size())) {
+        if (node.children[index]) {
+            path.push_back(index);
+            GetModelNodeChildCountPairs(*node.children[index], path, result);
+            path.pop_back();
+        }
+    }
+}
+
+
+bool CheckMapping(const TreeIndexMapping& mapping, ModelNode& model) {
+
+    zaf::IndexPath path;
+    std::vector<zaf::IndexPath> visible_paths;
+    GetModelVisiblePaths(model, path, visible_paths);
+
+    if (mapping.GetNodeCount() != visible_paths.size()) {
+        return false;
+    }
+
+    for (auto index : zaf::Range(0, visible_paths.size())) {
+
+        const auto& visible_path = visible_paths[index];
+        if (mapping.GetIndexPathAtIndex(index) != visible_path) {
+            return false;
+        }
+
+        if (mapping.GetIndexAtIndexPath(visible_path) != index) {
+            return false;
+        }
+
+        auto node = FindModelNode(model, visible_path);
+        auto child_count = mapping.GetChildCount(visible_path);
+        auto recursive_child_count = mapping.GetChildCountRecursively(visible_path);
+        if (node) {
+            if (child_count != node->children.size() ||
+                recursive_child_count != GetModelVisibleCount(*node)) {
+                return false;
+            }
+        }
+        else if (child_count || recursive_child_count) {
+            return false;
+        }
+    }
+
+    std::vector<std::pair<zaf::IndexPath, std::size_t>> expected_pairs;
+    if (!model.children.empty()) {
+        GetModelNodeChildCountPairs(model, path, expected_pairs);
+    }
+    return mapping.GetNodeChildCountPairs() == expected_pairs;
+}
+
+}
+
 class NodeInfo {
 public:
     std::size_t global_index{};
@@ -14,7 +139,7 @@ class TreeIndexMappingTest : public testing::Test {
 protected:
     void SetUp() override {
 
-        mapping_.node_child_count_pairs.assign({
+        AssignNodes(mapping_, {
             { {},             7 },
             { { 1 },          5 },
             { { 1, 2 },       1 },
@@ -88,7 +213,7 @@ TEST_F(TreeIndexMappingTest, GetIndexPathAtIndexOnSingleLevelTree) {
     const std::size_t node_count = 3;
 
     TreeIndexMapping mapping;
-    mapping.node_child_count_pairs.push_back(std::make_pair(zaf::IndexPath{}, node_count));
+    mapping.AddChildren({}, 0, node_count);
 
     for (auto index : zaf::Range(0, node_count)) {
 
@@ -123,7 +248,7 @@ TEST_F(TreeIndexMappingTest, GetIndexAtIndexPathOnSingleLevelTree) {
     const std::size_t node_count = 3;
 
     TreeIndexMapping mapping;
-    mapping.node_child_count_pairs.push_back(std::make_pair(zaf::IndexPath{}, node_count));
+    mapping.AddChildren({}, 0, node_count);
 
     for (auto index : zaf::Range(0, node_count)) {
 
@@ -149,14 +274,14 @@ TEST_F(TreeIndexMappingTest, AddChildren) {
         { { 2 }, 3 },
         { { 2, 0 }, 1 },
     };
-    ASSERT_EQ(expected, mapping.node_child_count_pairs);
+    ASSERT_EQ(expected, mapping.GetNodeChildCountPairs());
 }
 
 
 TEST_F(TreeIndexMappingTest, RemoveChildren) {
 
     TreeIndexMapping mapping;
-    mapping.node_child_count_pairs.assign({
+    AssignNodes(mapping, {
         { {}, 3 },
         { { 1 }, 3 },
         { { 1, 1 }, 2 },
@@ -168,28 +293,28 @@ TEST_F(TreeIndexMappingTest, RemoveChildren) {
         { { 1 }, 3 },
         { { 1, 1 }, 1 },
     };
-    ASSERT_EQ(expected, mapping.node_child_count_pairs);
+    ASSERT_EQ(expected, mapping.GetNodeChildCountPairs());
 
     mapping.RemoveChildren({ 1, 1 }, 0, 1);
     expected.assign({
         { {}, 3 },
         { { 1 }, 3 },
     });
-    ASSERT_EQ(expected, mapping.node_child_count_pairs);
+    ASSERT_EQ(expected, mapping.GetNodeChildCountPairs());
 
     mapping.RemoveChildren({}, 0, 1);
     expected.assign({
         { {}, 2 },
         { { 0 }, 3 },
     });
-    ASSERT_EQ(expected, mapping.node_child_count_pairs);
+    ASSERT_EQ(expected, mapping.GetNodeChildCountPairs());
 }
 
 
 TEST_F(TreeIndexMappingTest, RemoveChildrenRecursively) {
 
     TreeIndexMapping mapping;
-    mapping.node_child_count_pairs.assign({
+    AssignNodes(mapping, {
         { {}, 3 },
         { { 1 }, 3 },
         { { 1, 1 }, 2 },
@@ -199,6 +324,166 @@ TEST_F(TreeIndexMappingTest, RemoveChildrenRecursively) {
     std::vector<std::pair<zaf::IndexPath, std::size_t>> expected{
         { {}, 3 },
     };
-    ASSERT_EQ(expected, mapping.node_child_count_pairs);
+    ASSERT_EQ(expected, mapping.GetNodeChildCountPairs());
     ASSERT_EQ(remove_count, 5);
+}
+
+
+TEST_F(TreeIndexMappingTest, RandomModify) {
+
+    std::mt19937 random_engine{ 7 };
+    auto random = [&](std::size_t max) {
+        return std::uniform_int_distribution<std::size_t>{ 0, max }(random_engine);
+    };
+
+    TreeIndexMapping mapping;
+    ModelNode model;
+
+    for (int operation = 0; operation < 500; ++operation) {
+
+        //Choose the root or a visible node randomly.
+        zaf::IndexPath parent;
+        auto node_count = mapping.GetNodeCount();
+        if (node_count > 0 && random(4) != 0) {
+            parent = mapping.GetIndexPathAtIndex(random(node_count - 1));
+        }
+
+        auto node = FindModelNode(model, parent);
+        auto child_count = node ? node->children.size() : 0;
+
+        switch (random(3)) {
+        case 0:
+        case 1: {
+            //Expand a collapsed node, or add children to an expanded node.
+            auto index = random(child_count);
+            auto count = random(4) + 1;
+            mapping.AddChildren(parent, index, count);
+
+            if (!node) {
+                auto grand_parent = parent;
+                grand_parent.pop_back();
+                auto& child = FindModelNode(model, grand_parent)->children[parent.back()];
+                child = std::make_unique<ModelNode>();
+                node = child.get();
+                index = 0;
+            }
+            //Added children are all collapsed.
+            for (auto added_index : zaf::Range(index, count)) {
+                node->children.insert(node->children.begin() + added_index, nullptr);
+            }
+            break;
+        }
+        case 2: {
+            if (child_count == 0) {
+                break;
+            }
+            auto index = random(child_count - 1);
+            auto count = random(child_count - index - 1) + 1;
+
+            auto expected_count = count;
+            for (auto child_index : zaf::Range(index, count)) {
+                if (node->children[child_index]) {
+                    expected_count += GetModelVisibleCount(*node->children[child_index]);
+                }
+            }
+
+            auto remove_count = mapping.RemoveChildren(parent, index, count);
+            ASSERT_EQ(remove_count, expected_count);
+
+            node->children.erase(
+                node->children.begin() + index,
+                node->children.begin() + index + count);
+
+            //Collapse the node if there is no child.
+            if (node->children.empty() && !parent.empty()) {
+                auto grand_parent = parent;
+                grand_parent.pop_back();
+                FindModelNode(model, grand_parent)->children[parent.back()].reset();
+            }
+            break;
+        }
+        default: {
+            auto expected_count = node ? GetModelVisibleCount(*node) : 0;
+            auto remove_count = mapping.RemoveAllChildrenRecursively(parent);
+            ASSERT_EQ(remove_count, expected_count);
+
+            if (parent.empty()) {
+                model.children.clear();
+            }
+            else {
+                auto grand_parent = parent;
+                grand_parent.pop_back();
+                FindModelNode(model, grand_parent)->children[parent.back()].reset();
+            }
+            break;
+        }
+        }
+
+        ASSERT_TRUE(CheckMapping(mapping, model));
+    }
+}
+
+
+TEST_F(TreeIndexMappingTest, DISABLED_Benchmark_FullyExpanded1000000Nodes) {
+
+    //A fully expanded tree with 3 levels, each node has 100 children.
+    constexpr std::size_t fanout = 100;
+    constexpr std::size_t lookup_count = 100'000;
+
+    TreeIndexMapping mapping;
+    mapping.AddChildren({}, 0, fanout);
+    for (auto index1 : zaf::Range(0, fanout)) {
+        mapping.AddChildren({ index1 }, 0, fanout);
+        for (auto index2 : zaf::Range(0, fanout)) {
+            mapping.AddChildren({ index1, index2 }, 0, fanout);
+        }
+    }
+
+    auto node_count = mapping.GetNodeCount();
+    ASSERT_EQ(node_count, fanout + fanout * fanout + fanout * fanout * fanout);
+
+    auto measure = [](std::size_t count, const auto& action) {
+
+        auto begin = std::chrono::steady_clock::now();
+        for (auto index : zaf::Range(0, count)) {
+            action(index);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+            std::chrono::steady_clock::now() - begin);
+        return elapsed.count() / count;
+    };
+
+    std::size_t checksum{};
+
+    auto index_to_path_cost = measure(lookup_count, [&](std::size_t index) {
+        auto path = mapping.GetIndexPathAtIndex(index * 7919 % node_count);
+        checksum += path.back();
+    });
+
+    auto path_to_index_cost = measure(lookup_count, [&](std::size_t index) {
+        auto list_index = mapping.GetIndexAtIndexPath({
+            index % fanout,
+            index / fanout % fanout,
+            index * 7919 % fanout
+        });
+        checksum += *list_index;
+    });
+
+    //Collapse and expand nodes in the middle of the tree.
+    auto collapse_expand_cost = measure(lookup_count, [&](std::size_t index) {
+        zaf::IndexPath path{ fanout / 2, index % fanout, index * 7919 % fanout };
+        mapping.RemoveAllChildrenRecursively(path);
+        mapping.AddChildren(path, 0, 1);
+        mapping.RemoveAllChildrenRecursively(path);
+    });
+
+    std::printf(
+        "Index to path: %.3f us\n"
+        "Path to index: %.3f us\n"
+        "Collapse and expand: %.3f us\n"
+        "Checksum: %zu\n",
+        index_to_path_cost,
+        path_to_index_cost,
+        collapse_expand_cost,
+        checksum);
 }
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <zaf/control/list_control.h>
+#include <zaf/control/list_control_delegate.h>
+#include <zaf/control/list_data_source.h>
+#include <zaf/control/list_item_container.h>
+
+using namespace zaf;
+
+namespace {
+
+class DataSource : public ListDataSource {
+public:
+    std::size_t GetDataCount() const override {
+        return 100;
+    }
+
+    std::shared_ptr<Object> GetDataAtIndex(std::size_t index) const override {
+        return Box(static_cast<std::int32_t>(index));
+    }
+};
+
+
+class Delegate : public ListControlDelegate {
+public:
+    bool HasVariableItemHeight() override {
+        return true;
+    }
+
+    bool HasLazyItemHeight() override {
+        return true;
+    }
+
+    float GetDefaultItemHeight() override {
+        return 10;
+    }
+
+    float EstimateItemHeight(
+        std::size_t item_index,
+        const std::shared_ptr<Object>& item_data) override {
+
+        //Items at the beginning have the default height, so that they don't affect positions of
+        //other items after being measured.
+        return item_index < 40 ? 10.f : 30.f;
+    }
+};
+
+}
+
+/*
+Items above the visible area are measured when scrolling, which makes the list adjust the scroll
+position to keep the first visible item in place, and thus the visible items are updated again
+while they are being updated.
+*/
+TEST(ListControlLazyItemHeightTest, MeasureItemsAboveVisibleArea) {
+
+    auto data_source = Create<DataSource>();
+    auto delegate = Create<Delegate>();
+
+    auto list = Create<ListControl>();
+    list->SetSize(Size{ 100, 100 });
+    list->SetBorder({});
+    list->SetPadding({});
+    list->SetDataSource(data_source);
+    list->SetDelegate(delegate);
+
+    list->ScrollToScrollContentPosition(Point{ 0, 500 });
+
+    //Item 48 and 49 above the first visible item are measured, so item 50 is moved down.
+    ASSERT_EQ(list->GetVisibleScrollContentRect().position.y, 540);
+
+    //Visible items are contiguous and have no duplication.
+    ASSERT_EQ(list->GetVisibleItemAtIndex(47), nullptr);
+
+    std::size_t visible_item_count{};
+    while (auto item = list->GetVisibleItemAtIndex(48 + visible_item_count)) {
+
+        auto expected_value = static_cast<std::int32_t>(48 + visible_item_count);
+        ASSERT_EQ(As<Int32>(item->ItemData())->Value(), expected_value);
+        ASSERT_EQ(item->Position().y, 480.f + visible_item_count * 30);
+        ++visible_item_count;
+    }
+
+    ASSERT_NE(visible_item_count, 0);
+    ASSERT_EQ(list->ItemContainer()->Children().size(), visible_item_count);
+}
\ No newline at end of file
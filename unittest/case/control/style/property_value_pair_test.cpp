@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <zaf/control/control.h>
+#include <zaf/control/control_object.h>
+#include <zaf/control/label.h>
+#include <zaf/control/style/property_value_pair.h>
+#include <zaf/creation.h>
+
+using namespace zaf;
+
+TEST(PropertyValuePairTest, NotParsedData) {
+
+    PropertyValuePair pair{ L"Text", L"PairText" };
+    ASSERT_EQ(pair.PropertyName(), L"Text");
+
+    //The value is parsed for the first object, and is reused for other objects of the same type.
+    for (int count = 0; count < 2; ++count) {
+
+        auto label = Create<Label>();
+        ASSERT_FALSE(pair.IsSetIn(*label));
+
+        pair.SetTo(*label);
+        ASSERT_EQ(label->Text(), L"PairText");
+        ASSERT_TRUE(pair.IsSetIn(*label));
+
+        label->SetText(L"Other");
+        ASSERT_FALSE(pair.IsSetIn(*label));
+    }
+
+    //Types that don't have the property are not affected.
+    auto control = Create<Control>();
+    ASSERT_FALSE(pair.IsSetIn(*control));
+    ASSERT_NO_THROW(pair.SetTo(*control));
+    ASSERT_FALSE(pair.IsSetIn(*control));
+
+    //Copies of the pair work the same.
+    auto copied_pair = pair;
+    auto label = Create<Label>();
+    copied_pair.SetTo(*label);
+    ASSERT_EQ(label->Text(), L"PairText");
+    ASSERT_TRUE(pair.IsSetIn(*label));
+}
+
+
+TEST(PropertyValuePairTest, NotParsedDataForDifferentTypes) {
+
+    PropertyValuePair pair{ L"IsEnabled", L"false" };
+
+    auto control = Create<Control>();
+    pair.SetTo(*control);
+    ASSERT_FALSE(control->IsEnabled());
+    ASSERT_TRUE(pair.IsSetIn(*control));
+
+    auto label = Create<Label>();
+    pair.SetTo(*label);
+    ASSERT_FALSE(label->IsEnabled());
+    ASSERT_TRUE(pair.IsSetIn(*label));
+
+    label->SetIsEnabled(true);
+    ASSERT_FALSE(pair.IsSetIn(*label));
+    ASSERT_TRUE(pair.IsSetIn(*control));
+}
\ No newline at end of file
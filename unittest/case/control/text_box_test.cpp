@@ -130,18 +130,15 @@ TEST(TextBoxTest, UndoRedo) {
         ASSERT_TRUE(text_box.Redo());
         ASSERT_EQ(text_box.Text(), L"1");
 
+        //Typing after redo is not coalesced.
         window.Messager().Send(WM_CHAR, L'2', 0);
         window.Messager().Send(WM_CHAR, L'3', 0);
-        window.Messager().Send(WM_CHAR, L'4', 0);
+        text_box.Input(L"4");
         ASSERT_TRUE(text_box.Undo());
         ASSERT_EQ(text_box.Text(), L"123");
         ASSERT_TRUE(text_box.Undo());
-        ASSERT_EQ(text_box.Text(), L"12");
-        ASSERT_TRUE(text_box.Undo());
         ASSERT_EQ(text_box.Text(), L"1");
 
-        ASSERT_TRUE(text_box.Redo());
-        ASSERT_EQ(text_box.Text(), L"12");
         ASSERT_TRUE(text_box.Redo());
         ASSERT_EQ(text_box.Text(), L"123");
         ASSERT_TRUE(text_box.Redo());
@@ -150,6 +147,153 @@ TEST(TextBoxTest, UndoRedo) {
 }
 
 
+TEST(TextBoxTest, UndoRedo_Coalescing) {
+
+    TestWithTextBoxInWindow([](zaf::TextBox& text_box, zaf::Window& window) {
+
+        //Consecutive typing.
+        window.Messager().Send(WM_CHAR, L'a', 0);
+        window.Messager().Send(WM_CHAR, L'b', 0);
+        window.Messager().Send(WM_CHAR, L'c', 0);
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().undo_count, 1);
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().coalesced_count, 2);
+
+        //Typing at another position is not coalesced.
+        text_box.SetSelectionRange(Range{ 1, 0 });
+        window.Messager().Send(WM_CHAR, L'x', 0);
+        ASSERT_EQ(text_box.Text(), L"axbc");
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().undo_count, 2);
+
+        //Consecutive backspacing.
+        text_box.SetSelectionRange(Range{ 4, 0 });
+        window.Messager().SendWMKEYDOWN(Key::Backspace);
+        window.Messager().SendWMKEYDOWN(Key::Backspace);
+        ASSERT_EQ(text_box.Text(), L"ax");
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().undo_count, 3);
+
+        //Consecutive deleting.
+        text_box.SetSelectionRange(Range{ 0, 0 });
+        window.Messager().SendWMKEYDOWN(Key::Delete);
+        window.Messager().SendWMKEYDOWN(Key::Delete);
+        ASSERT_EQ(text_box.Text(), L"");
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().undo_count, 4);
+
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"ax");
+        ASSERT_EQ(text_box.SelectionRange(), Range(0, 0));
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"axbc");
+        ASSERT_EQ(text_box.SelectionRange(), Range(4, 0));
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"abc");
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"");
+        ASSERT_FALSE(text_box.CanUndo());
+
+        ASSERT_TRUE(text_box.Redo());
+        ASSERT_EQ(text_box.Text(), L"abc");
+        ASSERT_TRUE(text_box.Redo());
+        ASSERT_TRUE(text_box.Redo());
+        ASSERT_EQ(text_box.Text(), L"ax");
+        ASSERT_TRUE(text_box.Redo());
+        ASSERT_EQ(text_box.Text(), L"");
+    });
+}
+
+
+TEST(TextBoxTest, UndoRedo_CoalescingBoundaries) {
+
+    //Typing is coalesced word by word.
+    TestWithTextBoxInWindow([](zaf::TextBox& text_box, zaf::Window& window) {
+
+        for (auto ch : std::wstring{ L"ab  cd" }) {
+            window.Messager().Send(WM_CHAR, ch, 0);
+        }
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().undo_count, 2);
+
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"ab  ");
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"");
+    });
+
+    //Backspacing is coalesced word by word.
+    TestWithTextBoxInWindow([](zaf::TextBox& text_box, zaf::Window& window) {
+
+        text_box.SetText(L"ab cd");
+        text_box.SetSelectionRange(Range{ 5, 0 });
+        for (int count = 0; count < 5; ++count) {
+            window.Messager().SendWMKEYDOWN(Key::Backspace);
+        }
+        ASSERT_EQ(text_box.Text(), L"");
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().undo_count, 2);
+
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"ab ");
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"ab cd");
+    });
+
+    //Deleting is not coalesced across line breaks.
+    TestWithTextBoxInWindow([](zaf::TextBox& text_box, zaf::Window& window) {
+
+        text_box.SetIsMultiline(true);
+        text_box.SetText(L"ab\r\ncd");
+        text_box.SetSelectionRange(Range{ 0, 0 });
+        for (int count = 0; count < 5; ++count) {
+            window.Messager().SendWMKEYDOWN(Key::Delete);
+        }
+        ASSERT_EQ(text_box.Text(), L"");
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().undo_count, 3);
+
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"cd");
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"\r\ncd");
+        ASSERT_TRUE(text_box.Undo());
+        ASSERT_EQ(text_box.Text(), L"ab\r\ncd");
+    });
+}
+
+
+TEST(TextBoxTest, UndoHistoryMemoryLimit) {
+
+    TestWithTextBoxInWindow([](zaf::TextBox& text_box, zaf::Window& window) {
+
+        ASSERT_EQ(text_box.UndoHistoryMemoryLimit(), 16 * 1024 * 1024);
+
+        text_box.Input(std::wstring(1000, L'a'));
+        text_box.Input(std::wstring(1000, L'b'));
+        text_box.Undo();
+        text_box.Undo();
+        text_box.Redo();
+
+        auto statistics = text_box.GetUndoHistoryStatistics();
+        ASSERT_EQ(statistics.undo_count, 1);
+        ASSERT_EQ(statistics.redo_count, 1);
+        ASSERT_GT(statistics.memory_usage, 1000 * sizeof(wchar_t));
+
+        //The oldest operation is dropped first.
+        text_box.SetUndoHistoryMemoryLimit(statistics.memory_usage - 1);
+        statistics = text_box.GetUndoHistoryStatistics();
+        ASSERT_EQ(statistics.undo_count, 0);
+        ASSERT_EQ(statistics.redo_count, 1);
+        ASSERT_EQ(statistics.dropped_count, 1);
+        ASSERT_LE(statistics.memory_usage, statistics.memory_limit);
+
+        ASSERT_TRUE(text_box.Redo());
+        ASSERT_EQ(text_box.Text(), std::wstring(1000, L'a') + std::wstring(1000, L'b'));
+
+        //An operation exceeding the limit is not recorded.
+        text_box.SetUndoHistoryMemoryLimit(100);
+        ASSERT_FALSE(text_box.CanUndo());
+        text_box.Input(std::wstring(1000, L'c'));
+        ASSERT_FALSE(text_box.CanUndo());
+        ASSERT_EQ(text_box.GetUndoHistoryStatistics().memory_usage, 0);
+    });
+}
+
+
 TEST(TextBoxTest, UndoRedo_Selection) {
 
     TestWithTextBoxInWindow([](zaf::TextBox& text_box, zaf::Window& window) {
@@ -159,6 +159,34 @@ TEST(StyledTextTest, AppendText) {
 }
 
 
+TEST(StyledTextTest, TextChunks) {
+
+    auto join_chunks = [](const StyledText& styled_text, const Range& range) {
+        std::wstring result;
+        for (auto each_chunk : styled_text.TextChunks(range)) {
+            result.append(each_chunk);
+        }
+        return result;
+    };
+
+    StyledText styled_text(L"0123456789");
+    styled_text.SetTextInRange(L"abc", Range{ 5, 0 });
+    styled_text.SetTextInRange(L"", Range{ 1, 2 });
+    ASSERT_EQ(join_chunks(styled_text, Range{ 0, 100 }), L"034abc56789");
+    ASSERT_EQ(join_chunks(styled_text, Range{ 2, 5 }), L"4abc5");
+    ASSERT_EQ(join_chunks(styled_text, Range{ 11, 0 }), L"");
+    ASSERT_EQ(styled_text.Text(), L"034abc56789");
+
+    //Chunks of a cloned styled text are not affected by modifications to the source.
+    auto cloned = styled_text.Clone();
+    styled_text.SetTextInRange(L"!", Range{ 0, 11 });
+    ASSERT_EQ(join_chunks(cloned, Range{ 0, 100 }), L"034abc56789");
+    ASSERT_EQ(styled_text.Text(), L"!");
+
+    ASSERT_THROW(styled_text.TextChunks(Range{ 2, 0 }), PreconditionError);
+}
+
+
 TEST(StyledTextTest, SetStyledTextInRange_Precondition) {
 
     StyledText slice;
@@ -49,6 +49,14 @@ TEST(StyledTextViewTest, Text) {
     ASSERT_TRUE(test(L"0123456789", { 0, 1 }, L"0"));
     ASSERT_TRUE(test(L"0123456789", { 3, 3 }, L"345"));
     ASSERT_TRUE(test(L"0123456789", { 7, 5 }, L"789"));
+
+    //Text that is stored in multiple pieces.
+    StyledText styled_text{ L"0123456789" };
+    styled_text.SetTextInRange(L"abc", Range{ 5, 0 });
+    ASSERT_EQ(StyledTextView(styled_text, { 1, 3 }).Text(), L"123");
+    ASSERT_EQ(StyledTextView(styled_text, { 5, 3 }).Text(), L"abc");
+    ASSERT_EQ(StyledTextView(styled_text, { 3, 7 }).Text(), L"34abc56");
+    ASSERT_EQ(StyledTextView(styled_text, { 0, 100 }).Text(), L"01234abc56789");
 }
 
 
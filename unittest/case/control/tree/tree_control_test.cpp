@@ -3,6 +3,7 @@
 #include <zaf/control/tree_control.h>
 #include <zaf/control/tree_control_delegate.h>
 #include <zaf/control/tree_data_source.h>
+#include <zaf/rx/subject/subject.h>
 
 using namespace zaf;
 
@@ -59,4 +60,74 @@ TEST(TreeControlTest, SelfReference) {
     std::weak_ptr<None> life = list->life;
     list.reset();
     ASSERT_TRUE(life.expired());
+}
+
+
+TEST(TreeControlTest, LoadChildDataAsync) {
+
+    class AsyncDataSource : public TreeDataSource {
+    public:
+        bool DoesDataHasChildren(const std::shared_ptr<Object>& data) override {
+            return data == parent;
+        }
+
+        std::size_t GetChildDataCount(const std::shared_ptr<Object>& parent_data) override {
+            return parent_data ? 0 : 1;
+        }
+
+        std::shared_ptr<Object> GetChildDataAtIndex(
+            const std::shared_ptr<Object>& parent_data,
+            std::size_t index) override {
+
+            return parent;
+        }
+
+        bool ShouldLoadChildDataAsync(const std::shared_ptr<Object>& parent_data) override {
+            return parent_data == parent;
+        }
+
+        rx::Observable<std::vector<std::shared_ptr<Object>>> LoadChildDataAsync(
+            const std::shared_ptr<Object>& parent_data) override {
+
+            return page_subject.AsObservable().Finally([this]() {
+                ++finished_count;
+            });
+        }
+
+        std::shared_ptr<Object> parent = Create<Object>();
+        rx::Subject<std::vector<std::shared_ptr<Object>>> page_subject;
+        int finished_count{};
+    };
+
+    auto data_source = std::make_shared<AsyncDataSource>();
+    auto tree = Create<TreeControl>();
+    tree->SetDataSource(data_source);
+    tree->ExpandItem(data_source->parent);
+
+    //Children are added as soon as pages are emitted.
+    auto child1 = Create<Object>();
+    auto child2 = Create<Object>();
+    auto child3 = Create<Object>();
+    data_source->page_subject.AsObserver().OnNext({ child1, child2 });
+    tree->SelectItem(child2);
+    ASSERT_EQ(tree->GetFirstSelectedItem(), child2);
+
+    data_source->page_subject.AsObserver().OnNext({ child3 });
+    tree->SelectItem(child3);
+    ASSERT_EQ(tree->GetFirstSelectedItem(), child3);
+
+    //Loading is cancelled after collapsing.
+    tree->CollapseItem(data_source->parent);
+    ASSERT_EQ(data_source->finished_count, 1);
+    tree->SelectItem(child1);
+    ASSERT_EQ(tree->GetFirstSelectedItem(), nullptr);
+
+    //Children are loaded again after expanding.
+    tree->ExpandItem(data_source->parent);
+    tree->SelectItem(child1);
+    ASSERT_EQ(tree->GetFirstSelectedItem(), nullptr);
+
+    data_source->page_subject.AsObserver().OnNext({ child1 });
+    tree->SelectItem(child1);
+    ASSERT_EQ(tree->GetFirstSelectedItem(), child1);
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <zaf/internal/graphic/dirty_region.h>
+
+using namespace zaf;
+using namespace zaf::internal;
+
+namespace {
+
+float TotalArea(const DirtyRegion& region) {
+    float result{};
+    for (const auto& each_rect : region.Rects()) {
+        result += each_rect.size.width * each_rect.size.height;
+    }
+    return result;
+}
+
+
+bool IsDisjoint(const DirtyRegion& region) {
+
+    const auto& rects = region.Rects();
+    for (std::size_t index1 = 0; index1 < rects.size(); ++index1) {
+        for (std::size_t index2 = index1 + 1; index2 < rects.size(); ++index2) {
+            if (rects[index1].HasIntersection(rects[index2])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+bool IsCovered(const DirtyRegion& region, const Point& point) {
+
+    for (const auto& each_rect : region.Rects()) {
+        if (each_rect.Contains(point)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+TEST(DirtyRegionTest, IgnoreEmptyRect) {
+
+    DirtyRegion region;
+    ASSERT_TRUE(region.IsEmpty());
+
+    region.Add(Rect{ 10, 10, 0, 10 });
+    region.Add(Rect{ 10, 10, 10, 0 });
+    region.Add(Rect{ 10, 10, -5, 10 });
+    ASSERT_TRUE(region.IsEmpty());
+    ASSERT_EQ(region.Bounds(), Rect{});
+}
+
+
+TEST(DirtyRegionTest, KeepDistantRectsSeparate) {
+
+    //Such as two carets at opposite corners.
+    DirtyRegion region;
+    region.Add(Rect{ 0, 0, 1, 20 });
+    region.Add(Rect{ 999, 980, 1, 20 });
+
+    ASSERT_EQ(region.Rects().size(), 2);
+    ASSERT_EQ(TotalArea(region), 40);
+    ASSERT_EQ(region.Bounds(), Rect(0, 0, 1000, 1000));
+
+    region.Clear();
+    ASSERT_TRUE(region.IsEmpty());
+}
+
+
+TEST(DirtyRegionTest, MergeWhenSavingArea) {
+
+    //Contained rect.
+    {
+        DirtyRegion region;
+        region.Add(Rect{ 0, 0, 100, 100 });
+        region.Add(Rect{ 10, 10, 20, 20 });
+        ASSERT_EQ(region.Rects(), std::vector<Rect>{ Rect(0, 0, 100, 100) });
+    }
+
+    //Containing rect.
+    {
+        DirtyRegion region;
+        region.Add(Rect{ 10, 10, 20, 20 });
+        region.Add(Rect{ 50, 50, 20, 20 });
+        region.Add(Rect{ 0, 0, 100, 100 });
+        ASSERT_EQ(region.Rects(), std::vector<Rect>{ Rect(0, 0, 100, 100) });
+    }
+
+    //Adjacent rects.
+    {
+        DirtyRegion region;
+        region.Add(Rect{ 0, 0, 50, 10 });
+        region.Add(Rect{ 50, 0, 50, 10 });
+        ASSERT_EQ(region.Rects(), std::vector<Rect>{ Rect(0, 0, 100, 10) });
+    }
+
+    //Mostly overlapped rects.
+    {
+        DirtyRegion region;
+        region.Add(Rect{ 0, 0, 100, 100 });
+        region.Add(Rect{ 10, 10, 100, 100 });
+        ASSERT_EQ(region.Rects(), std::vector<Rect>{ Rect(0, 0, 110, 110) });
+    }
+}
+
+
+TEST(DirtyRegionTest, SplitIntersectingRects) {
+
+    //A cross shape, of which the bounding rect wastes much area.
+    DirtyRegion region;
+    region.Add(Rect{ 40, 0, 20, 100 });
+    region.Add(Rect{ 0, 40, 100, 20 });
+
+    ASSERT_TRUE(IsDisjoint(region));
+    ASSERT_EQ(TotalArea(region), 20 * 100 * 2 - 20 * 20);
+    ASSERT_EQ(region.Bounds(), Rect(0, 0, 100, 100));
+
+    ASSERT_TRUE(IsCovered(region, Point{ 5, 45 }));
+    ASSERT_TRUE(IsCovered(region, Point{ 95, 45 }));
+    ASSERT_TRUE(IsCovered(region, Point{ 45, 5 }));
+    ASSERT_FALSE(IsCovered(region, Point{ 5, 5 }));
+}
+
+
+TEST(DirtyRegionTest, BoundRectCount) {
+
+    DirtyRegion region;
+    for (int index = 0; index < 100; ++index) {
+        region.Add(Rect{ index * 37.f, (index % 7) * 53.f, 3, 3 });
+    }
+
+    ASSERT_LE(region.Rects().size(), DirtyRegion::MaxRectCount);
+    ASSERT_TRUE(IsDisjoint(region));
+
+    for (int index = 0; index < 100; ++index) {
+        ASSERT_TRUE(IsCovered(region, Point{ index * 37.f + 1, (index % 7) * 53.f + 1 }));
+    }
+}
\ No newline at end of file
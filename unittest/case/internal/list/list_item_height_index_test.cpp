@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <random>
+#include <gtest/gtest.h>
+#include <zaf/internal/list/list_item_height_index.h>
+
+using namespace zaf::internal;
+
+namespace {
+
+std::vector<float> GetPositions(const std::vector<float>& extents) {
+
+    std::vector<float> result{ 0 };
+    for (auto each_extent : extents) {
+        result.push_back(result.back() + each_extent);
+    }
+    return result;
+}
+
+
+bool CheckIndex(const ListItemHeightIndex& index, const std::vector<float>& expected_extents) {
+
+    if (index.Count() != expected_extents.size()) {
+        return false;
+    }
+
+    auto positions = GetPositions(expected_extents);
+    if (index.TotalExtent() != positions.back()) {
+        return false;
+    }
+
+    for (std::size_t item_index = 0; item_index < expected_extents.size(); ++item_index) {
+
+        if (index.GetExtent(item_index) != expected_extents[item_index]) {
+            return false;
+        }
+
+        if (index.GetPosition(item_index) != positions[item_index]) {
+            return false;
+        }
+    }
+
+    for (float position = -1; position <= positions.back() + 1; position += 0.5f) {
+
+        auto upper_bound = std::upper_bound(positions.begin(), positions.end(), position);
+        auto expected_upper_bound = static_cast<std::size_t>(upper_bound - positions.begin());
+        if (index.UpperBound(position) != expected_upper_bound) {
+            return false;
+        }
+
+        auto lower_bound = std::lower_bound(positions.begin(), positions.end(), position);
+        auto expected_lower_bound = static_cast<std::size_t>(lower_bound - positions.begin());
+        if (index.LowerBound(position) != expected_lower_bound) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+TEST(ListItemHeightIndexTest, Empty) {
+
+    ListItemHeightIndex index;
+    ASSERT_EQ(index.Count(), 0);
+    ASSERT_EQ(index.TotalExtent(), 0);
+    ASSERT_EQ(index.GetPosition(0), 0);
+    ASSERT_EQ(index.UpperBound(0), 1);
+    ASSERT_EQ(index.UpperBound(-1), 0);
+    ASSERT_EQ(index.LowerBound(0), 0);
+    ASSERT_EQ(index.LowerBound(1), 1);
+}
+
+
+TEST(ListItemHeightIndexTest, Modify) {
+
+    std::vector<float> extents{ 10, 11, 12, 0, 14 };
+
+    ListItemHeightIndex index;
+    index.Reset(extents);
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    //Insert to head.
+    index.Insert(0, { 1, 2 });
+    extents.insert(extents.begin(), { 1, 2 });
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    //Insert to middle.
+    index.Insert(3, { 0, 5 });
+    extents.insert(extents.begin() + 3, { 0, 5 });
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    //Insert to tail.
+    index.Insert(index.Count(), { 7 });
+    extents.push_back(7);
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    index.Update(2, { 3, 3, 3 });
+    std::fill_n(extents.begin() + 2, 3, 3.f);
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    index.Erase(1, 4);
+    extents.erase(extents.begin() + 1, extents.begin() + 5);
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    index.Erase(0, index.Count());
+    ASSERT_TRUE(CheckIndex(index, {}));
+}
+
+
+TEST(ListItemHeightIndexTest, Run) {
+
+    ListItemHeightIndex index;
+    index.Reset(10, 2.5f);
+    std::vector<float> extents(10, 2.5f);
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    //Insert into a run.
+    index.Insert(4, 3, 1);
+    extents.insert(extents.begin() + 4, 3, 1.f);
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    //Update items in a run.
+    index.Update(1, { 5, 6 });
+    extents[1] = 5;
+    extents[2] = 6;
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    //Erase across runs.
+    index.Erase(5, 4);
+    extents.erase(extents.begin() + 5, extents.begin() + 9);
+    ASSERT_TRUE(CheckIndex(index, extents));
+
+    //A run with zero extent.
+    index.Insert(0, 5, 0);
+    extents.insert(extents.begin(), 5, 0.f);
+    ASSERT_TRUE(CheckIndex(index, extents));
+}
+
+
+TEST(ListItemHeightIndexTest, HugeRun) {
+
+    ListItemHeightIndex index;
+    index.Reset(1'000'000'000, 20);
+    ASSERT_EQ(index.Count(), 1'000'000'000);
+    ASSERT_EQ(index.GetPosition(123), 123 * 20);
+    ASSERT_EQ(index.UpperBound(2000), 101);
+    ASSERT_EQ(index.LowerBound(2000), 100);
+    ASSERT_EQ(index.LowerBound(2001), 101);
+
+    index.Update(99, { 30 });
+    ASSERT_EQ(index.GetPosition(100), 100 * 20 + 10);
+    ASSERT_EQ(index.GetExtent(99), 30);
+    ASSERT_EQ(index.GetExtent(100), 20);
+}
+
+
+TEST(ListItemHeightIndexTest, RandomModify) {
+
+    std::mt19937 random_engine{ 7 };
+    auto random = [&](std::size_t max) {
+        return std::uniform_int_distribution<std::size_t>{ 0, max }(random_engine);
+    };
+
+    std::vector<float> extents;
+    ListItemHeightIndex index;
+
+    for (int operation = 0; operation < 500; ++operation) {
+
+        auto position = random(extents.size());
+        switch (random(3)) {
+        case 0: {
+            std::vector<float> inserted(random(5));
+            for (auto& each_extent : inserted) {
+                each_extent = static_cast<float>(random(4));
+            }
+            index.Insert(position, inserted);
+            extents.insert(extents.begin() + position, inserted.begin(), inserted.end());
+            break;
+        }
+        case 1: {
+            auto count = random(5);
+            auto extent = static_cast<float>(random(4)) / 2;
+            index.Insert(position, count, extent);
+            extents.insert(extents.begin() + position, count, extent);
+            break;
+        }
+        case 2: {
+            auto count = random(extents.size() - position);
+            index.Erase(position, count);
+            extents.erase(extents.begin() + position, extents.begin() + position + count);
+            break;
+        }
+        default: {
+            std::vector<float> updated(random(extents.size() - position));
+            for (auto& each_extent : updated) {
+                each_extent = static_cast<float>(random(4));
+            }
+            index.Update(position, updated);
+            std::copy(updated.begin(), updated.end(), extents.begin() + position);
+            break;
+        }
+        }
+
+        ASSERT_TRUE(CheckIndex(index, extents));
+    }
+}
\ No newline at end of file
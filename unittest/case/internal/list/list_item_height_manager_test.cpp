@@ -1,3 +1,5 @@
+#include <chrono>
+#include <cstdio>
 #include <numeric>
 #include <gtest/gtest.h>
 #include <zaf/base/range.h>
@@ -17,10 +19,20 @@ public:
         return has_variable_item_heights;
     }
 
+    bool HasLazyItemHeight() override {
+        return has_lazy_item_heights;
+    }
+
+    float GetDefaultItemHeight() override {
+        return default_item_height;
+    }
+
     float EstimateItemHeight(
         std::size_t index, 
         const std::shared_ptr<zaf::Object>& item_data) override {
 
+        ++estimate_count;
+
         if (has_variable_item_heights) {
             return index % 10 + item_height + variable_item_height_adjustment;
         }
@@ -53,6 +65,9 @@ public:
     float item_height = 10;
     float item_spacing = 0;
     float variable_item_height_adjustment = 0;
+    bool has_lazy_item_heights = false;
+    float default_item_height = 5;
+    std::size_t estimate_count = 0;
 };
 
 
@@ -787,4 +802,121 @@ TEST_F(ListControlItemHeightManagerTest, UpdateItems_VariableHeight_Spacing) {
         { 45.f, 15.f },
         { 64.f, 16.f },
     }));
+}
+
+
+TEST_F(ListControlItemHeightManagerTest, LazyItemHeights_Initialize) {
+
+    item_source_->has_variable_item_heights = true;
+    item_source_->has_lazy_item_heights = true;
+    item_source_->item_spacing = 1;
+    item_source_->item_count = 1'000'000;
+    item_height_manager_->ReloadItemHeights();
+
+    ASSERT_EQ(item_source_->estimate_count, 0);
+    ASSERT_EQ(item_height_manager_->GetTotalHeight(), 6'000'000 - 1);
+    ASSERT_EQ(item_height_manager_->GetItemPositionAndHeight(10), std::make_pair(60.f, 5.f));
+    ASSERT_EQ(item_height_manager_->GetItemIndex(61), 10);
+}
+
+
+TEST_F(ListControlItemHeightManagerTest, LazyItemHeights_Measure) {
+
+    item_source_->has_variable_item_heights = true;
+    item_source_->has_lazy_item_heights = true;
+    item_source_->item_count = 10;
+    item_height_manager_->ReloadItemHeights();
+
+    ASSERT_TRUE(item_height_manager_->MeasureItems(zaf::Range{ 2, 3 }));
+    ASSERT_EQ(item_source_->estimate_count, 3);
+    ASSERT_TRUE(CheckItemPositionsAndHeights({
+        { 0.f, 5.f },
+        { 5.f, 5.f },
+        { 10.f, 12.f },
+        { 22.f, 13.f },
+        { 35.f, 14.f },
+        { 49.f, 5.f },
+        { 54.f, 5.f },
+        { 59.f, 5.f },
+        { 64.f, 5.f },
+        { 69.f, 5.f },
+    }));
+
+    //Measured items are not measured again.
+    ASSERT_FALSE(item_height_manager_->MeasureItems(zaf::Range{ 2, 3 }));
+    ASSERT_EQ(item_source_->estimate_count, 3);
+
+    //Items whose heights equal to the default height.
+    item_source_->variable_item_height_adjustment = -10;
+    ASSERT_FALSE(item_height_manager_->MeasureItems(zaf::Range{ 5, 1 }));
+    ASSERT_EQ(item_source_->estimate_count, 4);
+}
+
+
+TEST_F(ListControlItemHeightManagerTest, LazyItemHeights_ModifyItems) {
+
+    item_source_->has_variable_item_heights = true;
+    item_source_->has_lazy_item_heights = true;
+    item_source_->item_count = 5;
+    item_height_manager_->ReloadItemHeights();
+    item_height_manager_->MeasureItems(zaf::Range{ 2, 2 });
+
+    //Added items are not measured.
+    item_source_->AddItems(0, 2);
+    ASSERT_EQ(item_source_->estimate_count, 2);
+    ASSERT_TRUE(CheckItemPositionsAndHeights({
+        { 0.f, 5.f },
+        { 5.f, 5.f },
+        { 10.f, 5.f },
+        { 15.f, 5.f },
+        { 20.f, 12.f },
+        { 32.f, 13.f },
+        { 45.f, 5.f },
+    }));
+
+    //Only measured items are estimated again when updating.
+    item_source_->UpdateItems(3, 2);
+    ASSERT_EQ(item_source_->estimate_count, 3);
+    ASSERT_TRUE(CheckItemPositionsAndHeights({
+        { 0.f, 5.f },
+        { 5.f, 5.f },
+        { 10.f, 5.f },
+        { 15.f, 5.f },
+        { 20.f, 14.f },
+        { 34.f, 13.f },
+        { 47.f, 5.f },
+    }));
+
+    item_source_->RemoveItems(0, 5);
+    ASSERT_TRUE(CheckItemPositionsAndHeights({
+        { 0.f, 13.f },
+        { 13.f, 5.f },
+    }));
+
+    //Only the item that hasn't been measured is estimated.
+    ASSERT_TRUE(item_height_manager_->MeasureItems(zaf::Range{ 0, 2 }));
+    ASSERT_EQ(item_source_->estimate_count, 4);
+}
+
+
+TEST_F(ListControlItemHeightManagerTest, DISABLED_Benchmark_StreamInsertsInto1000000Items) {
+
+    constexpr std::size_t insert_count = 10'000;
+
+    item_source_->has_variable_item_heights = true;
+    item_source_->item_spacing = 2;
+    item_source_->item_count = 1'000'000;
+    item_height_manager_->ReloadItemHeights();
+
+    auto begin = std::chrono::steady_clock::now();
+    for (std::size_t count = 0; count < insert_count; ++count) {
+        //Simulate streaming rows near the top of a large list, followed by a layout query.
+        item_source_->AddItems(count % 100, 1);
+        item_height_manager_->GetItemRange(0, 1000);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+        std::chrono::steady_clock::now() - begin);
+
+    ASSERT_EQ(item_source_->item_count, 1'000'000 + insert_count);
+    std::printf("%.2f us/insert\n", elapsed.count() / insert_count);
 }
\ No newline at end of file
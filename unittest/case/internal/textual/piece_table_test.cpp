@@ -0,0 +1,275 @@
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <gtest/gtest.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/control/internal/textual/piece_table.h>
+
+using namespace zaf::internal;
+
+namespace {
+
+std::wstring JoinChunks(const PieceTable& table, std::size_t index, std::size_t length) {
+
+    std::wstring result;
+    for (auto each_chunk : table.Chunks(index, length)) {
+        if (each_chunk.empty()) {
+            return L"<empty chunk>";
+        }
+        result.append(each_chunk);
+    }
+    return result;
+}
+
+
+bool CheckTable(const PieceTable& table, const std::wstring& expected) {
+
+    if (table.Length() != expected.length()) {
+        return false;
+    }
+
+    //Check chunks before String(), as chunks are taken from the cached string after it.
+    if (JoinChunks(table, 0, expected.length()) != expected) {
+        return false;
+    }
+
+    for (std::size_t index = 0; index < expected.length(); ++index) {
+        if (table.At(index) != expected[index]) {
+            return false;
+        }
+    }
+
+    return table.String() == expected;
+}
+
+}
+
+TEST(PieceTableTest, Empty) {
+
+    PieceTable table;
+    ASSERT_EQ(table.Length(), 0);
+    ASSERT_EQ(table.String(), L"");
+    ASSERT_TRUE(table.Chunks(0, 10).begin() == table.Chunks(0, 10).end());
+
+    PieceTable empty_string_table{ L"" };
+    ASSERT_EQ(empty_string_table.Length(), 0);
+}
+
+
+TEST(PieceTableTest, Replace) {
+
+    PieceTable table{ L"0123456789" };
+    ASSERT_TRUE(CheckTable(table, L"0123456789"));
+
+    //Insert.
+    table.Replace(3, 0, L"abc");
+    ASSERT_TRUE(CheckTable(table, L"012abc3456789"));
+
+    //Replace.
+    table.Replace(1, 4, L"xy");
+    ASSERT_TRUE(CheckTable(table, L"0xyc3456789"));
+
+    //Remove.
+    table.Replace(5, 3, L"");
+    ASSERT_TRUE(CheckTable(table, L"0xyc3789"));
+
+    //The end of the range exceeds.
+    table.Replace(4, 100, L"!");
+    ASSERT_TRUE(CheckTable(table, L"0xyc!"));
+
+    //Append.
+    table.Replace(table.Length(), 0, L"end");
+    ASSERT_TRUE(CheckTable(table, L"0xyc!end"));
+
+    ASSERT_THROW(table.Replace(table.Length() + 1, 0, L"a"), zaf::PreconditionError);
+}
+
+
+TEST(PieceTableTest, Typing) {
+
+    PieceTable table{ L"head tail" };
+    std::wstring expected = L"head tail";
+
+    //Typing contiguously shouldn't split text into many chunks.
+    for (int count = 0; count < 100; ++count) {
+        table.Replace(5 + count, 0, L"x");
+        expected.insert(5 + count, 1, L'x');
+    }
+
+    auto chunks = table.Chunks(0, table.Length());
+    ASSERT_EQ(std::distance(chunks.begin(), chunks.end()), 3);
+    ASSERT_TRUE(CheckTable(table, expected));
+}
+
+
+TEST(PieceTableTest, Snapshot) {
+
+    PieceTable table{ L"0123456789" };
+    table.Replace(5, 0, L"abc");
+
+    auto snapshot = table;
+    auto slice = table.Slice(3, 6);
+    ASSERT_TRUE(CheckTable(slice, L"34abc5"));
+
+    //Modifying the table doesn't affect the snapshot and the slice.
+    table.Replace(8, 0, L"def");
+    table.Replace(0, 2, L"");
+    ASSERT_TRUE(CheckTable(table, L"234abcdef56789"));
+    ASSERT_TRUE(CheckTable(snapshot, L"01234abc56789"));
+    ASSERT_TRUE(CheckTable(slice, L"34abc5"));
+
+    //Modifying the snapshot doesn't affect the table.
+    snapshot.Replace(8, 0, L"!");
+    ASSERT_TRUE(CheckTable(snapshot, L"01234abc!56789"));
+    ASSERT_TRUE(CheckTable(table, L"234abcdef56789"));
+
+    //Replace with pieces of another table.
+    table.Replace(0, 3, slice);
+    ASSERT_TRUE(CheckTable(table, L"34abc5abcdef56789"));
+
+    //Replace with pieces of the table itself.
+    table.Replace(table.Length(), 0, table);
+    ASSERT_TRUE(CheckTable(table, L"34abc5abcdef5678934abc5abcdef56789"));
+}
+
+
+TEST(PieceTableTest, Chunks) {
+
+    PieceTable table{ L"0123456789" };
+    table.Replace(5, 0, L"abc");
+    table.Replace(0, 0, L"xyz");
+
+    ASSERT_EQ(JoinChunks(table, 0, 0), L"");
+    ASSERT_EQ(JoinChunks(table, 2, 6), L"z01234");
+    ASSERT_EQ(JoinChunks(table, 8, 100), L"abc56789");
+    ASSERT_EQ(JoinChunks(table, table.Length(), 1), L"");
+}
+
+
+TEST(PieceTableTest, SubString) {
+
+    PieceTable table{ L"0123456789" };
+    table.Replace(5, 0, L"abc");
+
+    ASSERT_EQ(table.SubString(0, 0), L"");
+    ASSERT_EQ(table.SubString(3, 4), L"34ab");
+    ASSERT_EQ(table.SubString(6, 100), L"bc56789");
+    ASSERT_THROW(table.SubString(14, 1), zaf::PreconditionError);
+}
+
+
+TEST(PieceTableTest, StringDoesNotChangePieces) {
+
+    PieceTable table{ L"0123456789" };
+    table.Replace(5, 0, L"abc");
+
+    auto snapshot = table;
+    ASSERT_EQ(table.String(), L"01234abc56789");
+
+    //The snapshot still has its own pieces.
+    auto chunks = snapshot.Chunks(0, snapshot.Length());
+    ASSERT_EQ(std::distance(chunks.begin(), chunks.end()), 3);
+
+    //The string is rebuilt after modification.
+    table.Replace(0, 1, L"x");
+    ASSERT_EQ(table.String(), L"x1234abc56789");
+    ASSERT_EQ(snapshot.String(), L"01234abc56789");
+}
+
+
+TEST(PieceTableTest, RandomModify) {
+
+    std::mt19937 random_engine{ 7 };
+    auto random = [&](std::size_t max) {
+        return std::uniform_int_distribution<std::size_t>{ 0, max }(random_engine);
+    };
+
+    auto random_text = [&](std::size_t max_length) {
+        std::wstring result(random(max_length), L'\0');
+        for (auto& each_char : result) {
+            each_char = static_cast<wchar_t>(L'a' + random(25));
+        }
+        return result;
+    };
+
+    PieceTable table;
+    std::wstring expected;
+    std::vector<std::pair<PieceTable, std::wstring>> snapshots;
+
+    for (int operation = 0; operation < 500; ++operation) {
+
+        auto index = random(expected.length());
+        auto length = random(expected.length() - index + 2);
+
+        switch (random(3)) {
+        case 0:
+        case 1: {
+            //Text longer than the append buffer is included occasionally.
+            auto text = random_text(random(20) == 0 ? 3000 : 8);
+            table.Replace(index, length, text);
+            expected.replace(index, length, text);
+            break;
+        }
+        case 2: {
+            const auto& [snapshot, snapshot_text] = snapshots.empty() ?
+                std::pair<PieceTable, std::wstring>{} :
+                snapshots[random(snapshots.size() - 1)];
+
+            auto slice_index = random(snapshot_text.length());
+            auto slice_length = random(snapshot_text.length() - slice_index);
+            table.Replace(index, length, snapshot.Slice(slice_index, slice_length));
+            expected.replace(index, length, snapshot_text.substr(slice_index, slice_length));
+            break;
+        }
+        default:
+            snapshots.emplace_back(table, expected);
+            break;
+        }
+
+        ASSERT_EQ(JoinChunks(table, 0, table.Length()), expected);
+
+        //Build the string occasionally, so that chunks are taken from both the string and pieces.
+        if (random(10) == 0) {
+            ASSERT_TRUE(CheckTable(table, expected));
+        }
+    }
+
+    for (const auto& [snapshot, snapshot_text] : snapshots) {
+        ASSERT_TRUE(CheckTable(snapshot, snapshot_text));
+    }
+}
+
+
+TEST(PieceTableTest, DISABLED_Benchmark_Edit50MB) {
+
+    constexpr std::size_t text_length = 50 * 1024 * 1024 / sizeof(wchar_t);
+    constexpr int edit_count = 10000;
+
+    std::mt19937 random_engine{ 7 };
+    std::uniform_int_distribution<std::size_t> distribution{ 0, text_length - 1 };
+
+    auto benchmark = [&](const char* name, auto&& edit) {
+        auto begin_time = std::chrono::steady_clock::now();
+        for (int count = 0; count < edit_count; ++count) {
+            edit(distribution(random_engine));
+        }
+        auto elapsed = std::chrono::steady_clock::now() - begin_time;
+        std::printf(
+            "%s: %.3f us per edit\n",
+            name,
+            std::chrono::duration<double, std::micro>(elapsed).count() / edit_count);
+    };
+
+    std::wstring string(text_length, L'a');
+    benchmark("std::wstring", [&](std::size_t index) {
+        string.insert(index, L"x");
+        string.erase(index / 2, 1);
+    });
+
+    PieceTable table{ std::wstring(text_length, L'a') };
+    benchmark("PieceTable", [&](std::size_t index) {
+        table.Replace(index, 0, L"x");
+        table.Replace(index / 2, 1, L"");
+    });
+}
\ No newline at end of file
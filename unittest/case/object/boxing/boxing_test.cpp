@@ -96,6 +96,26 @@ TEST(BoxingTest, Box) {
 }
 
 
+TEST(BoxingTest, BoxNumeric) {
+
+    //Boxed objects are always new instances, as they can be modified.
+    std::shared_ptr<Int32> boxed_int = Box(0);
+    ASSERT_NE(boxed_int, Box(0));
+    boxed_int->SetValue(1);
+    ASSERT_EQ(Box(0)->Value(), 0);
+
+    std::shared_ptr<Boolean> boxed_bool = Box(true);
+    ASSERT_NE(boxed_bool, Box(true));
+
+    //Memory of freed objects is reused.
+    auto address = boxed_int.get();
+    boxed_int.reset();
+    std::shared_ptr<Int32> new_boxed_int = Box(2);
+    ASSERT_EQ(new_boxed_int.get(), address);
+    ASSERT_EQ(new_boxed_int->Value(), 2);
+}
+
+
 TEST(BoxingTest, UnboxPointer) {
 
     //Null pointer
@@ -1,7 +1,11 @@
+#include <chrono>
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <zaf/object/parsing/parse_error.h>
 #include <zaf/base/string/to_numeric.h>
 #include <zaf/control/control.h>
+#include <zaf/control/label.h>
+#include <zaf/control/linear_box.h>
 #include <zaf/object/object.h>
 #include <zaf/object/object_type.h>
 #include <zaf/object/parsing/helpers.h>
@@ -298,4 +302,43 @@ TEST(ParsingTest, ParsePropertyOrder) {
 
         ASSERT_GT(object.APropertyOrder(), object.BProeprtyOrder());
     }
+}
+
+
+TEST(ParsingTest, DISABLED_Benchmark_Parse5000Controls) {
+
+    std::wstring xaml = L"<VerticalBox>";
+    for (int index = 0; index < 5000; ++index) {
+        xaml += LR"(<Label Name="Label" Text="Text" Width="100" Height="20" Padding="2,2,2,2" )"
+            LR"(IsVisible="true" IsEnabled="true" TextAlignment="Center" />)";
+    }
+    xaml += L"</VerticalBox>";
+
+    auto begin_time = std::chrono::steady_clock::now();
+    auto box = zaf::CreateObjectFromXaml<zaf::VerticalBox>(xaml);
+    auto elapsed = std::chrono::steady_clock::now() - begin_time;
+    ASSERT_EQ(box->ChildCount(), 5000);
+
+    std::printf(
+        "Parse 5000 controls: %.3f ms\n",
+        std::chrono::duration<double, std::milli>(elapsed).count());
+
+    //Look up properties declared in different levels of the inheritance chain.
+    constexpr int lookup_count = 1'000'000;
+    auto type = zaf::Label::StaticType();
+    const std::wstring_view property_names[] = { L"Text", L"Width", L"Name", L"NotExist" };
+
+    std::size_t found_count{};
+    begin_time = std::chrono::steady_clock::now();
+    for (int index = 0; index < lookup_count; ++index) {
+        if (type->GetProperty(property_names[index % std::size(property_names)])) {
+            ++found_count;
+        }
+    }
+    elapsed = std::chrono::steady_clock::now() - begin_time;
+    ASSERT_EQ(found_count, lookup_count / 4 * 3);
+
+    std::printf(
+        "GetProperty: %.3f ns per lookup\n",
+        std::chrono::duration<double, std::nano>(elapsed).count() / lookup_count);
 }
\ No newline at end of file
@@ -1,9 +1,13 @@
+#include <chrono>
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <zaf/base/error/invalid_type_error.h>
 #include <zaf/base/error/invalid_operation_error.h>
+#include <zaf/base/error/precondition_error.h>
 #include <zaf/graphic/image.h>
 #include <zaf/graphic/point.h>
 #include <zaf/graphic/size.h>
+#include <zaf/object/internal/property_registrar.h>
 #include <zaf/object/object.h>
 #include <zaf/object/property_support.h>
 
@@ -128,6 +132,70 @@ ZAF_OBJECT_END
 
 ZAF_OBJECT_IMPL(PropertyHost);
 
+
+class FakeProperty : public zaf::ObjectProperty {
+public:
+    explicit FakeProperty(std::wstring name) : name_(std::move(name)) {
+
+    }
+
+    std::wstring_view Name() const noexcept override {
+        return name_;
+    }
+
+    bool CanGet() const noexcept override {
+        return false;
+    }
+
+    bool CanSet() const noexcept override {
+        return false;
+    }
+
+    bool IsValueDynamic() const noexcept override {
+        return false;
+    }
+
+    zaf::ObjectType* ValueType() const noexcept override {
+        return nullptr;
+    }
+
+    std::shared_ptr<zaf::Object> GetValue(const zaf::Object& object) const override {
+        return nullptr;
+    }
+
+    void SetValue(zaf::Object& object, const std::shared_ptr<zaf::Object>& value) const override {
+
+    }
+
+private:
+    std::wstring name_;
+};
+
+
+//A type that is not registered to the reflection manager, so that tests can register properties
+//to it at any time.
+class FakeType : public zaf::ObjectType {
+public:
+    explicit FakeType(zaf::ObjectType* base_type) : base_type_(base_type) {
+
+    }
+
+    zaf::ObjectType* BaseType() const noexcept override {
+        return base_type_;
+    }
+
+    std::wstring_view Name() const noexcept override {
+        return L"FakeType";
+    }
+
+    std::shared_ptr<zaf::Object> CreateInstance() const override {
+        return nullptr;
+    }
+
+private:
+    zaf::ObjectType* base_type_{};
+};
+
 }
 
 
@@ -270,6 +338,63 @@ TEST(PropertyTest, GetProperty) {
 }
 
 
+TEST(PropertyTest, HidePropertiesInInheritanceChain) {
+
+    FakeType base_type{ nullptr };
+    FakeType middle_type{ &base_type };
+    FakeType derived_type{ &middle_type };
+
+    FakeProperty base_property{ L"Value" };
+    FakeProperty base_only_property{ L"BaseOnly" };
+    FakeProperty middle_property{ L"Value" };
+    zaf::internal::PropertyRegistrar::Register(&base_type, &base_property);
+    zaf::internal::PropertyRegistrar::Register(&base_type, &base_only_property);
+    zaf::internal::PropertyRegistrar::Register(&middle_type, &middle_property);
+
+    //The property of the nearest type hides the others with the same name.
+    ASSERT_EQ(derived_type.GetProperty(L"Value"), &middle_property);
+    ASSERT_EQ(derived_type.GetInheritedProperty(L"Value"), &middle_property);
+    ASSERT_EQ(middle_type.GetProperty(L"Value"), &middle_property);
+    ASSERT_EQ(middle_type.GetInheritedProperty(L"Value"), &base_property);
+    ASSERT_EQ(base_type.GetProperty(L"Value"), &base_property);
+
+    //Properties that are not hidden are found in any type of the chain.
+    ASSERT_EQ(derived_type.GetProperty(L"BaseOnly"), &base_only_property);
+    ASSERT_EQ(middle_type.GetProperty(L"BaseOnly"), &base_only_property);
+}
+
+
+TEST(PropertyTest, RegisterPropertyAfterLookup) {
+
+    FakeType base_type{ nullptr };
+    FakeType derived_type{ &base_type };
+    FakeType more_derived_type{ &derived_type };
+
+    FakeProperty property1{ L"Property1" };
+    FakeProperty property2{ L"Property2" };
+    FakeProperty property3{ L"Property3" };
+    FakeProperty property4{ L"Property4" };
+
+    zaf::internal::PropertyRegistrar::Register(&derived_type, &property1);
+    ASSERT_EQ(derived_type.GetProperty(L"Property1"), &property1);
+
+    //The property table of the type has been built.
+    ASSERT_THROW(
+        zaf::internal::PropertyRegistrar::Register(&derived_type, &property2),
+        zaf::PreconditionError);
+
+    //The properties of the base type have been added to the table of the derived type.
+    ASSERT_THROW(
+        zaf::internal::PropertyRegistrar::Register(&base_type, &property3),
+        zaf::PreconditionError);
+
+    //A more derived type can still register properties before its own lookup.
+    zaf::internal::PropertyRegistrar::Register(&more_derived_type, &property4);
+    ASSERT_EQ(more_derived_type.GetProperty(L"Property4"), &property4);
+    ASSERT_EQ(more_derived_type.GetProperty(L"Property1"), &property1);
+}
+
+
 TEST(PropertyTest, ReadWrite) {
 
     PropertyHost host;
@@ -439,3 +564,43 @@ TEST(PropertyTest, ErrorValueType) {
     }
 }
 
+
+TEST(PropertyTest, DISABLED_Benchmark_GetSetRoundTrip) {
+
+    constexpr int round_trip_count = 1000000;
+
+    PropertyHost host;
+    auto property = host.DynamicType()->GetProperty(L"ReadWrite");
+
+    auto benchmark = [&](const char* name, int value_range, auto&& round_trip) {
+        int sum{};
+        auto begin_time = std::chrono::steady_clock::now();
+        for (int count = 0; count < round_trip_count; ++count) {
+            sum += round_trip(count % value_range);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - begin_time;
+        std::printf(
+            "%s: %.3f ns per round trip (%d)\n",
+            name,
+            std::chrono::duration<double, std::nano>(elapsed).count() / round_trip_count,
+            sum);
+    };
+
+    //Simulates boxing with a heap allocation for every value.
+    auto allocating_round_trip = [&](int value) {
+        property->SetValue(host, std::make_shared<zaf::Int32>(value));
+        std::shared_ptr<zaf::Object> got_value = std::make_shared<zaf::Int32>(host.ReadWrite());
+        return zaf::Unbox<int>(*got_value);
+    };
+
+    auto property_round_trip = [&](int value) {
+        property->SetValue(host, zaf::Box(value));
+        return zaf::Unbox<int>(*property->GetValue(host));
+    };
+
+    benchmark("Allocating, small values", 100, allocating_round_trip);
+    benchmark("Property, small values", 100, property_round_trip);
+    benchmark("Allocating, large values", 1000000, allocating_round_trip);
+    benchmark("Property, large values", 1000000, property_round_trip);
+}
+
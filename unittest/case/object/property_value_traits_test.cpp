@@ -162,6 +162,28 @@ TEST(PropertyValueTraitsTest, CustomBoxingTypeBoxing) {
 }
 
 
+TEST(PropertyValueTraitsTest, BoxedValuesAreIndependent) {
+
+    //Each boxing creates a new instance, so modifying one doesn't affect the others.
+    auto boxed_int = As<Int32>(PropertyValueTraits<int>::ToBoxedObject(0));
+    ASSERT_NE(boxed_int, nullptr);
+    boxed_int->SetValue(5);
+    ASSERT_EQ(Unbox<int>(*PropertyValueTraits<int>::ToBoxedObject(0)), 0);
+
+    auto boxed_string = As<WideString>(
+        PropertyValueTraits<std::wstring>::ToBoxedObject(std::wstring{}));
+    ASSERT_NE(boxed_string, nullptr);
+    boxed_string->SetValue(L"changed");
+    ASSERT_EQ(
+        Unbox<std::wstring>(*PropertyValueTraits<std::wstring>::ToBoxedObject(std::wstring{})),
+        L"");
+
+    ASSERT_NE(
+        PropertyValueTraits<bool>::ToBoxedObject(true),
+        PropertyValueTraits<bool>::ToBoxedObject(true));
+}
+
+
 TEST(PropertyValueTraitsTest, BoxedInstanceBoxing) {
 
     using Traits = PropertyValueTraits<std::shared_ptr<Size>>;
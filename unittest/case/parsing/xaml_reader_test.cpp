@@ -8,4 +8,56 @@ TEST(XamlReader, ReadFromWideString) {
 
     auto node = xaml_reader->Read();
     ASSERT_NE(xaml_reader, nullptr);
+}
+
+
+TEST(XamlReader, ReadNodes) {
+
+    auto xaml_reader = zaf::XamlReader::FromString(LR"(
+        <Box Width="10" Height="">
+            <Box.Text>text</Box.Text>
+            <Child Name="child" />
+            content
+        </Box>
+    )");
+
+    auto node = xaml_reader->Read();
+    ASSERT_EQ(node->Type(), zaf::XamlNodeType::Element);
+    ASSERT_EQ(node->Value(), L"Box");
+
+    const auto& attributes = node->GetAttributes();
+    ASSERT_EQ(attributes.size(), 2);
+    ASSERT_EQ(attributes[0]->Name(), L"Width");
+    ASSERT_EQ(attributes[0]->Value(), L"10");
+    ASSERT_EQ(attributes[1]->Name(), L"Height");
+    ASSERT_EQ(attributes[1]->Value(), L"");
+    ASSERT_EQ(node->FindAttribute(L"Height"), attributes[1]);
+    ASSERT_EQ(node->FindAttribute(L"Text"), nullptr);
+
+    auto property_node = node->FindPropertyNode(L"Box.Text");
+    ASSERT_NE(property_node, nullptr);
+    ASSERT_EQ(property_node->GetContentNodes().size(), 1);
+    ASSERT_EQ(property_node->GetContentNodes()[0]->Value(), L"text");
+
+    const auto& content_nodes = node->GetContentNodes();
+    ASSERT_EQ(content_nodes.size(), 2);
+    ASSERT_EQ(content_nodes[0]->Value(), L"Child");
+    ASSERT_EQ(content_nodes[0]->FindAttribute(L"Name")->Value(), L"child");
+    ASSERT_EQ(content_nodes[1]->Type(), zaf::XamlNodeType::Text);
+}
+
+
+TEST(XamlReader, NodesOutliveRootNode) {
+
+    std::shared_ptr<zaf::XamlNode> child_node;
+    std::shared_ptr<zaf::XamlAttribute> attribute;
+    {
+        auto node = zaf::XamlReader::FromString(LR"(<Box><Child Name="child" /></Box>)")->Read();
+        child_node = node->GetContentNodes()[0];
+        attribute = child_node->FindAttribute(L"Name");
+    }
+
+    ASSERT_EQ(child_node->Value(), L"Child");
+    ASSERT_EQ(attribute->Name(), L"Name");
+    ASSERT_EQ(attribute->Value(), L"child");
 }
\ No newline at end of file
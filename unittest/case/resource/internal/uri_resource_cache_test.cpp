@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <zaf/base/byte_array.h>
+#include <zaf/graphic/image.h>
+#include <zaf/resource/internal/uri_resource_cache.h>
+#include <zaf/resource/uri_loader.h>
+
+using namespace zaf;
+using namespace zaf::internal;
+
+namespace {
+
+class FakeURILoader : public URILoader {
+public:
+    void AddContent(const std::wstring& uri, const ByteArray& content) {
+        contents_[uri] = content;
+    }
+
+    Stream Load(std::wstring_view uri, float dpi) override {
+
+        ++load_counts_[std::wstring{ uri }];
+
+        const auto& content = contents_.at(std::wstring{ uri });
+        return Stream::FromMemory(content.Data(), content.Size());
+    }
+
+    int LoadCount(const std::wstring& uri) const {
+        auto iterator = load_counts_.find(uri);
+        return iterator != load_counts_.end() ? iterator->second : 0;
+    }
+
+private:
+    std::map<std::wstring, ByteArray> contents_;
+    std::map<std::wstring, int> load_counts_;
+};
+
+
+std::string ReadAll(Stream& stream) {
+
+    std::string result(stream.Size(), '\0');
+    stream.Read(result.size(), result.data());
+    return result;
+}
+
+
+std::shared_ptr<FakeURILoader> CreateLoaderWithTextContents() {
+
+    auto result = std::make_shared<FakeURILoader>();
+    result->AddContent(L"a", ByteArray::FromString("aaaaaaaaaa"));
+    result->AddContent(L"b", ByteArray::FromString("bbbbbbbbbb"));
+    result->AddContent(L"c", ByteArray::FromString("cccccccccc"));
+    result->AddContent(L"d", ByteArray::FromString("dddddddddd"));
+    result->AddContent(L"large", ByteArray::FromString(std::string(100, 'x')));
+    return result;
+}
+
+}
+
+TEST(URIResourceCacheTest, HitAndMiss) {
+
+    auto loader = CreateLoaderWithTextContents();
+    URIResourceCache cache{ loader, 100 };
+
+    auto stream = cache.Load(L"a", 96);
+    ASSERT_EQ(ReadAll(stream), "aaaaaaaaaa");
+
+    stream = cache.Load(L"a", 96);
+    ASSERT_EQ(ReadAll(stream), "aaaaaaaaaa");
+
+    ASSERT_EQ(loader->LoadCount(L"a"), 1);
+    ASSERT_EQ(cache.CachedByteCount(), 10);
+
+    auto statistics = cache.Statistics();
+    ASSERT_EQ(statistics.hit_count, 1);
+    ASSERT_EQ(statistics.miss_count, 1);
+    ASSERT_EQ(statistics.eviction_count, 0);
+}
+
+
+TEST(URIResourceCacheTest, KeyedByDPI) {
+
+    auto loader = CreateLoaderWithTextContents();
+    URIResourceCache cache{ loader, 100 };
+
+    cache.Load(L"a", 96);
+    cache.Load(L"a", 144);
+    cache.Load(L"a", 144);
+
+    ASSERT_EQ(loader->LoadCount(L"a"), 2);
+    ASSERT_EQ(cache.Statistics().hit_count, 1);
+}
+
+
+TEST(URIResourceCacheTest, EvictLeastRecentlyUsed) {
+
+    auto loader = CreateLoaderWithTextContents();
+    URIResourceCache cache{ loader, 30 };
+
+    cache.Load(L"a", 96);
+    cache.Load(L"b", 96);
+    cache.Load(L"c", 96);
+    ASSERT_EQ(cache.CachedByteCount(), 30);
+
+    //Use "a" so that "b" becomes the least recently used one.
+    cache.Load(L"a", 96);
+
+    cache.Load(L"d", 96);
+    ASSERT_EQ(cache.CachedByteCount(), 30);
+    ASSERT_EQ(cache.Statistics().eviction_count, 1);
+
+    cache.Load(L"a", 96);
+    cache.Load(L"c", 96);
+    cache.Load(L"d", 96);
+    ASSERT_EQ(loader->LoadCount(L"a"), 1);
+    ASSERT_EQ(loader->LoadCount(L"c"), 1);
+    ASSERT_EQ(loader->LoadCount(L"d"), 1);
+
+    //"b" has been evicted.
+    cache.Load(L"b", 96);
+    ASSERT_EQ(loader->LoadCount(L"b"), 2);
+}
+
+
+TEST(URIResourceCacheTest, DoNotCacheContentLargerThanBudget) {
+
+    auto loader = CreateLoaderWithTextContents();
+    URIResourceCache cache{ loader, 50 };
+
+    cache.Load(L"a", 96);
+
+    auto stream = cache.Load(L"large", 96);
+    ASSERT_EQ(ReadAll(stream), std::string(100, 'x'));
+
+    cache.Load(L"large", 96);
+    ASSERT_EQ(loader->LoadCount(L"large"), 2);
+
+    //Other contents are not evicted.
+    ASSERT_EQ(cache.CachedByteCount(), 10);
+    ASSERT_EQ(cache.Statistics().eviction_count, 0);
+}
+
+
+TEST(URIResourceCacheTest, ZeroBudget) {
+
+    auto loader = CreateLoaderWithTextContents();
+    URIResourceCache cache{ loader, 0 };
+
+    cache.Load(L"a", 96);
+    cache.Load(L"a", 96);
+
+    ASSERT_EQ(loader->LoadCount(L"a"), 2);
+    ASSERT_EQ(cache.CachedByteCount(), 0);
+}
+
+
+TEST(URIResourceCacheTest, StreamsShareContent) {
+
+    auto loader = CreateLoaderWithTextContents();
+    URIResourceCache cache{ loader, 100 };
+
+    auto stream1 = cache.Load(L"a", 96);
+    auto stream2 = cache.Load(L"a", 96);
+
+    //Streams have their own positions.
+    char buffer[4]{};
+    stream1.Read(4, buffer);
+    ASSERT_EQ(stream1.Position(), 4);
+    ASSERT_EQ(stream2.Position(), 0);
+
+    //Cached content can't be modified.
+    ASSERT_FALSE(stream1.CanWrite());
+
+    //Streams are still valid after the content is removed from the cache.
+    cache.Clear();
+    ASSERT_EQ(cache.CachedByteCount(), 0);
+    ASSERT_EQ(ReadAll(stream2), "aaaaaaaaaa");
+}
+
+
+TEST(URIResourceCacheTest, ShareDecodedImage) {
+
+    //A 1x1 24-bit bitmap.
+    const std::uint8_t bitmap_data[] = {
+        //BITMAPFILEHEADER
+        'B', 'M', 58, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,
+        //BITMAPINFOHEADER
+        40, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 24, 0,
+        0, 0, 0, 0, 4, 0, 0, 0, 0x13, 0x0b, 0, 0, 0x13, 0x0b, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        //Pixel data
+        0xff, 0, 0, 0,
+    };
+
+    auto loader = std::make_shared<FakeURILoader>();
+    loader->AddContent(L"image", ByteArray::FromMemory(bitmap_data, sizeof(bitmap_data)));
+
+    URIResourceCache cache{ loader, 100 };
+
+    auto image1 = cache.LoadDecodedImage(L"image", 96);
+    auto image2 = cache.LoadDecodedImage(L"image", 96);
+    ASSERT_NE(image1, nullptr);
+    ASSERT_EQ(image1, image2);
+    ASSERT_EQ(image1->GetPixelSize(), Size(1, 1));
+
+    auto statistics = cache.Statistics();
+    ASSERT_EQ(statistics.image_hit_count, 1);
+    ASSERT_EQ(statistics.image_miss_count, 1);
+
+    //Once the image is released, it is decoded again from the cached content.
+    image1.reset();
+    image2.reset();
+
+    auto image3 = cache.LoadDecodedImage(L"image", 96);
+    ASSERT_NE(image3, nullptr);
+    ASSERT_EQ(cache.Statistics().image_miss_count, 2);
+    ASSERT_EQ(loader->LoadCount(L"image"), 1);
+}
\ No newline at end of file
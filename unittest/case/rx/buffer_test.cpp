@@ -0,0 +1,187 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/rx/observable.h>
+#include <zaf/rx/scheduler/single_thread_scheduler.h>
+#include <zaf/rx/subject/subject.h>
+#include "case/rx/manual_scheduler.h"
+
+TEST(RxBufferTest, Precondition) {
+
+    auto observable = zaf::rx::Observable<int>::Just(1);
+    ASSERT_THROW(observable.Buffer(0), zaf::PreconditionError);
+    ASSERT_THROW(observable.Buffer(std::chrono::seconds(1), nullptr), zaf::PreconditionError);
+    ASSERT_THROW(observable.Buffer(0, std::chrono::seconds(1), std::make_shared<ManualScheduler>()),
+        zaf::PreconditionError);
+}
+
+
+TEST(RxBufferTest, BufferByCount) {
+
+    zaf::rx::Subject<int> subject;
+
+    std::vector<std::vector<int>> buffers;
+    bool is_completed{};
+    auto sub = subject.AsObservable().Buffer(2).Subscribe([&](const std::vector<int>& buffer) {
+        buffers.push_back(buffer);
+    },
+    [&]() {
+        is_completed = true;
+    });
+
+    subject.AsObserver().OnNext(1);
+    ASSERT_TRUE(buffers.empty());
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+    subject.AsObserver().OnNext(4);
+    subject.AsObserver().OnNext(5);
+    ASSERT_EQ(buffers, (std::vector<std::vector<int>>{ { 1, 2 }, { 3, 4 } }));
+
+    //The remaining items are emitted on completion.
+    subject.AsObserver().OnCompleted();
+    ASSERT_EQ(buffers, (std::vector<std::vector<int>>{ { 1, 2 }, { 3, 4 }, { 5 } }));
+    ASSERT_TRUE(is_completed);
+}
+
+
+TEST(RxBufferTest, BufferByCount_Error) {
+
+    zaf::rx::Subject<int> subject;
+
+    std::vector<std::vector<int>> buffers;
+    bool has_error{};
+    auto sub = subject.AsObservable().Buffer(2).Subscribe([&](const std::vector<int>& buffer) {
+        buffers.push_back(buffer);
+    },
+    [&](const std::exception_ptr&) {
+        has_error = true;
+    });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+    subject.AsObserver().OnError(std::make_exception_ptr(0));
+
+    //The remaining items are discarded on error.
+    ASSERT_EQ(buffers, (std::vector<std::vector<int>>{ { 1, 2 } }));
+    ASSERT_TRUE(has_error);
+}
+
+
+TEST(RxBufferTest, BufferByTime) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+    zaf::rx::Subject<int> subject;
+
+    std::vector<std::vector<int>> buffers;
+    auto sub = subject.AsObservable()
+        .Buffer(std::chrono::milliseconds(10), scheduler)
+        .Subscribe([&](const std::vector<int>& buffer) {
+            buffers.push_back(buffer);
+        });
+
+    //Only one timer is started for the period, regardless of the emitted items.
+    ASSERT_EQ(scheduler->WorkCount(), 1);
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+    ASSERT_EQ(scheduler->WorkCount(), 1);
+    ASSERT_TRUE(buffers.empty());
+
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(buffers, (std::vector<std::vector<int>>{ { 1, 2, 3 } }));
+    ASSERT_EQ(scheduler->WorkCount(), 1);
+
+    //No empty buffer is emitted.
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(buffers.size(), 1);
+
+    subject.AsObserver().OnNext(4);
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(buffers, (std::vector<std::vector<int>>{ { 1, 2, 3 }, { 4 } }));
+}
+
+
+TEST(RxBufferTest, BufferByCountAndTime) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+    zaf::rx::Subject<int> subject;
+
+    std::vector<std::vector<int>> buffers;
+    auto sub = subject.AsObservable()
+        .Buffer(2, std::chrono::milliseconds(10), scheduler)
+        .Subscribe([&](const std::vector<int>& buffer) {
+            buffers.push_back(buffer);
+        });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+    ASSERT_EQ(buffers, (std::vector<std::vector<int>>{ { 1, 2 } }));
+
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(buffers, (std::vector<std::vector<int>>{ { 1, 2 }, { 3 } }));
+}
+
+
+TEST(RxBufferTest, PeriodEndsOnAnotherThread) {
+
+    constexpr int item_count = 100'000;
+
+    zaf::rx::Subject<int> subject;
+
+    std::atomic<int> running_emission_count{};
+    std::atomic<bool> has_concurrent_emission{};
+    std::vector<int> values;
+    bool is_completed{};
+
+    //A zero period makes period ends run back to back on the scheduler thread, while full
+    //buffers are emitted on the current thread.
+    auto sub = subject.AsObservable()
+        .Buffer(3, std::chrono::steady_clock::duration::zero(),
+            std::make_shared<zaf::rx::SingleThreadScheduler>())
+        .Subscribe([&](const std::vector<int>& buffer) {
+            if (++running_emission_count > 1) {
+                has_concurrent_emission = true;
+            }
+            values.insert(values.end(), buffer.begin(), buffer.end());
+            --running_emission_count;
+        },
+        [&]() {
+            is_completed = true;
+        });
+
+    for (int value = 0; value < item_count; ++value) {
+        subject.AsObserver().OnNext(value);
+    }
+    subject.AsObserver().OnCompleted();
+
+    ASSERT_FALSE(has_concurrent_emission);
+    ASSERT_TRUE(is_completed);
+
+    //No item is lost, and buffers are emitted in order.
+    ASSERT_EQ(values.size(), item_count);
+    for (int value = 0; value < item_count; ++value) {
+        ASSERT_EQ(values[value], value);
+    }
+}
+
+
+TEST(RxBufferTest, Dispose) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+    zaf::rx::Subject<int> subject;
+
+    std::vector<std::vector<int>> buffers;
+    auto sub = subject.AsObservable()
+        .Buffer(std::chrono::milliseconds(10), scheduler)
+        .Subscribe([&](const std::vector<int>& buffer) {
+            buffers.push_back(buffer);
+        });
+
+    subject.AsObserver().OnNext(1);
+    sub->Dispose();
+    scheduler->RunPendingWorks();
+    ASSERT_TRUE(buffers.empty());
+    ASSERT_EQ(scheduler->WorkCount(), 0);
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <zaf/base/error/precondition_error.h>
 #include <zaf/rx/scheduler/single_thread_scheduler.h>
 #include <zaf/rx/subject/subject.h>
+#include "case/rx/manual_scheduler.h"
 
 TEST(RxDebounceTest, Precondition) {
 
@@ -197,4 +198,64 @@ TEST(RxDebounceTest, MultipleThreads) {
     // Wait for a while to ensure no more items are emitted.
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
     ASSERT_EQ(values.size(), 1);
+}
+
+
+// The timer is armed only once for a burst of items, and is re-armed with the remaining time if it 
+// fires before the deadline.
+TEST(RxDebounceTest, LazyRearm) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+    zaf::rx::Subject<int> subject;
+
+    std::vector<int> values;
+    auto sub = subject.AsObservable()
+        .Debounce(std::chrono::milliseconds(10), scheduler)
+        .Subscribe([&](int value) {
+            values.push_back(value);
+        });
+
+    subject.AsObserver().OnNext(1);
+    ASSERT_EQ(scheduler->ScheduledWorkCount(), 1);
+
+    scheduler->AdvanceTime(std::chrono::milliseconds(5));
+    subject.AsObserver().OnNext(2);
+    ASSERT_EQ(scheduler->ScheduledWorkCount(), 1);
+
+    //The timer fires before the deadline, and is re-armed.
+    scheduler->AdvanceTime(std::chrono::milliseconds(5));
+    ASSERT_TRUE(values.empty());
+    ASSERT_EQ(scheduler->ScheduledWorkCount(), 2);
+
+    scheduler->AdvanceTime(std::chrono::milliseconds(5));
+    ASSERT_EQ(values, (std::vector<int>{ 2 }));
+    ASSERT_EQ(scheduler->ScheduledWorkCount(), 2);
+    ASSERT_EQ(scheduler->WorkCount(), 0);
+
+    subject.AsObserver().OnNext(3);
+    scheduler->AdvanceTime(std::chrono::milliseconds(10));
+    ASSERT_EQ(values, (std::vector<int>{ 2, 3 }));
+    ASSERT_EQ(scheduler->ScheduledWorkCount(), 3);
+}
+
+
+TEST(RxDebounceTest, NoSchedulerTrafficBetweenDeadlines) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+    zaf::rx::Subject<int> subject;
+
+    std::vector<int> values;
+    auto sub = subject.AsObservable()
+        .Debounce(std::chrono::milliseconds(10), scheduler)
+        .Subscribe([&](int value) {
+            values.push_back(value);
+        });
+
+    for (int value = 0; value < 1000; ++value) {
+        subject.AsObserver().OnNext(value);
+    }
+    ASSERT_EQ(scheduler->ScheduledWorkCount(), 1);
+
+    scheduler->AdvanceTime(std::chrono::milliseconds(10));
+    ASSERT_EQ(values, (std::vector<int>{ 999 }));
 }
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <zaf/rx/internal/subject/replay_buffer.h>
+
+using namespace std::chrono_literals;
+using zaf::rx::internal::ReplayBuffer;
+
+namespace {
+
+const ReplayBuffer::TimePoint Origin = std::chrono::steady_clock::time_point{} + 1000h;
+
+std::vector<int> GetValues(const ReplayBuffer& buffer) {
+    std::vector<int> result;
+    for (std::size_t index = 0; index < buffer.Count(); ++index) {
+        result.push_back(std::any_cast<int>(buffer[index].value));
+    }
+    return result;
+}
+
+}
+
+TEST(ReplayBufferTest, Unbounded) {
+
+    ReplayBuffer buffer{ std::nullopt };
+    ASSERT_EQ(buffer.Count(), 0);
+
+    std::vector<int> expected;
+    for (int value = 0; value < 100; ++value) {
+        buffer.PushBack(value, Origin);
+        expected.push_back(value);
+    }
+    ASSERT_EQ(GetValues(buffer), expected);
+}
+
+
+TEST(ReplayBufferTest, Bounded) {
+
+    ReplayBuffer buffer{ 3 };
+    buffer.PushBack(1, Origin);
+    buffer.PushBack(2, Origin);
+    ASSERT_EQ(GetValues(buffer), (std::vector<int>{ 1, 2 }));
+
+    buffer.PushBack(3, Origin);
+    buffer.PushBack(4, Origin);
+    buffer.PushBack(5, Origin);
+    ASSERT_EQ(GetValues(buffer), (std::vector<int>{ 3, 4, 5 }));
+}
+
+
+TEST(ReplayBufferTest, BoundedGrowsOnDemand) {
+
+    // Storage is not allocated for the max count up front.
+    ReplayBuffer buffer{ 1'000'000 };
+    ASSERT_EQ(buffer.Capacity(), 0);
+
+    buffer.PushBack(1, Origin);
+    buffer.PushBack(2, Origin);
+    ASSERT_LT(buffer.Capacity(), 1'000'000);
+
+    // Storage never grows beyond the max count.
+    ReplayBuffer small_buffer{ 20 };
+    std::vector<int> expected;
+    for (int value = 0; value < 50; ++value) {
+        small_buffer.PushBack(value, Origin);
+        if (value >= 30) {
+            expected.push_back(value);
+        }
+    }
+    ASSERT_EQ(small_buffer.Capacity(), 20);
+    ASSERT_EQ(GetValues(small_buffer), expected);
+}
+
+
+TEST(ReplayBufferTest, ZeroMaxCount) {
+
+    ReplayBuffer buffer{ 0 };
+    buffer.PushBack(1, Origin);
+    ASSERT_EQ(buffer.Count(), 0);
+}
+
+
+TEST(ReplayBufferTest, DropBefore) {
+
+    ReplayBuffer buffer{ std::nullopt };
+    buffer.PushBack(1, Origin);
+    buffer.PushBack(2, Origin + 10ms);
+    buffer.PushBack(3, Origin + 20ms);
+
+    buffer.DropBefore(Origin + 10ms);
+    ASSERT_EQ(GetValues(buffer), (std::vector<int>{ 2, 3 }));
+
+    // Growing after dropping keeps the order.
+    for (int value = 4; value < 40; ++value) {
+        buffer.PushBack(value, Origin + 30ms);
+    }
+    ASSERT_EQ(buffer.Count(), 38);
+    ASSERT_EQ(std::any_cast<int>(buffer[0].value), 2);
+    ASSERT_EQ(std::any_cast<int>(buffer[37].value), 39);
+
+    buffer.DropBefore(Origin + 1h);
+    ASSERT_EQ(buffer.Count(), 0);
+}
\ No newline at end of file
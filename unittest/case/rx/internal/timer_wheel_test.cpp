@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <gtest/gtest.h>
+#include <zaf/rx/internal/thread/timer_wheel.h>
+
+using namespace std::chrono_literals;
+using zaf::rx::internal::TimerWheel;
+
+namespace {
+
+using TimePoint = std::chrono::steady_clock::time_point;
+
+const TimePoint Origin = std::chrono::steady_clock::time_point{} + 1000h;
+
+std::vector<int> TakeDueValues(TimerWheel<int>& wheel, TimePoint now) {
+    std::vector<int> result;
+    wheel.TakeDueValues(now, [&result](int&& value) {
+        result.push_back(value);
+    });
+    return result;
+}
+
+}
+
+TEST(TimerWheelTest, Empty) {
+
+    TimerWheel<int> wheel(Origin);
+    ASSERT_TRUE(wheel.IsEmpty());
+    ASSERT_EQ(wheel.Count(), 0);
+    ASSERT_FALSE(wheel.NextTimePoint().has_value());
+    ASSERT_TRUE(TakeDueValues(wheel, Origin + 1h).empty());
+}
+
+
+TEST(TimerWheelTest, TakeDueValues) {
+
+    TimerWheel<int> wheel(Origin);
+    wheel.Insert(Origin + 30ms, 3);
+    wheel.Insert(Origin + 10ms, 1);
+    wheel.Insert(Origin + 20ms, 2);
+    ASSERT_EQ(wheel.Count(), 3);
+
+    ASSERT_TRUE(TakeDueValues(wheel, Origin + 9ms).empty());
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 10ms), std::vector<int>{ 1 });
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 35ms), (std::vector<int>{ 2, 3 }));
+    ASSERT_TRUE(wheel.IsEmpty());
+}
+
+
+TEST(TimerWheelTest, NeverTakeBeforeDue) {
+
+    TimerWheel<int> wheel(Origin);
+    wheel.Insert(Origin + 10ms + 500us, 1);
+
+    // The value belongs to the 11th tick, and it is not due at the end of the 10th tick.
+    ASSERT_TRUE(TakeDueValues(wheel, Origin + 10ms + 400us).empty());
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 11ms), std::vector<int>{ 1 });
+}
+
+
+TEST(TimerWheelTest, SameTimePoint) {
+
+    TimerWheel<int> wheel(Origin);
+
+    // The first value is far enough to be placed in a higher level, while the others are placed
+    // in the bottom level after the wheel advances. They should still be taken in FIFO order.
+    wheel.Insert(Origin + 5s, 1);
+    TakeDueValues(wheel, Origin + 4990ms);
+    wheel.Insert(Origin + 5s, 2);
+    wheel.Insert(Origin + 5s, 3);
+
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 5s), (std::vector<int>{ 1, 2, 3 }));
+}
+
+
+TEST(TimerWheelTest, SameTickDifferentTimePoints) {
+
+    TimerWheel<int> wheel(Origin);
+    wheel.Insert(Origin + 10ms, 3);
+    wheel.Insert(Origin + 9ms + 500us, 2);
+    wheel.Insert(Origin + 9ms + 100us, 1);
+
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 10ms), (std::vector<int>{ 1, 2, 3 }));
+}
+
+
+TEST(TimerWheelTest, InsertPastTimePoint) {
+
+    TimerWheel<int> wheel(Origin);
+    wheel.Insert(Origin + 100ms, 3);
+    TakeDueValues(wheel, Origin + 50ms);
+
+    wheel.Insert(Origin + 40ms, 2);
+    wheel.Insert(Origin - 1s, 1);
+    ASSERT_EQ(wheel.NextTimePoint(), Origin - 1s);
+
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 50ms), (std::vector<int>{ 1, 2 }));
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 100ms), std::vector<int>{ 3 });
+}
+
+
+TEST(TimerWheelTest, Erase) {
+
+    TimerWheel<int> wheel(Origin);
+    auto handle1 = wheel.Insert(Origin + 10ms, 1);
+    auto handle2 = wheel.Insert(Origin + 10min, 2);
+    auto handle3 = wheel.Insert(Origin + 100h, 3);
+    wheel.Insert(Origin + 10ms, 4);
+    ASSERT_EQ(wheel.Count(), 4);
+
+    wheel.Erase(handle1);
+    wheel.Erase(handle2);
+    wheel.Erase(handle3);
+    ASSERT_EQ(wheel.Count(), 1);
+
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 200h), std::vector<int>{ 4 });
+    ASSERT_TRUE(wheel.IsEmpty());
+    ASSERT_FALSE(wheel.NextTimePoint().has_value());
+}
+
+
+TEST(TimerWheelTest, NextTimePoint) {
+
+    TimerWheel<int> wheel(Origin);
+    wheel.Insert(Origin + 10ms, 1);
+    ASSERT_EQ(wheel.NextTimePoint(), Origin + 10ms);
+
+    wheel.Insert(Origin + 5ms, 2);
+    ASSERT_EQ(wheel.NextTimePoint(), Origin + 5ms);
+
+    TakeDueValues(wheel, Origin + 10ms);
+
+    // A value in a higher level, the returned time point is not later than the actual one.
+    wheel.Insert(Origin + 1min, 3);
+    auto next_time_point = wheel.NextTimePoint();
+    ASSERT_TRUE(next_time_point.has_value());
+    ASSERT_LE(*next_time_point, Origin + 1min);
+}
+
+
+TEST(TimerWheelTest, LongIdleAndOverflow) {
+
+    TimerWheel<int> wheel(Origin);
+    wheel.Insert(Origin + 24h * 30, 2);
+    wheel.Insert(Origin + 10h, 1);
+
+    ASSERT_TRUE(TakeDueValues(wheel, Origin + 9h).empty());
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 10h), std::vector<int>{ 1 });
+    ASSERT_TRUE(TakeDueValues(wheel, Origin + 24h * 29).empty());
+    ASSERT_EQ(TakeDueValues(wheel, Origin + 24h * 31), std::vector<int>{ 2 });
+}
+
+
+TEST(TimerWheelTest, TakeAllValues) {
+
+    TimerWheel<int> wheel(Origin);
+    wheel.Insert(Origin + 1ms, 1);
+    wheel.Insert(Origin + 1h, 2);
+    wheel.Insert(Origin + 1000h, 3);
+
+    std::vector<int> values;
+    wheel.TakeAllValues([&values](int&& value) {
+        values.push_back(value);
+    });
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(values, (std::vector<int>{ 1, 2, 3 }));
+    ASSERT_TRUE(wheel.IsEmpty());
+}
+
+
+TEST(TimerWheelTest, RandomOperations) {
+
+    TimerWheel<int> wheel(Origin);
+
+    // The reference keeps values ordered by (time point, inserting order).
+    std::map<std::pair<TimePoint, int>, TimerWheel<int>::Handle> reference;
+
+    std::mt19937 random_engine(42);
+    std::uniform_int_distribution<int> delay_distribution(0, 20'000'000);
+    std::uniform_int_distribution<int> step_distribution(0, 50'000);
+    std::uniform_int_distribution<int> action_distribution(0, 9);
+
+    auto now = Origin;
+    int next_value = 0;
+
+    for (int round = 0; round < 20'000; ++round) {
+
+        auto action = action_distribution(random_engine);
+        if (action < 6) {
+
+            // Delays spread from microseconds to hours, with some in the past.
+            auto delay = std::chrono::microseconds(delay_distribution(random_engine)) *
+                (action == 0 ? 1000 : 1) - 1ms;
+
+            auto time_point = now + delay;
+            auto handle = wheel.Insert(time_point, next_value);
+            reference.emplace(std::make_pair(time_point, next_value), handle);
+            next_value++;
+        }
+        else if (action < 8) {
+
+            if (!reference.empty()) {
+                auto iterator = reference.begin();
+                std::advance(iterator, step_distribution(random_engine) % reference.size());
+                wheel.Erase(iterator->second);
+                reference.erase(iterator);
+            }
+        }
+        else {
+
+            now += std::chrono::microseconds(step_distribution(random_engine)) *
+                (action == 9 ? 100 : 1);
+
+            // Values are taken at tick granularity, so only values before the beginning of the
+            // current tick are expected.
+            auto tick_begin = Origin + std::chrono::floor<std::chrono::milliseconds>(now - Origin);
+
+            std::vector<int> expected;
+            while (!reference.empty() && reference.begin()->first.first <= tick_begin) {
+                expected.push_back(reference.begin()->first.second);
+                reference.erase(reference.begin());
+            }
+
+            ASSERT_EQ(TakeDueValues(wheel, now), expected);
+        }
+
+        ASSERT_EQ(wheel.Count(), reference.size());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <zaf/rx/scheduler/scheduler.h>
+
+/*
+A scheduler that queues works, including delayed works, until they are run explicitly by the test.
+It has a virtual clock which is advanced only by AdvanceTime().
+*/
+class ManualScheduler : public zaf::rx::Scheduler {
+public:
+    std::shared_ptr<zaf::rx::Disposable> ScheduleWork(zaf::Closure work) override {
+        return ScheduleDelayedWork(std::chrono::steady_clock::duration::zero(), std::move(work));
+    }
+
+    std::shared_ptr<zaf::rx::Disposable> ScheduleDelayedWork(
+        std::chrono::steady_clock::duration delay,
+        zaf::Closure work) override {
+
+        works_.push_back({ now_ + delay, std::move(work) });
+        ++scheduled_work_count_;
+        return zaf::rx::Disposable::Empty();
+    }
+
+    std::chrono::steady_clock::time_point Now() const noexcept override {
+        return now_;
+    }
+
+    std::size_t WorkCount() const {
+        return works_.size();
+    }
+
+    //The total number of works that have been scheduled.
+    std::size_t ScheduledWorkCount() const {
+        return scheduled_work_count_;
+    }
+
+    /*
+    Runs the works that are queued at the time of calling, regardless of their delays. Works
+    scheduled by these works are queued for the next call.
+    */
+    void RunPendingWorks() {
+        auto works = std::move(works_);
+        works_.clear();
+        for (const auto& each_work : works) {
+            each_work.work();
+        }
+    }
+
+    /*
+    Advances the virtual clock, and runs the works that become due in order, including those
+    scheduled by the running works.
+    */
+    void AdvanceTime(std::chrono::steady_clock::duration duration) {
+
+        auto target_time = now_ + duration;
+        while (true) {
+
+            auto iterator = std::min_element(works_.begin(), works_.end(),
+                [](const auto& work1, const auto& work2) {
+                    return work1.due_time < work2.due_time;
+                });
+
+            if (iterator == works_.end() || iterator->due_time > target_time) {
+                break;
+            }
+
+            auto work = std::move(*iterator);
+            works_.erase(iterator);
+            now_ = (std::max)(now_, work.due_time);
+            work.work();
+        }
+        now_ = target_time;
+    }
+
+private:
+    struct Work {
+        std::chrono::steady_clock::time_point due_time;
+        zaf::Closure work;
+    };
+
+private:
+    std::deque<Work> works_;
+    std::chrono::steady_clock::time_point now_;
+    std::size_t scheduled_work_count_{};
+};
\ No newline at end of file
@@ -1,8 +1,13 @@
+#include <future>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <gtest/gtest.h>
+#include <zaf/rx/observable.h>
+#include <zaf/rx/queue_overflow_error.h>
 #include <zaf/rx/scheduler/single_thread_scheduler.h>
 #include <zaf/rx/subject/subject.h>
+#include "case/rx/manual_scheduler.h"
 
 TEST(RxObserveOnTest, ObserveOn) {
 
@@ -55,4 +60,232 @@ TEST(RxObserveOnTest, ObserveOn) {
     ASSERT_NE(current_thread, on_next_thread);
     ASSERT_NE(current_thread, on_error_thread);
     ASSERT_NE(current_thread, on_completed_thread);
+}
+
+
+TEST(RxObserveOnTest, ObserveOnWithQueue_Batching) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+
+    zaf::rx::Subject<int> subject;
+    auto observable = subject.AsObservable().ObserveOn(
+        scheduler, 
+        10, 
+        zaf::rx::OverflowPolicy::Error);
+
+    std::vector<int> values;
+    bool is_completed{};
+    auto sub = observable.Subscribe([&](int value) {
+        values.push_back(value);
+    },
+    [&]() {
+        is_completed = true;
+    });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+    subject.AsObserver().OnCompleted();
+
+    //Only one drain work is scheduled for all emissions.
+    ASSERT_EQ(scheduler->WorkCount(), 1);
+    ASSERT_TRUE(values.empty());
+
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(values, (std::vector<int>{ 1, 2, 3 }));
+    ASSERT_TRUE(is_completed);
+
+    //Emissions after the drain schedule a new work.
+    zaf::rx::Subject<int> subject2;
+    auto sub2 = subject2.AsObservable().ObserveOn(scheduler, 10, zaf::rx::OverflowPolicy::Error)
+        .Subscribe([&](int value) { values.push_back(value); });
+
+    subject2.AsObserver().OnNext(4);
+    scheduler->RunPendingWorks();
+    subject2.AsObserver().OnNext(5);
+    ASSERT_EQ(scheduler->WorkCount(), 1);
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(values, (std::vector<int>{ 1, 2, 3, 4, 5 }));
+}
+
+
+TEST(RxObserveOnTest, ObserveOnWithQueue_DropOldest) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+
+    zaf::rx::Subject<int> subject;
+    std::vector<int> values;
+    auto sub = subject.AsObservable()
+        .ObserveOn(scheduler, 2, zaf::rx::OverflowPolicy::DropOldest)
+        .Subscribe([&](int value) { values.push_back(value); });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+    subject.AsObserver().OnNext(4);
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(values, (std::vector<int>{ 3, 4 }));
+}
+
+
+TEST(RxObserveOnTest, ObserveOnWithQueue_DropNewest) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+
+    zaf::rx::Subject<int> subject;
+    std::vector<int> values;
+    auto sub = subject.AsObservable()
+        .ObserveOn(scheduler, 2, zaf::rx::OverflowPolicy::DropNewest)
+        .Subscribe([&](int value) { values.push_back(value); });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+    subject.AsObserver().OnNext(4);
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(values, (std::vector<int>{ 1, 2 }));
+}
+
+
+TEST(RxObserveOnTest, ObserveOnWithQueue_Error) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+
+    zaf::rx::Subject<int> subject;
+    std::vector<int> values;
+    bool has_overflow_error{};
+    auto sub = subject.AsObservable()
+        .ObserveOn(scheduler, 2, zaf::rx::OverflowPolicy::Error)
+        .Subscribe([&](int value) { 
+            values.push_back(value); 
+        }, 
+        [&](const std::exception_ptr& error) {
+            try {
+                std::rethrow_exception(error);
+            }
+            catch (const zaf::rx::QueueOverflowError&) {
+                has_overflow_error = true;
+            }
+        });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+    subject.AsObserver().OnNext(4);
+    ASSERT_FALSE(has_overflow_error);
+
+    //Pending items are emitted before the error.
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(values, (std::vector<int>{ 1, 2 }));
+    ASSERT_TRUE(has_overflow_error);
+}
+
+
+TEST(RxObserveOnTest, ObserveOnWithQueue_ErrorDuringSubscribing) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+
+    std::optional<zaf::rx::Subscriber<int>> source_subscriber;
+    auto source = zaf::rx::Observable<int>::Create([&](zaf::rx::Subscriber<int> subscriber) {
+        subscriber.OnNext(1);
+        subscriber.OnNext(2);
+        subscriber.OnNext(3);
+        source_subscriber = subscriber;
+    });
+
+    auto sub = source
+        .ObserveOn(scheduler, 2, zaf::rx::OverflowPolicy::Error)
+        .Subscribe([](int) {}, [](const std::exception_ptr&) {});
+
+    //The source is disposed even if it overflows before the subscribing finishes.
+    ASSERT_TRUE(source_subscriber->IsDisposed());
+}
+
+
+TEST(RxObserveOnTest, ObserveOnWithQueue_Block) {
+
+    constexpr int item_count = 1000;
+
+    zaf::rx::Subject<int> subject;
+    std::vector<int> values;
+    std::promise<void> completed_promise;
+    auto sub = subject.AsObservable()
+        .ObserveOn(
+            std::make_shared<zaf::rx::SingleThreadScheduler>(), 
+            4, 
+            zaf::rx::OverflowPolicy::Block)
+        .Subscribe([&](int value) {
+            values.push_back(value);
+        },
+        [&]() {
+            completed_promise.set_value();
+        });
+
+    for (int index = 0; index < item_count; ++index) {
+        subject.AsObserver().OnNext(index);
+    }
+    subject.AsObserver().OnCompleted();
+    completed_promise.get_future().wait();
+
+    //No item is lost.
+    ASSERT_EQ(values.size(), item_count);
+    for (int index = 0; index < item_count; ++index) {
+        ASSERT_EQ(values[index], index);
+    }
+}
+
+
+TEST(RxObserveOnTest, ObserveOnWithQueue_Dispose) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+
+    zaf::rx::Subject<int> subject;
+    std::vector<int> values;
+    auto sub = subject.AsObservable()
+        .ObserveOn(scheduler, 2, zaf::rx::OverflowPolicy::DropNewest)
+        .Subscribe([&](int value) { values.push_back(value); });
+
+    subject.AsObserver().OnNext(1);
+    sub->Dispose();
+    scheduler->RunPendingWorks();
+    ASSERT_TRUE(values.empty());
+}
+
+TEST(RxObserveOnTest, ObserveOnWithQueue_TerminateDuringDrain) {
+
+    zaf::rx::Subject<int> subject;
+    std::promise<void> drain_started_promise;
+    std::promise<void> terminated_promise;
+    auto terminated_future = terminated_promise.get_future().share();
+    std::promise<void> completed_promise;
+    std::vector<int> values;
+
+    auto sub = subject.AsObservable()
+        .ObserveOn(
+            std::make_shared<zaf::rx::SingleThreadScheduler>(),
+            10,
+            zaf::rx::OverflowPolicy::Error)
+        .Subscribe([&](int value) {
+            values.push_back(value);
+            //Keep the drain busy until the source is completed.
+            if (value == 1) {
+                drain_started_promise.set_value();
+                terminated_future.wait();
+            }
+        },
+        [&]() {
+            completed_promise.set_value();
+        });
+
+    subject.AsObserver().OnNext(1);
+    drain_started_promise.get_future().wait();
+
+    subject.AsObserver().OnCompleted();
+    terminated_promise.set_value();
+
+    auto completed_future = completed_promise.get_future();
+    ASSERT_EQ(
+        completed_future.wait_for(std::chrono::seconds(5)), 
+        std::future_status::ready);
+    ASSERT_EQ(values, std::vector<int>{ 1 });
 }
\ No newline at end of file
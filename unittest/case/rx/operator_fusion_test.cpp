@@ -0,0 +1,154 @@
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <zaf/rx/internal/insider/observable_insider.h>
+#include <zaf/rx/internal/operator/fused_operator.h>
+#include <zaf/rx/subject/subject.h>
+
+TEST(RxOperatorFusionTest, FuseAdjacentStages) {
+
+    zaf::rx::Subject<int> subject;
+    auto source = subject.AsObservable();
+
+    auto observable = source
+        .Filter([](int value) { return value > 0; })
+        .Map<int>([](int value) { return value * 2; })
+        .Do([](int) {})
+        .Map<std::string>([](int value) { return std::to_string(value); });
+
+    const auto& core = zaf::rx::internal::ObservableInsider::GetCore(observable);
+    auto fused_core = std::dynamic_pointer_cast<zaf::rx::internal::FusedOperator>(core);
+    ASSERT_NE(fused_core, nullptr);
+
+    std::vector<std::string> values;
+    auto sub = observable.Subscribe([&](const std::string& value) {
+        values.push_back(value);
+    });
+
+    subject.AsObserver().OnNext(-1);
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    ASSERT_EQ(values, (std::vector<std::string>{ "2", "4" }));
+}
+
+
+TEST(RxOperatorFusionTest, ReuseIntermediateObservable) {
+
+    zaf::rx::Subject<int> subject;
+    auto intermediate = subject.AsObservable().Map<int>([](int value) { return value + 1; });
+    auto observable1 = intermediate.Map<int>([](int value) { return value * 10; });
+    auto observable2 = intermediate.Filter([](int value) { return value % 2 == 0; });
+
+    std::vector<int> intermediate_values;
+    std::vector<int> values1;
+    std::vector<int> values2;
+    auto sub0 = intermediate.Subscribe([&](int value) { intermediate_values.push_back(value); });
+    auto sub1 = observable1.Subscribe([&](int value) { values1.push_back(value); });
+    auto sub2 = observable2.Subscribe([&](int value) { values2.push_back(value); });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+
+    ASSERT_EQ(intermediate_values, (std::vector<int>{ 2, 3 }));
+    ASSERT_EQ(values1, (std::vector<int>{ 20, 30 }));
+    ASSERT_EQ(values2, (std::vector<int>{ 2 }));
+}
+
+
+// Exception thrown in a stage should be sent to the OnError handlers of the following Do stages
+// only.
+TEST(RxOperatorFusionTest, ErrorPassesThroughFollowingStages) {
+
+    zaf::rx::Subject<int> subject;
+
+    std::vector<std::string> events;
+    auto sub = subject.AsObservable()
+        .DoOnError([&](const std::exception_ptr&) { events.push_back("before"); })
+        .Map<int>([](int value) {
+            if (value == 2) {
+                throw std::string{ "map" };
+            }
+            return value;
+        })
+        .DoOnError([&](const std::exception_ptr&) {
+            events.push_back("after");
+            throw std::string{ "replaced" };
+        })
+        .Subscribe([&](int value) {
+            events.push_back(std::to_string(value));
+        },
+        [&](const std::exception_ptr& error) {
+            try {
+                std::rethrow_exception(error);
+            }
+            catch (const std::string& string) {
+                events.push_back(string);
+            }
+        });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    subject.AsObserver().OnNext(3);
+
+    ASSERT_EQ(events, (std::vector<std::string>{ "1", "after", "replaced" }));
+}
+
+
+TEST(RxOperatorFusionTest, ThrowInDoOnCompleted) {
+
+    zaf::rx::Subject<int> subject;
+
+    std::vector<std::string> events;
+    auto sub = subject.AsObservable()
+        .DoOnCompleted([&]() {
+            events.push_back("completed");
+            throw std::string{ "error" };
+        })
+        .DoOnError([&](const std::exception_ptr&) { events.push_back("do_error"); })
+        .Subscribe([](int) {},
+        [&](const std::exception_ptr&) {
+            events.push_back("error");
+        },
+        [&]() {
+            events.push_back("unexpected");
+        });
+
+    subject.AsObserver().OnCompleted();
+    ASSERT_EQ(events, (std::vector<std::string>{ "completed", "do_error", "error" }));
+}
+
+
+TEST(RxOperatorFusionTest, DISABLED_Benchmark_StageCount) {
+
+    constexpr int element_count = 1'000'000;
+
+    int sum{};
+    auto measure = [&](zaf::rx::Observable<int> observable, zaf::rx::Subject<int>& subject) {
+        auto sub = observable.Subscribe([&](int value) { sum += value; });
+        auto begin = std::chrono::steady_clock::now();
+        for (int index = 0; index < element_count; ++index) {
+            subject.AsObserver().OnNext(index);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(
+            std::chrono::steady_clock::now() - begin);
+        return elapsed.count() / element_count;
+    };
+
+    zaf::rx::Subject<int> subject;
+    auto one_stage = subject.AsObservable().Map<int>([](int value) { return value + 1; });
+    auto five_stages = subject.AsObservable()
+        .Filter([](int) { return true; })
+        .Map<int>([](int value) { return value + 1; })
+        .Do([](int) {})
+        .Map<int>([](int value) { return value - 1; })
+        .Filter([](int) { return true; });
+
+    auto one_stage_cost = measure(one_stage, subject);
+    auto five_stages_cost = measure(five_stages, subject);
+
+    std::printf(
+        "1 stage: %.1f ns/element\n5 stages: %.1f ns/element\n(checksum %d)\n",
+        one_stage_cost,
+        five_stages_cost,
+        sum);
+}
\ No newline at end of file
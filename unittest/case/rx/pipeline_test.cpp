@@ -0,0 +1,325 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <gtest/gtest.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/rx/pipeline.h>
+#include <zaf/rx/subject/subject.h>
+
+TEST(RxPipelineTest, Precondition) {
+
+    zaf::rx::Subject<int> subject;
+    auto pipeline = zaf::rx::Pipe(subject.AsObservable());
+    ASSERT_THROW(pipeline.Map(std::function<int(const int&)>{}), zaf::PreconditionError);
+    ASSERT_THROW(pipeline.Filter(std::function<bool(const int&)>{}), zaf::PreconditionError);
+    ASSERT_THROW(pipeline.Do(std::function<void(const int&)>{}), zaf::PreconditionError);
+    ASSERT_THROW(auto sub = pipeline.Subscribe(nullptr), zaf::PreconditionError);
+}
+
+
+TEST(RxPipelineTest, Subscribe) {
+
+    zaf::rx::Subject<int> subject;
+
+    std::vector<int> do_values;
+    std::vector<std::string> values;
+    int error_count{};
+    int completed_count{};
+    auto sub = zaf::rx::Pipe(subject.AsObservable())
+        .Filter([](int value) {
+            return value % 2 == 0;
+        })
+        .Do([&](int value) {
+            do_values.push_back(value);
+        })
+        .Map([](int value) {
+            return value * 10;
+        })
+        .Map([](int value) {
+            return std::to_string(value);
+        })
+        .Subscribe([&](const std::string& value) {
+            values.push_back(value);
+        },
+        [&](const std::exception_ptr&) {
+            error_count++;
+        },
+        [&]() {
+            completed_count++;
+        });
+
+    for (int value = 0; value < 6; ++value) {
+        subject.AsObserver().OnNext(value);
+    }
+    subject.AsObserver().OnCompleted();
+
+    ASSERT_EQ(do_values, (std::vector<int>{ 0, 2, 4 }));
+    ASSERT_EQ(values, (std::vector<std::string>{ "0", "20", "40" }));
+    ASSERT_EQ(error_count, 0);
+    ASSERT_EQ(completed_count, 1);
+}
+
+
+TEST(RxPipelineTest, AsObservable) {
+
+    zaf::rx::Subject<int> subject;
+
+    auto observable = zaf::rx::Pipe(subject.AsObservable())
+        .Map([](int value) {
+            return std::to_wstring(value);
+        })
+        .Filter([](const std::wstring& value) {
+            return value.length() > 1;
+        })
+        .AsObservable();
+
+    std::vector<std::wstring> values;
+    int completed_count{};
+    auto sub = observable.Map<std::size_t>([](const std::wstring& value) {
+        return value.length();
+    })
+    .Subscribe([&](std::size_t value) {
+        values.push_back(std::to_wstring(value));
+    },
+    [&]() {
+        completed_count++;
+    });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(12);
+    subject.AsObserver().OnNext(123);
+    subject.AsObserver().OnCompleted();
+
+    ASSERT_EQ(values, (std::vector<std::wstring>{ L"2", L"3" }));
+    ASSERT_EQ(completed_count, 1);
+}
+
+
+TEST(RxPipelineTest, ThrowInStage) {
+
+    auto test = [](auto create_pipeline) {
+
+        zaf::rx::Subject<int> subject;
+
+        std::vector<int> values;
+        std::string error;
+        auto sub = create_pipeline(subject.AsObservable()).Subscribe([&](int value) {
+            values.push_back(value);
+        },
+        [&](const std::exception_ptr& exception) {
+            try {
+                std::rethrow_exception(exception);
+            }
+            catch (const std::string& string) {
+                error = string;
+            }
+        },
+        nullptr);
+
+        subject.AsObserver().OnNext(1);
+        subject.AsObserver().OnNext(2);
+        subject.AsObserver().OnNext(3);
+        return std::make_pair(values, error);
+    };
+
+    auto result = test([](const zaf::rx::Observable<int>& observable) {
+        return zaf::rx::Pipe(observable).Map([](int value) {
+            if (value == 2) {
+                throw std::string{ "map" };
+            }
+            return value;
+        });
+    });
+    ASSERT_EQ(result.first, std::vector<int>{ 1 });
+    ASSERT_EQ(result.second, "map");
+
+    result = test([](const zaf::rx::Observable<int>& observable) {
+        return zaf::rx::Pipe(observable).Filter([](int value) {
+            if (value == 2) {
+                throw std::string{ "filter" };
+            }
+            return true;
+        });
+    });
+    ASSERT_EQ(result.first, std::vector<int>{ 1 });
+    ASSERT_EQ(result.second, "filter");
+
+    result = test([](const zaf::rx::Observable<int>& observable) {
+        return zaf::rx::Pipe(observable).Do([](int value) {
+            if (value == 2) {
+                throw std::string{ "do" };
+            }
+        });
+    });
+    ASSERT_EQ(result.first, std::vector<int>{ 1 });
+    ASSERT_EQ(result.second, "do");
+}
+
+
+TEST(RxPipelineTest, Dispose) {
+
+    zaf::rx::Subject<int> subject;
+
+    std::vector<int> values;
+    auto sub = zaf::rx::Pipe(subject.AsObservable())
+        .Map([](int value) {
+            return value + 1;
+        })
+        .Subscribe([&](int value) {
+            values.push_back(value);
+        });
+
+    subject.AsObserver().OnNext(1);
+    sub->Dispose();
+    subject.AsObserver().OnNext(2);
+
+    ASSERT_EQ(values, std::vector<int>{ 2 });
+}
+
+
+TEST(RxPipelineTest, ReleaseStagesOnTermination) {
+
+    auto test = [](const std::function<void(
+        zaf::rx::Subject<int>&,
+        const std::shared_ptr<zaf::rx::Disposable>&)>& terminate) {
+
+        zaf::rx::Subject<int> subject;
+
+        auto resource = std::make_shared<int>();
+        std::weak_ptr<int> weak_resource = resource;
+
+        auto sub = zaf::rx::Pipe(subject.AsObservable())
+            .Map([resource](int value) {
+                return value + *resource;
+            })
+            .Subscribe([resource](int) { });
+
+        resource.reset();
+        subject.AsObserver().OnNext(1);
+        if (weak_resource.expired()) {
+            return false;
+        }
+
+        terminate(subject, sub);
+        return weak_resource.expired();
+    };
+
+    ASSERT_TRUE(test([](auto& subject, auto&) {
+        subject.AsObserver().OnCompleted();
+    }));
+
+    ASSERT_TRUE(test([](auto& subject, auto&) {
+        subject.AsObserver().OnError(std::make_exception_ptr(std::exception{}));
+    }));
+
+    ASSERT_TRUE(test([](auto&, auto& sub) {
+        sub->Dispose();
+    }));
+}
+
+
+TEST(RxPipelineTest, DisposeInStage) {
+
+    zaf::rx::Subject<int> subject;
+
+    auto resource = std::make_shared<int>(1);
+    std::weak_ptr<int> weak_resource = resource;
+
+    std::shared_ptr<zaf::rx::Disposable> sub;
+    std::vector<int> values;
+    sub = zaf::rx::Pipe(subject.AsObservable())
+        .Do([resource, &sub](int) {
+            sub->Dispose();
+            //The stage is still alive while running.
+            ASSERT_EQ(*resource, 1);
+        })
+        .Subscribe([&values](int value) {
+            values.push_back(value);
+        });
+
+    resource.reset();
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+
+    ASSERT_TRUE(weak_resource.expired());
+    ASSERT_TRUE(values.empty());
+}
+
+
+TEST(RxPipelineTest, DISABLED_Benchmark_PerElementCost) {
+
+    constexpr int element_count = 1'000'000;
+
+    auto measure = [](const auto& emit) {
+        auto begin = std::chrono::steady_clock::now();
+        for (int index = 0; index < element_count; ++index) {
+            emit(index);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(
+            std::chrono::steady_clock::now() - begin);
+        return elapsed.count() / element_count;
+    };
+
+    std::size_t sum{};
+
+    // Observable<int>: Filter -> Map -> Do.
+    double erased_int_cost{};
+    {
+        zaf::rx::Subject<int> subject;
+        auto sub = subject.AsObservable()
+            .Filter([](int value) { return value % 2 == 0; })
+            .Map<int>([](int value) { return value * 3; })
+            .Do([&](int value) { sum += value; })
+            .Subscribe([&](int value) { sum += value; });
+        erased_int_cost = measure([&](int value) { subject.AsObserver().OnNext(value); });
+    }
+
+    double typed_int_cost{};
+    {
+        zaf::rx::Subject<int> subject;
+        auto sub = zaf::rx::Pipe(subject.AsObservable())
+            .Filter([](int value) { return value % 2 == 0; })
+            .Map([](int value) { return value * 3; })
+            .Do([&](int value) { sum += value; })
+            .Subscribe([&](int value) { sum += value; });
+        typed_int_cost = measure([&](int value) { subject.AsObserver().OnNext(value); });
+    }
+
+    // Observable<std::wstring>: Map -> Filter -> Map.
+    const std::wstring prefix(32, L'x');
+    double erased_string_cost{};
+    {
+        zaf::rx::Subject<std::wstring> subject;
+        auto sub = subject.AsObservable()
+            .Map<std::wstring>([](const std::wstring& value) { return value + L"!"; })
+            .Filter([](const std::wstring& value) { return !value.empty(); })
+            .Map<std::size_t>([](const std::wstring& value) { return value.length(); })
+            .Subscribe([&](std::size_t value) { sum += value; });
+        erased_string_cost = measure([&](int value) {
+            subject.AsObserver().OnNext(prefix);
+        });
+    }
+
+    double typed_string_cost{};
+    {
+        zaf::rx::Subject<std::wstring> subject;
+        auto sub = zaf::rx::Pipe(subject.AsObservable())
+            .Map([](const std::wstring& value) { return value + L"!"; })
+            .Filter([](const std::wstring& value) { return !value.empty(); })
+            .Map([](const std::wstring& value) { return value.length(); })
+            .Subscribe([&](std::size_t value) { sum += value; });
+        typed_string_cost = measure([&](int value) {
+            subject.AsObserver().OnNext(prefix);
+        });
+    }
+
+    std::printf(
+        "Observable<int>: %.1f ns/element, Pipeline: %.1f ns/element\n"
+        "Observable<std::wstring>: %.1f ns/element, Pipeline: %.1f ns/element\n"
+        "(checksum %zu)\n",
+        erased_int_cost,
+        typed_int_cost,
+        erased_string_cost,
+        typed_string_cost,
+        sum);
+}
\ No newline at end of file
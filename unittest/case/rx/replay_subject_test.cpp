@@ -1,4 +1,5 @@
 #include <mutex>
+#include <thread>
 #include <gtest/gtest.h>
 #include <zaf/base/error/invalid_operation_error.h>
 #include <zaf/rx/disposable.h>
@@ -99,6 +100,79 @@ TEST(RxReplaySubjectTest, NoneZeroReplaySize) {
 }
 
 
+TEST(RxReplaySubjectTest, ReplayWindow) {
+
+    using namespace std::chrono_literals;
+
+    zaf::rx::ReplaySubject<int> subject{ 100ms };
+    auto observer = subject.AsObserver();
+    observer.OnNext(1);
+    observer.OnNext(2);
+    std::this_thread::sleep_for(150ms);
+    observer.OnNext(3);
+
+    std::vector<int> sequence;
+    auto subscription = subject.AsObservable().Subscribe([&sequence](int value) {
+        sequence.push_back(value);
+    });
+    ASSERT_EQ(sequence, std::vector<int>{ 3 });
+
+    // Values expired when subscribing are not replayed, even if there is no emission after them.
+    std::this_thread::sleep_for(150ms);
+    sequence.clear();
+    auto subscription2 = subject.AsObservable().Subscribe([&sequence](int value) {
+        sequence.push_back(value);
+    });
+    ASSERT_TRUE(sequence.empty());
+}
+
+
+TEST(RxReplaySubjectTest, ReplaySizeAndWindow) {
+
+    using namespace std::chrono_literals;
+
+    zaf::rx::ReplaySubject<int> subject{ 2, 100ms };
+    auto observer = subject.AsObserver();
+    observer.OnNext(1);
+    std::this_thread::sleep_for(150ms);
+    observer.OnNext(2);
+    observer.OnNext(3);
+    observer.OnNext(4);
+
+    std::vector<int> sequence;
+    auto subscription = subject.AsObservable().Subscribe([&sequence](int value) {
+        sequence.push_back(value);
+    });
+    ASSERT_EQ(sequence, (std::vector<int>{ 3, 4 }));
+}
+
+
+TEST(RxReplaySubjectTest, EmitDuringReplay) {
+
+    zaf::rx::ReplaySubject<int> subject{ 3 };
+    auto observer = subject.AsObserver();
+    observer.OnNext(1);
+    observer.OnNext(2);
+    observer.OnNext(3);
+
+    // Values emitted during a replay don't affect the values being replayed.
+    std::vector<int> sequence;
+    auto subscription = subject.AsObservable().Subscribe([&](int value) {
+        sequence.push_back(value);
+        if (value == 1) {
+            observer.OnNext(4);
+        }
+    });
+    ASSERT_EQ(sequence, (std::vector<int>{ 1, 2, 3 }));
+
+    sequence.clear();
+    auto subscription2 = subject.AsObservable().Subscribe([&](int value) {
+        sequence.push_back(value);
+    });
+    ASSERT_EQ(sequence, (std::vector<int>{ 2, 3, 4 }));
+}
+
+
 TEST(RxReplaySubjectTest, ReplayError) {
 
     zaf::rx::ReplaySubject<int> subject;
@@ -1,3 +1,4 @@
+#include <thread>
 #include <gtest/gtest.h>
 #include <zaf/rx/observable.h>
 #include <zaf/rx/subject/subject.h>
@@ -57,4 +58,24 @@ TEST(RxReplayTest, Replay_ReplaySize) {
         on_next_values.push_back(value + 3);
     });
     ASSERT_EQ(on_next_values, (std::vector<int>{ 7, 8, 8, 9, 10 }));
+}
+
+
+TEST(RxReplayTest, Replay_ReplayWindow) {
+
+    using namespace std::chrono_literals;
+
+    zaf::rx::Subject<int> subject;
+    zaf::rx::ConnectableObservable observable = subject.AsObservable().Replay(100ms);
+    auto connect_sub = observable.Connect();
+
+    subject.AsObserver().OnNext(1);
+    std::this_thread::sleep_for(150ms);
+    subject.AsObserver().OnNext(2);
+
+    std::vector<int> on_next_values;
+    auto sub = observable.Subscribe([&](int value) {
+        on_next_values.push_back(value);
+    });
+    ASSERT_EQ(on_next_values, std::vector<int>{ 2 });
 }
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <chrono>
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <zaf/rx/disposable.h>
 #include <zaf/rx/subject/subject.h>
@@ -263,4 +265,69 @@ TEST(RxSubjectTest, SubscriptionCount) {
 
     subscription2->Dispose();
     ASSERT_EQ(subject.Core()->SubscriptionCount(), 0);
+}
+
+
+TEST(RxSubjectTest, ModifySubscriptionsDuringEmission) {
+
+    zaf::rx::Subject<int> subject;
+
+    std::vector<std::string> events;
+    std::shared_ptr<zaf::rx::Disposable> subscription2;
+    std::shared_ptr<zaf::rx::Disposable> subscription3;
+
+    auto subscription1 = subject.AsObservable().Subscribe([&](int value) {
+        events.push_back("1:" + std::to_string(value));
+        if (value == 1) {
+            // Subscribers added during the emission don't receive the current value.
+            subscription3 = subject.AsObservable().Subscribe([&](int value) {
+                events.push_back("3:" + std::to_string(value));
+            });
+            // Subscribers removed during the emission don't receive the current value.
+            subscription2->Dispose();
+        }
+    });
+
+    subscription2 = subject.AsObservable().Subscribe([&](int value) {
+        events.push_back("2:" + std::to_string(value));
+    });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+
+    std::vector<std::string> expected{ "1:1", "1:2", "3:2" };
+    ASSERT_EQ(events, expected);
+    ASSERT_EQ(subject.Core()->SubscriptionCount(), 2);
+}
+
+
+TEST(RxSubjectTest, DISABLED_Benchmark_FanOut) {
+
+    constexpr std::size_t emission_count = 100'000;
+
+    for (std::size_t observer_count : { 1, 10, 100, 1000 }) {
+
+        zaf::rx::Subject<int> subject;
+
+        std::size_t sum{};
+        std::vector<std::shared_ptr<zaf::rx::Disposable>> subscriptions;
+        for (std::size_t index = 0; index < observer_count; ++index) {
+            subscriptions.push_back(subject.AsObservable().Subscribe([&](int value) {
+                sum += value;
+            }));
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        for (std::size_t index = 0; index < emission_count; ++index) {
+            subject.AsObserver().OnNext(1);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(
+            std::chrono::steady_clock::now() - begin);
+
+        std::printf(
+            "%zu observers: %.1f ns/emission (checksum %zu)\n",
+            observer_count,
+            elapsed.count() / emission_count,
+            sum);
+    }
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <zaf/base/error/precondition_error.h>
 #include <zaf/rx/execution_stopped_error.h>
@@ -331,4 +332,218 @@ TEST_F(ThreadPoolSchedulerTest, ScheduleWorkWhileDestructing) {
     scheduler.reset();
 }
 
+
+TEST_F(ThreadPoolSchedulerTest, ConstructorWithQueueMode) {
+
+    zaf::rx::ThreadPoolScheduler scheduler(4, zaf::rx::ThreadPoolQueueMode::WorkStealing);
+    ASSERT_EQ(scheduler.MaxThreadCount(), 4);
+    ASSERT_EQ(scheduler.QueueMode(), zaf::rx::ThreadPoolQueueMode::WorkStealing);
+    ASSERT_EQ(scheduler.CurrentThreadCount(), 0);
+
+    zaf::rx::ThreadPoolScheduler default_mode_scheduler(4);
+    ASSERT_EQ(default_mode_scheduler.QueueMode(), zaf::rx::ThreadPoolQueueMode::SingleQueue);
+
+    ASSERT_THROW(
+        zaf::rx::ThreadPoolScheduler(0, zaf::rx::ThreadPoolQueueMode::WorkStealing), 
+        zaf::PreconditionError);
+}
+
+
+TEST_F(ThreadPoolSchedulerTest, WorkStealing_ScheduleWorkFromPool) {
+
+    zaf::rx::ThreadPoolScheduler scheduler(4, zaf::rx::ThreadPoolQueueMode::WorkStealing);
+
+    std::condition_variable cv;
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+
+    constexpr std::size_t work_count = 1000;
+    std::atomic<std::size_t> executed_count{};
+
+    scheduler.ScheduleWork([&]() {
+        // These works go to the local queue of the current thread and are stolen by other threads.
+        for (std::size_t index = 0; index < work_count; ++index) {
+            scheduler.ScheduleWork([&]() {
+                if (++executed_count == work_count) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    cv.notify_one();
+                }
+            });
+        }
+    });
+
+    cv.wait(lock, [&]() {
+        return executed_count == work_count;
+    });
+    ASSERT_EQ(GetHybridQueueSize(scheduler), 0);
+    ASSERT_GE(scheduler.CurrentThreadCount(), 1);
+    ASSERT_LE(scheduler.CurrentThreadCount(), 4);
+}
+
+
+TEST_F(ThreadPoolSchedulerTest, WorkStealing_StealWorkFromBusyThread) {
+
+    zaf::rx::ThreadPoolScheduler scheduler(2, zaf::rx::ThreadPoolQueueMode::WorkStealing);
+
+    std::condition_variable cv;
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+
+    std::optional<std::thread::id> busy_thread_id;
+    std::optional<std::thread::id> stealing_thread_id;
+
+    scheduler.ScheduleWork([&]() {
+
+        scheduler.ScheduleWork([&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            stealing_thread_id = std::this_thread::get_id();
+            cv.notify_one();
+        });
+
+        // Keep the current thread busy so that the queued work is stolen by another thread.
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        busy_thread_id = std::this_thread::get_id();
+        cv.notify_one();
+    });
+
+    cv.wait(lock, [&]() {
+        return busy_thread_id.has_value() && stealing_thread_id.has_value();
+    });
+    ASSERT_NE(busy_thread_id, stealing_thread_id);
+    ASSERT_EQ(scheduler.CurrentThreadCount(), 2);
+}
+
+
+TEST_F(ThreadPoolSchedulerTest, WorkStealing_CancelQueuedWork) {
+
+    zaf::rx::ThreadPoolScheduler scheduler(1, zaf::rx::ThreadPoolQueueMode::WorkStealing);
+
+    std::condition_variable cv;
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+
+    bool is_executed{};
+    bool is_done{};
+    scheduler.ScheduleWork([&]() {
+
+        // Queued to the local queue of the only thread.
+        auto disposable = scheduler.ScheduleWork([&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            is_executed = true;
+        });
+        disposable->Dispose();
+
+        scheduler.ScheduleWork([&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            is_done = true;
+            cv.notify_one();
+        });
+    });
+
+    cv.wait(lock, [&]() {
+        return is_done;
+    });
+    ASSERT_FALSE(is_executed);
+}
+
+
+TEST_F(ThreadPoolSchedulerTest, WorkStealing_Destruct) {
+
+    std::optional<zaf::rx::ThreadPoolScheduler> scheduler;
+    scheduler.emplace(2, zaf::rx::ThreadPoolQueueMode::WorkStealing);
+
+    std::atomic<std::size_t> executed_count{};
+    scheduler->ScheduleWork([&]() {
+        for (int count = 0; count < 4; ++count) {
+            scheduler->ScheduleWork([&]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                ++executed_count;
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    });
+
+    // Wait a moment to ensure the works are scheduled to the local queue.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // This destructs the scheduler and waits all works in local queues done.
+    scheduler.reset();
+    ASSERT_EQ(executed_count, 4);
+}
+
+
+TEST_F(ThreadPoolSchedulerTest, WorkStealing_ScheduleWorkWhileDestructing) {
+
+    std::optional<zaf::rx::ThreadPoolScheduler> scheduler;
+    scheduler.emplace(2, zaf::rx::ThreadPoolQueueMode::WorkStealing);
+
+    scheduler->ScheduleWork([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        // Posting new works to the scheduler from the pool while it is destructing.
+        ASSERT_THROW(scheduler->ScheduleWork([]() {}), zaf::rx::ExecutionStoppedError);
+    });
+
+    scheduler.reset();
+}
+
+
+/*
+Compares the throughput of the two queue modes. Disabled by default as it is a benchmark rather
+than a test. Run it with --gtest_also_run_disabled_tests.
+*/
+TEST_F(ThreadPoolSchedulerTest, DISABLED_Benchmark_QueueModeThroughput) {
+
+    constexpr std::size_t producer_count = 8;
+    constexpr std::size_t work_count_per_producer = 100'000;
+
+    auto run = [&](zaf::rx::ThreadPoolQueueMode mode) {
+
+        zaf::rx::ThreadPoolScheduler scheduler(
+            std::max(std::thread::hardware_concurrency(), 1u),
+            mode);
+
+        std::condition_variable cv;
+        std::mutex mutex;
+        std::atomic<std::size_t> executed_count{};
+        constexpr auto total_count = producer_count * work_count_per_producer;
+
+        auto begin = std::chrono::steady_clock::now();
+
+        // Each producer is a work in the pool which fans out small works, like a background
+        // pipeline does.
+        for (std::size_t producer = 0; producer < producer_count; ++producer) {
+            scheduler.ScheduleWork([&]() {
+                for (std::size_t index = 0; index < work_count_per_producer; ++index) {
+                    scheduler.ScheduleWork([&]() {
+                        if (++executed_count == total_count) {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            cv.notify_one();
+                        }
+                    });
+                }
+            });
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() {
+            return executed_count == total_count;
+        });
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - begin);
+        return total_count / elapsed.count();
+    };
+
+    auto single_queue_throughput = run(zaf::rx::ThreadPoolQueueMode::SingleQueue);
+    auto work_stealing_throughput = run(zaf::rx::ThreadPoolQueueMode::WorkStealing);
+
+    std::printf(
+        "SingleQueue: %.0f works/s\nWorkStealing: %.0f works/s\n",
+        single_queue_throughput,
+        work_stealing_throughput);
+}
+
 }
\ No newline at end of file
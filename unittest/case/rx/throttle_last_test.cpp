@@ -2,6 +2,7 @@
 #include <zaf/base/error/precondition_error.h>
 #include <zaf/rx/scheduler/single_thread_scheduler.h>
 #include <zaf/rx/subject/subject.h>
+#include "case/rx/manual_scheduler.h"
 
 TEST(RxThrottleLastTest, PreconditionError) {
 
@@ -197,4 +198,31 @@ TEST(RxThrottleLastTest, OnCompletedThread) {
 
     ASSERT_EQ(on_next_thread_id, std::this_thread::get_id());
     ASSERT_EQ(on_completed_thread_id, std::this_thread::get_id());
+}
+
+
+TEST(RxThrottleLastTest, OneTimerPerPeriod) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+    zaf::rx::Subject<int> subject;
+
+    std::vector<int> values;
+    auto sub = subject.AsObservable()
+        .ThrottleLast(std::chrono::milliseconds(10), scheduler)
+        .Subscribe([&](int value) {
+            values.push_back(value);
+        });
+
+    for (int value = 0; value < 100; ++value) {
+        subject.AsObserver().OnNext(value);
+    }
+    ASSERT_EQ(scheduler->ScheduledWorkCount(), 1);
+
+    scheduler->AdvanceTime(std::chrono::milliseconds(10));
+    ASSERT_EQ(values, (std::vector<int>{ 99 }));
+
+    subject.AsObserver().OnNext(100);
+    ASSERT_EQ(scheduler->ScheduledWorkCount(), 2);
+    scheduler->AdvanceTime(std::chrono::milliseconds(10));
+    ASSERT_EQ(values, (std::vector<int>{ 99, 100 }));
 }
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <zaf/base/error/precondition_error.h>
+#include <zaf/rx/dispose_bag.h>
+#include <zaf/rx/observable.h>
+#include <zaf/rx/scheduler/single_thread_scheduler.h>
+#include <zaf/rx/subject/subject.h>
+#include "case/rx/manual_scheduler.h"
+
+TEST(RxWindowTest, Precondition) {
+
+    auto observable = zaf::rx::Observable<int>::Just(1);
+    ASSERT_THROW(observable.Window(0), zaf::PreconditionError);
+    ASSERT_THROW(observable.Window(std::chrono::seconds(1), nullptr), zaf::PreconditionError);
+}
+
+
+TEST(RxWindowTest, WindowByCount) {
+
+    zaf::rx::Subject<int> subject;
+    zaf::rx::DisposeBag subs;
+
+    std::vector<std::vector<int>> windows;
+    std::vector<bool> completions;
+    bool is_completed{};
+    subs += subject.AsObservable().Window(2).Subscribe([&](zaf::rx::Observable<int> window) {
+
+        auto index = windows.size();
+        windows.emplace_back();
+        completions.push_back(false);
+
+        subs += window.Subscribe([&windows, index](int value) {
+            windows[index].push_back(value);
+        },
+        [&completions, index]() {
+            completions[index] = true;
+        });
+    },
+    [&]() {
+        is_completed = true;
+    });
+
+    subject.AsObserver().OnNext(1);
+    ASSERT_EQ(windows, (std::vector<std::vector<int>>{ { 1 } }));
+    subject.AsObserver().OnNext(2);
+    ASSERT_EQ(completions, (std::vector<bool>{ true }));
+
+    subject.AsObserver().OnNext(3);
+    ASSERT_EQ(windows, (std::vector<std::vector<int>>{ { 1, 2 }, { 3 } }));
+    ASSERT_EQ(completions, (std::vector<bool>{ true, false }));
+
+    subject.AsObserver().OnCompleted();
+    ASSERT_EQ(completions, (std::vector<bool>{ true, true }));
+    ASSERT_TRUE(is_completed);
+}
+
+
+TEST(RxWindowTest, WindowByTime) {
+
+    auto scheduler = std::make_shared<ManualScheduler>();
+    zaf::rx::Subject<int> subject;
+    zaf::rx::DisposeBag subs;
+
+    std::vector<std::vector<int>> windows;
+    std::vector<bool> completions;
+    subs += subject.AsObservable()
+        .Window(std::chrono::milliseconds(10), scheduler)
+        .Subscribe([&](zaf::rx::Observable<int> window) {
+
+            auto index = windows.size();
+            windows.emplace_back();
+            completions.push_back(false);
+
+            subs += window.Subscribe([&windows, index](int value) {
+                windows[index].push_back(value);
+            },
+            [&completions, index]() {
+                completions[index] = true;
+            });
+        });
+
+    //No empty window is emitted.
+    scheduler->RunPendingWorks();
+    ASSERT_TRUE(windows.empty());
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnNext(2);
+    ASSERT_EQ(windows, (std::vector<std::vector<int>>{ { 1, 2 } }));
+    ASSERT_EQ(completions, (std::vector<bool>{ false }));
+
+    scheduler->RunPendingWorks();
+    ASSERT_EQ(completions, (std::vector<bool>{ true }));
+
+    subject.AsObserver().OnNext(3);
+    ASSERT_EQ(windows, (std::vector<std::vector<int>>{ { 1, 2 }, { 3 } }));
+}
+
+
+TEST(RxWindowTest, PeriodEndsOnAnotherThread) {
+
+    constexpr int item_count = 100'000;
+
+    zaf::rx::Subject<int> subject;
+    zaf::rx::DisposeBag subs;
+
+    std::atomic<int> running_emission_count{};
+    std::atomic<bool> has_concurrent_emission{};
+    auto enter_emission = [&]() {
+        if (++running_emission_count > 1) {
+            has_concurrent_emission = true;
+        }
+    };
+
+    std::vector<int> values;
+    std::size_t window_count{};
+    std::size_t completed_window_count{};
+    bool is_completed{};
+
+    //A zero period makes period ends run back to back on the scheduler thread, while items are
+    //emitted on the current thread.
+    subs += subject.AsObservable()
+        .Window(std::chrono::steady_clock::duration::zero(),
+            std::make_shared<zaf::rx::SingleThreadScheduler>())
+        .Subscribe([&](zaf::rx::Observable<int> window) {
+
+            enter_emission();
+            ++window_count;
+
+            subs += window.Subscribe([&](int value) {
+                enter_emission();
+                values.push_back(value);
+                --running_emission_count;
+            },
+            [&]() {
+                enter_emission();
+                ++completed_window_count;
+                --running_emission_count;
+            });
+
+            --running_emission_count;
+        },
+        [&]() {
+            is_completed = true;
+        });
+
+    for (int value = 0; value < item_count; ++value) {
+        subject.AsObserver().OnNext(value);
+    }
+    subject.AsObserver().OnCompleted();
+    subs.Clear();
+
+    ASSERT_FALSE(has_concurrent_emission);
+    ASSERT_TRUE(is_completed);
+    ASSERT_EQ(completed_window_count, window_count);
+
+    //No item is lost.
+    ASSERT_EQ(values.size(), item_count);
+    for (int value = 0; value < item_count; ++value) {
+        ASSERT_EQ(values[value], value);
+    }
+}
+
+
+TEST(RxWindowTest, Error) {
+
+    zaf::rx::Subject<int> subject;
+    zaf::rx::DisposeBag subs;
+
+    bool has_window_error{};
+    bool has_error{};
+    subs += subject.AsObservable().Window(3).Subscribe([&](zaf::rx::Observable<int> window) {
+        subs += window.Subscribe([](int) {}, [&](const std::exception_ptr&) {
+            has_window_error = true;
+        });
+    },
+    [&](const std::exception_ptr&) {
+        has_error = true;
+    });
+
+    subject.AsObserver().OnNext(1);
+    subject.AsObserver().OnError(std::make_exception_ptr(0));
+    ASSERT_TRUE(has_window_error);
+    ASSERT_TRUE(has_error);
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <zaf/xml/internal/xml_pull_parser.h>
+#include <zaf/xml/xml_error.h>
+
+using namespace zaf;
+using namespace zaf::internal;
+
+namespace {
+
+void ReadAll(XMLPullParser& parser) {
+    while (parser.Read()) { }
+}
+
+bool IsMalformed(std::wstring xml) {
+
+    XMLPullParser parser{ std::move(xml) };
+    try {
+        ReadAll(parser);
+        return false;
+    }
+    catch (const XMLError&) {
+        return true;
+    }
+}
+
+}
+
+TEST(XMLPullParserTest, ReadNodes) {
+
+    XMLPullParser parser{ std::wstring{
+        L"<?xml version=\"1.0\"?>\r\n"
+        L"<!DOCTYPE root [<!ELEMENT root ANY>]>"
+        L"<!-- Comment -->"
+        L"<?pi data?>"
+        L"<ns:root>"
+        L"  <child />Text<![CDATA[<CDATA>]]>"
+        L"</ns:root>"
+    } };
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::XMLDeclaration);
+    ASSERT_EQ(parser.GetName(), L"xml");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::Whitespace);
+    ASSERT_EQ(parser.GetValue(), L"\n");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::DocumentType);
+    ASSERT_EQ(parser.GetName(), L"root");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::Comment);
+    ASSERT_EQ(parser.GetValue(), L" Comment ");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::ProcessingInstruction);
+    ASSERT_EQ(parser.GetName(), L"pi");
+    ASSERT_EQ(parser.GetValue(), L"data");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::ElementStart);
+    ASSERT_EQ(parser.GetName(), L"root");
+    ASSERT_FALSE(parser.IsEmptyElement());
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::Whitespace);
+    ASSERT_EQ(parser.GetValue(), L"  ");
+
+    //There is no end node for an empty element.
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::ElementStart);
+    ASSERT_EQ(parser.GetName(), L"child");
+    ASSERT_TRUE(parser.IsEmptyElement());
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::Text);
+    ASSERT_EQ(parser.GetValue(), L"Text");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::CDATA);
+    ASSERT_EQ(parser.GetValue(), L"<CDATA>");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::ElementEnd);
+    ASSERT_EQ(parser.GetName(), L"root");
+
+    ASSERT_FALSE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::None);
+    ASSERT_FALSE(parser.Read());
+}
+
+
+TEST(XMLPullParserTest, ReadAttributes) {
+
+    XMLPullParser parser{ std::wstring{ LR"(<E a="1" ns:b = 'two' c="a&amp;b"/>)" } };
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::ElementStart);
+
+    ASSERT_TRUE(parser.MoveToFirstAttribute());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::Attribute);
+    ASSERT_EQ(parser.GetName(), L"a");
+    ASSERT_EQ(parser.GetValue(), L"1");
+
+    ASSERT_TRUE(parser.MoveToNextAttribute());
+    ASSERT_EQ(parser.GetName(), L"b");
+    ASSERT_EQ(parser.GetValue(), L"two");
+
+    ASSERT_TRUE(parser.MoveToNextAttribute());
+    ASSERT_EQ(parser.GetName(), L"c");
+    ASSERT_EQ(parser.GetValue(), L"a&b");
+
+    ASSERT_FALSE(parser.MoveToNextAttribute());
+
+    ASSERT_TRUE(parser.MoveToAttributeByName(L"b"));
+    ASSERT_EQ(parser.GetValue(), L"two");
+    ASSERT_FALSE(parser.MoveToAttributeByName(L"d"));
+
+    parser.MoveToElement();
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::ElementStart);
+    ASSERT_EQ(parser.GetName(), L"E");
+
+    //Moving to the next attribute from the element moves to the first attribute.
+    ASSERT_TRUE(parser.MoveToNextAttribute());
+    ASSERT_EQ(parser.GetName(), L"a");
+
+    ASSERT_FALSE(parser.Read());
+}
+
+
+TEST(XMLPullParserTest, DecodeValues) {
+
+    XMLPullParser parser{ std::wstring{
+        L"<E a=\"&lt;&gt;&quot;&apos;&#65;&#x42;\" b=\"1\t2\r\n3&#10;\">"
+        L"x&amp;y\r\nz\r"
+        L"</E>"
+    } };
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_TRUE(parser.MoveToAttributeByName(L"a"));
+    ASSERT_EQ(parser.GetValue(), L"<>\"'AB");
+    ASSERT_TRUE(parser.MoveToAttributeByName(L"b"));
+    ASSERT_EQ(parser.GetValue(), L"1 2 3\n");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetNodeType(), XMLNodeType::Text);
+    ASSERT_EQ(parser.GetValue(), L"x&y\nz\n");
+}
+
+
+TEST(XMLPullParserTest, ReadUTF8) {
+
+    XMLPullParser parser{ std::string_view{
+        "\xEF\xBB\xBF<E a=\"\xE4\xB8\xAD\">\xC3\xA9\xF0\x9F\x98\x80</E>"
+    } };
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_TRUE(parser.MoveToFirstAttribute());
+    ASSERT_EQ(parser.GetValue(), L"\u4E2D");
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetValue(), L"\u00E9\U0001F600");
+
+    ASSERT_THROW(XMLPullParser{ std::string_view{ "<E>\xC0\xAF</E>" } }, XMLError);
+    ASSERT_THROW(XMLPullParser{ std::string_view{ "<E>\xE4\xB8</E>" } }, XMLError);
+    ASSERT_THROW(XMLPullParser{ std::string_view{ "<E>\xED\xA0\x80</E>" } }, XMLError);
+}
+
+
+TEST(XMLPullParserTest, ReadWithoutCopying) {
+
+    std::wstring xml{ LR"(<E a="1">Text</E>)" };
+    XMLPullParser parser{ std::wstring_view{ xml } };
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetName().data(), xml.data() + 1);
+
+    ASSERT_TRUE(parser.MoveToFirstAttribute());
+    ASSERT_EQ(parser.GetValue().data(), xml.data() + 6);
+
+    ASSERT_TRUE(parser.Read());
+    ASSERT_EQ(parser.GetValue().data(), xml.data() + 9);
+}
+
+
+TEST(XMLPullParserTest, MalformedDocument) {
+
+    ASSERT_FALSE(IsMalformed(L"<E></E>"));
+
+    ASSERT_TRUE(IsMalformed(L""));
+    ASSERT_TRUE(IsMalformed(L"<E>"));
+    ASSERT_TRUE(IsMalformed(L"<E></F>"));
+    ASSERT_TRUE(IsMalformed(L"<E/><F/>"));
+    ASSERT_TRUE(IsMalformed(L"Text<E/>"));
+    ASSERT_TRUE(IsMalformed(L"<E a=\"1\" a=\"2\"/>"));
+    ASSERT_TRUE(IsMalformed(L"<E a=\"1\"b=\"2\"/>"));
+    ASSERT_TRUE(IsMalformed(L"<E a=1/>"));
+    ASSERT_TRUE(IsMalformed(L"<E a=\"<\"/>"));
+    ASSERT_TRUE(IsMalformed(L"<E>&unknown;</E>"));
+    ASSERT_TRUE(IsMalformed(L"<E>&amp</E>"));
+    ASSERT_TRUE(IsMalformed(L"<E><!-- </E>"));
+    ASSERT_TRUE(IsMalformed(L"<E/><?xml version=\"1.0\"?>"));
+    ASSERT_TRUE(IsMalformed(L"<![CDATA[]]><E/>"));
+}
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <chrono>
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <zaf/base/error/com_error.h>
 #include <zaf/xml/xml_error.h>
@@ -12,6 +14,12 @@ XMLReader CreateReader(std::string_view xml) {
     return XMLReader{ stream };
 }
 
+
+XMLReader CreateNativeReader(std::string_view xml) {
+    auto stream = Stream::FromMemory(xml.data(), xml.size());
+    return XMLReader{ stream, { .parser_type = XMLParserType::Native } };
+}
+
 }
 
 TEST(XMLReaderTest, Read) {
@@ -79,4 +87,139 @@ TEST(XMLReaderTest, ReadUntilElement) {
         ASSERT_FALSE(reader.Read());
         ASSERT_THROW(reader.ReadUntilElement(L"E"), XMLError);
     }
+}
+
+
+TEST(XMLReaderTest, NativeParser) {
+
+    {
+        auto reader = CreateNativeReader(R"(<?xml version="1.0" ?><E></E>)");
+        ASSERT_NO_THROW(reader.ReadXMLDeclaration());
+        ASSERT_EQ(reader.GetNodeType(), XMLNodeType::ElementStart);
+        ASSERT_EQ(reader.GetName(), L"E");
+        ASSERT_TRUE(reader.Read());
+        ASSERT_EQ(reader.GetNodeType(), XMLNodeType::ElementEnd);
+        ASSERT_FALSE(reader.Read());
+    }
+
+    {
+        auto reader = CreateNativeReader("    <E />");
+        ASSERT_NO_THROW(reader.ReadUntilElement(L"E"));
+        ASSERT_TRUE(reader.IsEmptyElement());
+        ASSERT_FALSE(reader.Read());
+        ASSERT_THROW(reader.ReadUntilElement(L"E"), XMLError);
+    }
+
+    {
+        auto reader = CreateNativeReader(R"(<E a="1" b="2.5"></E>)");
+
+        int a{};
+        float b{};
+        reader.ReadElementAttributes(L"E", [&](const XMLAttributeReader& attribute_reader) {
+            if (attribute_reader.GetName() == L"a") {
+                a = attribute_reader.GetNumber<int>();
+            }
+            else if (attribute_reader.GetName() == L"b") {
+                b = attribute_reader.GetNumber<float>();
+            }
+        });
+        ASSERT_EQ(a, 1);
+        ASSERT_EQ(b, 2.5f);
+        ASSERT_FALSE(reader.Read());
+    }
+
+    {
+        auto reader = CreateNativeReader(R"(<E a="1" />)");
+        ASSERT_NO_THROW(reader.ReadUntilElement(L"E"));
+        ASSERT_EQ(reader.GetAttributeValue(L"a"), L"1");
+        ASSERT_EQ(reader.GetAttributeValue(L"b"), L"");
+        ASSERT_EQ(reader.GetNodeType(), XMLNodeType::ElementStart);
+    }
+
+    //UTF-16 with the byte order mark.
+    {
+        std::wstring xml{ L"\xFEFF<E>Text</E>" };
+        auto stream = Stream::FromMemory(xml.data(), xml.size() * sizeof(wchar_t));
+        XMLReader reader{ stream, { .parser_type = XMLParserType::Native } };
+        ASSERT_NO_THROW(reader.ReadNotEmptyElementStart(L"E"));
+        ASSERT_EQ(reader.GetNodeType(), XMLNodeType::Text);
+        ASSERT_EQ(reader.GetValue(), L"Text");
+
+        //The value refers to the content of the memory stream.
+        auto buffer = reinterpret_cast<const wchar_t*>(stream.UnderlyingBuffer());
+        ASSERT_EQ(reader.GetValue().data(), buffer + 4);
+    }
+
+    //Truncated UTF-16.
+    {
+        std::wstring xml{ L"<E>Text</E>" };
+        auto stream = Stream::FromMemory(xml.data(), xml.size() * sizeof(wchar_t) - 1);
+        XMLInputOptions options{
+            .code_page = CodePage::UTF16,
+            .parser_type = XMLParserType::Native,
+        };
+        ASSERT_THROW(XMLReader(stream, options), XMLError);
+    }
+
+    //Unsupported encodings.
+    {
+        //Big-endian UTF-16.
+        std::string_view xml{ "\xFE\xFF\0<\0E\0/\0>", 10 };
+        auto stream = Stream::FromMemory(xml.data(), xml.size());
+        ASSERT_THROW(
+            XMLReader(stream, { .parser_type = XMLParserType::Native }),
+            XMLError);
+
+        std::string_view gbk_xml{ "<E>\xD6\xD0</E>" };
+        stream = Stream::FromMemory(gbk_xml.data(), gbk_xml.size());
+        XMLInputOptions options{
+            .code_page = static_cast<CodePage>(936),
+            .parser_type = XMLParserType::Native,
+        };
+        ASSERT_THROW(XMLReader(stream, options), XMLError);
+    }
+
+    {
+        auto reader = CreateNativeReader("<E></F>");
+        ASSERT_TRUE(reader.Read());
+        ASSERT_THROW(reader.Read(), XMLError);
+    }
+}
+
+
+TEST(XMLReaderTest, DISABLED_Benchmark_Throughput) {
+
+    std::string xml{ R"(<?xml version="1.0" encoding="utf-8"?><Root>)" };
+    for (int index = 0; index < 100'000; ++index) {
+        xml += R"(<Item Name="Item" Value="12345" Text="a &amp; b">Content text</Item>)";
+    }
+    xml += "</Root>";
+
+    for (auto parser_type : { XMLParserType::XmlLite, XMLParserType::Native }) {
+
+        auto stream = Stream::FromMemory(xml.data(), xml.size());
+
+        auto begin_time = std::chrono::steady_clock::now();
+
+        XMLReader reader{ stream, { .parser_type = parser_type } };
+        std::size_t attribute_count{};
+        while (reader.Read()) {
+            if (reader.MoveToFirstAttribute()) {
+                do {
+                    ++attribute_count;
+                } while (reader.MoveToNextAttribute());
+                reader.MoveToElement();
+            }
+        }
+
+        auto elapsed = std::chrono::steady_clock::now() - begin_time;
+        ASSERT_EQ(attribute_count, 300'002);
+
+        auto seconds = std::chrono::duration<double>(elapsed).count();
+        std::printf(
+            "%s: %.3f ms, %.1f MB/s\n",
+            parser_type == XMLParserType::Native ? "Native" : "XmlLite",
+            seconds * 1000,
+            xml.size() / seconds / (1024 * 1024));
+    }
 }
\ No newline at end of file